@@ -0,0 +1,137 @@
+#include <eav/Adapters.hpp>
+
+#include <charconv>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Common.hpp"
+
+// Lookups: adapt::Get / adapt::At (Option<T&>, nothing copied) vs the copy-and-wrap idiom
+// (`make::Some(it->second)`); the caller keeps the Option (DoNotOptimize), so the copy can't be
+// dropped. Parse<int> vs a hand-written from_chars wrapper and std::stoi
+
+namespace bench {
+
+template <typename P>
+std::unordered_map<int, P> Table() {
+    std::unordered_map<int, P> table;
+    for (int i = 0; i < static_cast<int>(kBatch); ++i) {
+        table.emplace(i, Payload<P>(i));
+    }
+    return table;
+}
+
+template <typename P>
+std::vector<P> Column() {
+    std::vector<P> column;
+    for (int i = 0; i < static_cast<int>(kBatch); ++i) {
+        column.push_back(Payload<P>(i));
+    }
+    return column;
+}
+
+// --- Map lookup (a failure is a missing key) ---
+
+template <typename P>
+void BM_MapLookup_Get(benchmark::State& state) {
+    const auto table = Table<P>();
+    Run(state, [&table](int v) {
+        auto opt = adapt::Get(table, v);
+        benchmark::DoNotOptimize(opt);
+    });
+}
+
+template <typename P>
+void BM_MapLookup_CopyWrap(benchmark::State& state) {
+    const auto table = Table<P>();
+    Run(state, [&table](int v) {
+        auto it = table.find(v);
+        Option<P> opt = it != table.end() ? Option<P>(make::Some(it->second)) : Option<P>(make::None());
+        benchmark::DoNotOptimize(opt);
+    });
+}
+
+BENCHMARK_TEMPLATE(BM_MapLookup_Get, Small)->Apply(Ratios);
+BENCHMARK_TEMPLATE(BM_MapLookup_CopyWrap, Small)->Apply(Ratios);
+BENCHMARK_TEMPLATE(BM_MapLookup_Get, Large)->Apply(Ratios);
+BENCHMARK_TEMPLATE(BM_MapLookup_CopyWrap, Large)->Apply(Ratios);
+
+// --- Bounds-checked index (a failure is an out-of-range index) ---
+
+template <typename P>
+void BM_Index_At(benchmark::State& state) {
+    const auto column = Column<P>();
+    Run(state, [&column](int v) {
+        auto opt = adapt::At(column, static_cast<std::size_t>(v));
+        benchmark::DoNotOptimize(opt);
+    });
+}
+
+template <typename P>
+void BM_Index_CopyWrap(benchmark::State& state) {
+    const auto column = Column<P>();
+    Run(state, [&column](int v) {
+        const auto i = static_cast<std::size_t>(v);
+        Option<P> opt = i < column.size() ? Option<P>(make::Some(column[i])) : Option<P>(make::None());
+        benchmark::DoNotOptimize(opt);
+    });
+}
+
+BENCHMARK_TEMPLATE(BM_Index_At, Small)->Apply(Ratios);
+BENCHMARK_TEMPLATE(BM_Index_CopyWrap, Small)->Apply(Ratios);
+BENCHMARK_TEMPLATE(BM_Index_At, Large)->Apply(Ratios);
+BENCHMARK_TEMPLATE(BM_Index_CopyWrap, Large)->Apply(Ratios);
+
+// --- Parsing (a failure is text that is not a number) ---
+
+// Calls `body(text)` for the whole batch on every iteration
+template <typename F>
+void RunText(benchmark::State& state, F&& body) {
+    std::vector<std::string> texts;
+    for (int v : Inputs(static_cast<int>(state.range(0)))) {
+        texts.push_back(v >= 0 ? std::to_string(v * 7919) : "n/a");
+    }
+    for (auto _ : state) {
+        for (const std::string& text : texts) {
+            body(std::string_view(text));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kBatch));
+}
+
+void BM_Parse_Adapter(benchmark::State& state) {
+    RunText(state, [](std::string_view text) {
+        auto res = adapt::Parse<int>(text);
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+void BM_Parse_HandFromChars(benchmark::State& state) {
+    RunText(state, [](std::string_view text) {
+        int value = 0;
+        auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        Result<int, Error> res = ec == std::errc() && ptr == text.data() + text.size()
+                                     ? Result<int, Error>(make::Ok(int{value}))
+                                     : Result<int, Error>(make::Err(Error{static_cast<int>(ec)}));
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+void BM_Parse_Stoi(benchmark::State& state) {
+    RunText(state, [](std::string_view text) {
+        try {
+            int value = std::stoi(std::string(text));
+            benchmark::DoNotOptimize(value);
+        } catch (const std::invalid_argument&) {
+            benchmark::ClobberMemory();
+        }
+    });
+}
+
+BENCHMARK(BM_Parse_Adapter)->Apply(Ratios);
+BENCHMARK(BM_Parse_HandFromChars)->Apply(Ratios);
+BENCHMARK(BM_Parse_Stoi)->Apply(Ratios);
+
+}  // namespace bench
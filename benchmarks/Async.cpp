@@ -0,0 +1,97 @@
+#include <future>
+
+#include <eav/Async.hpp>
+
+#include "Common.hpp"
+
+// Three-step asynchronous chains on a pool of 2 threads: AsyncResult (one allocation per chain,
+// stages fused on the producing thread) vs std::future<Result> hops (a promise, a shared state
+// with its mutex and a pool task per step), with 1 or 64 chains in flight (real time)
+
+namespace bench {
+
+inline Result<int, Error> Fetch(int v) {
+    if (v < 0) {
+        return make::Err(Error{v});
+    }
+    return make::Ok(int{v});
+}
+
+inline Result<int, Error> Check(int v) {
+    if (v % 7 == 0) {
+        return make::Err(Error{7});
+    }
+    return make::Ok(v + 1);
+}
+
+inline int Scale(int v) {
+    return v * 3;
+}
+
+void BM_AsyncChain_Eav(benchmark::State& state) {
+    exec::ThreadPool pool(2);
+    const auto inputs = Inputs(99);
+    const auto in_flight = static_cast<std::size_t>(state.range(0));
+    std::vector<AsyncResult<int, Error>> pending;
+    pending.reserve(in_flight);
+    std::size_t next = 0;
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < in_flight; ++i, next = (next + 1) % kBatch) {
+            const int v = inputs[next];
+            pending.push_back((async::Spawn(pool, [v] { return Fetch(v); })
+                | combine::result::AndThen(&Check)
+                | combine::result::MapOk(&Scale)).start());
+        }
+        for (auto& p : pending) {
+            auto res = std::move(p).get();
+            benchmark::DoNotOptimize(res);
+        }
+        pending.clear();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+template <typename F>
+auto SubmitFuture(exec::ThreadPool& pool, F func) {
+    std::promise<std::invoke_result_t<F&>> promise;
+    auto future = promise.get_future();
+    pool.Submit([promise = std::move(promise), func = std::move(func)]() mutable { promise.set_value(func()); });
+    return future;
+}
+
+template <typename R, typename F>
+auto ThenFuture(exec::ThreadPool& pool, std::future<R> prev, F func) {
+    return SubmitFuture(pool, [prev = std::move(prev), func]() mutable { return func(prev.get()); });
+}
+
+void BM_AsyncChain_Future(benchmark::State& state) {
+    exec::ThreadPool pool(2);
+    const auto inputs = Inputs(99);
+    const auto in_flight = static_cast<std::size_t>(state.range(0));
+    std::vector<std::future<Result<int, Error>>> pending;
+    pending.reserve(in_flight);
+    std::size_t next = 0;
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < in_flight; ++i, next = (next + 1) % kBatch) {
+            const int v = inputs[next];
+            auto fetched = SubmitFuture(pool, [v] { return Fetch(v); });
+            auto checked = ThenFuture(pool, std::move(fetched), [](Result<int, Error> res) {
+                return std::move(res) | combine::result::AndThen(&Check);
+            });
+            pending.push_back(ThenFuture(pool, std::move(checked), [](Result<int, Error> res) {
+                return std::move(res) | combine::result::MapOk(&Scale);
+            }));
+        }
+        for (auto& p : pending) {
+            auto res = p.get();
+            benchmark::DoNotOptimize(res);
+        }
+        pending.clear();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+BENCHMARK(BM_AsyncChain_Eav)->ArgName("in_flight")->Arg(1)->Arg(64)->UseRealTime();
+BENCHMARK(BM_AsyncChain_Future)->ArgName("in_flight")->Arg(1)->Arg(64)->UseRealTime();
+
+}  // namespace bench
@@ -0,0 +1,111 @@
+#include <eav/OptionVector.hpp>
+#include <eav/ResultVector.hpp>
+
+#include "Common.hpp"
+
+// Columnar batches vs a std::vector of Results: the same MapOk / Filter / AndThen chain over a
+// batch of rows. Every variant starts from a copy of its input, so both pay one pass of copying.
+
+namespace bench {
+
+struct Scale {
+    int operator()(int v) const {
+        return v * 3 + 1;
+    }
+};
+
+struct NotSevenInt {
+    bool operator()(int v) const {
+        return v % 7 != 0;
+    }
+};
+
+inline std::vector<Result<int, Error>> RowInputs(int ok_percent) {
+    std::vector<Result<int, Error>> rows;
+    rows.reserve(kBatch);
+    for (int v : Inputs(ok_percent)) {
+        if (v >= 0) {
+            rows.push_back(make::Ok<int, Error>(std::in_place, v));
+        } else {
+            rows.push_back(make::Err<Error, int>(std::in_place, v));
+        }
+    }
+    return rows;
+}
+
+void BM_BatchMapOk_Rows(benchmark::State& state) {
+    const auto input = RowInputs(static_cast<int>(state.range(0)));
+    std::vector<Result<int, Error>> out;
+    out.reserve(kBatch);
+    for (auto _ : state) {
+        out.clear();
+        for (const auto& row : input) {
+            out.push_back(Result<int, Error>(row) | combine::result::MapOk(Scale{}));
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kBatch));
+}
+
+void BM_BatchMapOk_Columns(benchmark::State& state) {
+    const ResultVector<int, Error> input(RowInputs(static_cast<int>(state.range(0))));
+    for (auto _ : state) {
+        auto out = ResultVector<int, Error>(input) | combine::result::MapOk(Scale{});
+        benchmark::DoNotOptimize(out.ok_column().data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kBatch));
+}
+
+void BM_BatchChain_Rows(benchmark::State& state) {
+    const auto input = RowInputs(static_cast<int>(state.range(0)));
+    std::vector<Result<int, Error>> out;
+    out.reserve(kBatch);
+    for (auto _ : state) {
+        out.clear();
+        for (const auto& row : input) {
+            out.push_back(Result<int, Error>(row) | combine::result::MapOk(Scale{}) |
+                          combine::result::Filter(NotSevenInt{}, Error{7}));
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kBatch));
+}
+
+void BM_BatchChain_Columns(benchmark::State& state) {
+    const ResultVector<int, Error> input(RowInputs(static_cast<int>(state.range(0))));
+    for (auto _ : state) {
+        auto out = ResultVector<int, Error>(input) | combine::result::MapOk(Scale{}) |
+                   combine::result::Filter(NotSevenInt{}, Error{7});
+        benchmark::DoNotOptimize(out.ok_column().data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kBatch));
+}
+
+void BM_BatchMap_OptionColumns(benchmark::State& state) {
+    OptionVector<int> input;
+    for (int v : Inputs(static_cast<int>(state.range(0)))) {
+        if (v >= 0) {
+            input.push_some(v);
+        } else {
+            input.push_none();
+        }
+    }
+    for (auto _ : state) {
+        auto out = OptionVector<int>(input) | combine::option::Map(Scale{});
+        benchmark::DoNotOptimize(out.values().data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kBatch));
+}
+
+BENCHMARK(BM_BatchMapOk_Rows)->Apply(Ratios);
+BENCHMARK(BM_BatchMapOk_Columns)->Apply(Ratios);
+BENCHMARK(BM_BatchChain_Rows)->Apply(Ratios);
+BENCHMARK(BM_BatchChain_Columns)->Apply(Ratios);
+BENCHMARK(BM_BatchMap_OptionColumns)->Apply(Ratios);
+
+}  // namespace bench
@@ -0,0 +1,73 @@
+#include "Common.hpp"
+
+// A named Result inspected by a pipeline, and still needed afterwards: copying it into the
+// pipeline vs borrowing it (`named | ...`, `named.as_ref() | ...`) vs hand-written code.
+// The pipeline reads one field, so only the copy touches the whole payload.
+
+namespace bench {
+
+struct Field {
+    template <typename P>
+    int operator()(const P& p) const {
+        return p.v;
+    }
+};
+
+template <typename P>
+void BM_Inspect_Copy(benchmark::State& state) {
+    Run(state, [](int v) {
+        const auto named = EavResult<P>(v);
+        benchmark::DoNotOptimize(named);
+        auto copy = named;
+        auto res = std::move(copy) | combine::result::Filter(NotSeven{}, Error{7}) | combine::result::MapOk(Field{});
+        benchmark::DoNotOptimize(res);
+        benchmark::DoNotOptimize(named);
+    });
+}
+
+template <typename P>
+void BM_Inspect_Borrow(benchmark::State& state) {
+    static const auto pipeline = combine::result::MapOk(Field{})
+        | combine::result::Filter([](int f) { return f % 7 != 0; }, Error{7});
+    Run(state, [](int v) {
+        const auto named = EavResult<P>(v);
+        benchmark::DoNotOptimize(named);
+        auto res = named | pipeline;
+        benchmark::DoNotOptimize(res);
+        benchmark::DoNotOptimize(named);
+    });
+}
+
+template <typename P>
+void BM_Inspect_AsRef(benchmark::State& state) {
+    Run(state, [](int v) {
+        const auto named = EavResult<P>(v);
+        benchmark::DoNotOptimize(named);
+        auto res = named.as_ref() | combine::result::MapOk(Field{});
+        benchmark::DoNotOptimize(res);
+        benchmark::DoNotOptimize(named);
+    });
+}
+
+template <typename P>
+void BM_Inspect_Hand(benchmark::State& state) {
+    Run(state, [](int v) {
+        const auto named = EavResult<P>(v);
+        benchmark::DoNotOptimize(named);
+        if (named.is_ok() && named.unwrap_ok_unchecked().v % 7 != 0) {
+            int field = named.unwrap_ok_unchecked().v;
+            benchmark::DoNotOptimize(field);
+        } else {
+            Error err{7};
+            benchmark::DoNotOptimize(err);
+        }
+        benchmark::DoNotOptimize(named);
+    });
+}
+
+EAV_BENCH(BM_Inspect_Copy);
+EAV_BENCH(BM_Inspect_Borrow);
+EAV_BENCH(BM_Inspect_AsRef);
+EAV_BENCH(BM_Inspect_Hand);
+
+}  // namespace bench
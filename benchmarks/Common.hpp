@@ -0,0 +1,223 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#if __has_include(<expected>)
+#    include <expected>
+#endif
+
+#include <eav/Option.hpp>
+#include <eav/Result.hpp>
+
+// std::expected baselines need the C++23 monadic interface (and_then, transform, ...)
+#if defined(__cpp_lib_expected) && __cpp_lib_expected >= 202211L
+#    define EAV_BENCH_HAS_EXPECTED 1
+#else
+#    define EAV_BENCH_HAS_EXPECTED 0
+#endif
+
+// std::optional baselines need the C++23 monadic interface (and_then, transform, or_else)
+#if defined(__cpp_lib_optional) && __cpp_lib_optional >= 202110L
+#    define EAV_BENCH_HAS_OPTIONAL 1
+#else
+#    define EAV_BENCH_HAS_OPTIONAL 0
+#endif
+
+namespace bench {
+
+using namespace eav;
+
+// --- Payloads ---
+
+struct Error {
+    int code;
+};
+
+struct Small {
+    int v;
+};
+
+struct Large {
+    int v;
+    std::array<std::int64_t, 31> pad;  // 256 bytes in total
+};
+
+template <typename P>
+P Payload(int v) {
+    P p{};
+    p.v = v;
+    return p;
+}
+
+// --- Inputs: `ok_percent`% of non-negative values (=> Ok/Some), the rest are failures ---
+
+inline constexpr std::size_t kBatch = 1024;
+
+// (`ok` out of `scale`: per mille with scale = 1000)
+inline std::vector<int> Inputs(int ok, int scale = 100) {
+    std::vector<int> inputs(kBatch);
+    std::uint32_t seed = 42;
+    for (std::size_t i = 0; i < kBatch; ++i) {
+        seed = seed * 1664525u + 1013904223u;  // LCG: deterministic across runs
+        inputs[i] = static_cast<int>(seed >> 16) % scale < ok ? static_cast<int>(i) : -1;
+    }
+    return inputs;
+}
+
+// Success-heavy and error-heavy workloads
+inline void Ratios(benchmark::internal::Benchmark* b) {
+    b->ArgName("ok%")->Arg(99)->Arg(1);
+}
+
+// 99.9%, 50% and 1% successes, in per mille (Run with scale = 1000)
+inline void RatiosPerMille(benchmark::internal::Benchmark* b) {
+    b->ArgName("ok/1000")->Arg(999)->Arg(500)->Arg(10);
+}
+
+// Calls `body(input)` for the whole batch on every iteration
+template <typename F>
+void Run(benchmark::State& state, F&& body, int scale = 100) {
+    const auto inputs = Inputs(static_cast<int>(state.range(0)), scale);
+    for (auto _ : state) {
+        for (int v : inputs) {
+            body(v);
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kBatch));
+}
+
+// --- Sources: the same input as eav / std / hand-written value ---
+
+template <typename P>
+Result<P, Error> EavResult(int v) {
+    if (v >= 0) {
+        return make::Ok(Payload<P>(v));
+    }
+    return make::Err(Error{v});
+}
+
+template <typename P>
+Option<P> EavOption(int v) {
+    if (v >= 0) {
+        return make::Some(Payload<P>(v));
+    }
+    return make::None();
+}
+
+template <typename P>
+std::optional<P> StdOptional(int v) {
+    if (v >= 0) {
+        return Payload<P>(v);
+    }
+    return std::nullopt;
+}
+
+#if EAV_BENCH_HAS_EXPECTED
+template <typename P>
+std::expected<P, Error> StdExpected(int v) {
+    if (v >= 0) {
+        return Payload<P>(v);
+    }
+    return std::unexpected(Error{v});
+}
+#endif
+
+// --- Stage functions shared by eav, std and hand-written variants ---
+
+struct Inc {
+    template <typename P>
+    P operator()(P p) const {
+        p.v += 1;
+        return p;
+    }
+};
+
+struct NotSeven {
+    template <typename P>
+    bool operator()(const P& p) const {
+        return p.v % 7 != 0;
+    }
+};
+
+struct Bump {
+    Error operator()(Error e) const {
+        return Error{e.code - 1};
+    }
+};
+
+// AndThen: fails on multiples of 7
+struct StepEav {
+    template <typename P>
+    Result<P, Error> operator()(P p) const {
+        if (p.v % 7 == 0) {
+            return make::Err(Error{7});
+        }
+        p.v += 1;
+        return make::Ok(std::move(p));
+    }
+};
+
+// OrElse: recovers from the input failure (-1) only
+template <typename P>
+struct RecoverEav {
+    Result<P, Error> operator()(Error e) const {
+        if (e.code == -1) {
+            return make::Ok(Payload<P>(0));
+        }
+        return make::Err(std::move(e));
+    }
+};
+
+// Option::AndThen: None on multiples of 7
+struct StepSome {
+    template <typename P>
+    Option<P> operator()(P p) const {
+        if (p.v % 7 == 0) {
+            return make::None();
+        }
+        p.v += 1;
+        return make::Some(std::move(p));
+    }
+};
+
+template <typename P>
+struct Fallback {
+    Option<P> operator()() const {
+        return make::Some(Payload<P>(0));
+    }
+};
+
+#if EAV_BENCH_HAS_EXPECTED
+struct StepStd {
+    template <typename P>
+    std::expected<P, Error> operator()(P p) const {
+        if (p.v % 7 == 0) {
+            return std::unexpected(Error{7});
+        }
+        p.v += 1;
+        return p;
+    }
+};
+
+template <typename P>
+struct RecoverStd {
+    std::expected<P, Error> operator()(Error e) const {
+        if (e.code == -1) {
+            return Payload<P>(0);
+        }
+        return std::unexpected(e);
+    }
+};
+#endif
+
+// Registers a benchmark template for both payload sizes and both workloads
+#define EAV_BENCH(fn)                                            \
+    BENCHMARK_TEMPLATE(fn, ::bench::Small)->Apply(::bench::Ratios); \
+    BENCHMARK_TEMPLATE(fn, ::bench::Large)->Apply(::bench::Ratios)
+
+}  // namespace bench
@@ -0,0 +1,97 @@
+# Compile-time benchmark: one synthetic translation unit with EAV_COMPILE_TIME_PIPELINES fused
+# Result pipelines (five stages each, distinct lambdas, like hand-written code), built in
+# several variants that differ only in how eav is brought in:
+#   Umbrella  #include <eav/Result.hpp>
+#   Core      #include <eav/Result/Core.hpp> and the combinator headers it uses
+#   Extern    Umbrella + EAV_EXTERN_RESULT for the Result types of the pipelines
+#   Module    import eav; (with EAV_BUILD_MODULE)
+# and a header-only TU per variant (no pipelines) for the cost of the includes alone.
+#     cmake --build <dir> --target eav_compile_time
+# Clang writes a -ftime-trace .json next to every object file; GCC prints -ftime-report.
+
+set(EAV_COMPILE_TIME_PIPELINES 500 CACHE STRING "Pipelines in the compile-time benchmark TU")
+
+set(_eav_ct_dir ${CMAKE_CURRENT_BINARY_DIR}/CompileTime)
+
+set(_eav_ct_prologue_Umbrella "#include <eav/Result.hpp>\n")
+string(CONCAT _eav_ct_prologue_Core
+    "#include <eav/Result/Combinators/AndThen.hpp>\n"
+    "#include <eav/Result/Combinators/Filter.hpp>\n"
+    "#include <eav/Result/Combinators/MapOk.hpp>\n"
+    "#include <eav/Result/Combinators/OrElse.hpp>\n"
+    "#include <eav/Result/Core.hpp>\n")
+string(CONCAT _eav_ct_prologue_Extern
+    "#include <eav/Extern.hpp>\n"
+    "#include <eav/Result.hpp>\n")
+set(_eav_ct_prologue_Module "import eav;\n")
+
+set(_eav_ct_types "enum class Errc : unsigned char { kBad, kWorse };\n")
+string(CONCAT _eav_ct_extern_Extern
+    "EAV_EXTERN_RESULT(int, Errc);\n"
+    "EAV_EXTERN_RESULT(long, Errc);\n")
+
+set(_eav_ct_variants Umbrella Core Extern)
+if (TARGET eav_module)
+    list(APPEND _eav_ct_variants Module)
+endif()
+
+# The pipelines, the same for every variant
+set(_eav_ct_body "")
+math(EXPR _eav_ct_last "${EAV_COMPILE_TIME_PIPELINES} - 1")
+foreach (i RANGE ${_eav_ct_last})
+    math(EXPR _eav_ct_mod "${i} % 7")
+    string(APPEND _eav_ct_body
+        "\n"
+        "eav::Result<long, Errc> Pipeline${i}(int x) {\n"
+        "    using namespace eav;\n"
+        "    Result<int, Errc> in = x > ${i} ? Result<int, Errc>(make::Ok(x)) : Result<int, Errc>(make::Err(Errc::kBad));\n"
+        "    return std::move(in)\n"
+        "        | combine::result::MapOk([](int v) { return v + ${i}; })\n"
+        "        | combine::result::AndThen([](int v) -> Result<int, Errc> {\n"
+        "              if (v % 7 == ${_eav_ct_mod}) {\n"
+        "                  return make::Err(Errc::kWorse);\n"
+        "              }\n"
+        "              return make::Ok(v);\n"
+        "          })\n"
+        "        | combine::result::Filter([](int v) { return v != ${i}; }, Errc::kBad)\n"
+        "        | combine::result::MapOk([](int v) { return static_cast<long>(v) * 2; })\n"
+        "        | combine::result::OrElse([](Errc err) -> Result<long, Errc> {\n"
+        "              if (err == Errc::kWorse) {\n"
+        "                  return make::Ok(-1L);\n"
+        "              }\n"
+        "              return make::Err(Errc{err});\n"
+        "          });\n"
+        "}\n")
+endforeach()
+
+if (CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+    set(_eav_ct_options -ftime-trace)
+elseif (CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+    set(_eav_ct_options -ftime-report)
+endif()
+
+add_custom_target(eav_compile_time)
+
+foreach (variant IN LISTS _eav_ct_variants)
+    string(CONCAT _eav_ct_head
+        "// Generated by benchmarks/CompileTime.cmake\n"
+        "#include <utility>\n"
+        "${_eav_ct_prologue_${variant}}"
+        "${_eav_ct_types}"
+        "${_eav_ct_extern_${variant}}")
+
+    file(CONFIGURE OUTPUT ${_eav_ct_dir}/Headers${variant}.cpp CONTENT "${_eav_ct_head}" @ONLY)
+    file(CONFIGURE OUTPUT ${_eav_ct_dir}/Pipelines${variant}.cpp CONTENT "${_eav_ct_head}${_eav_ct_body}" @ONLY)
+
+    add_library(eav_compile_time_${variant} OBJECT EXCLUDE_FROM_ALL
+        ${_eav_ct_dir}/Headers${variant}.cpp
+        ${_eav_ct_dir}/Pipelines${variant}.cpp
+    )
+    if (variant STREQUAL "Module")
+        target_link_libraries(eav_compile_time_${variant} PRIVATE eav_module)
+    else()
+        target_link_libraries(eav_compile_time_${variant} PRIVATE eav)
+    endif()
+    target_compile_options(eav_compile_time_${variant} PRIVATE ${_eav_ct_options})
+    add_dependencies(eav_compile_time eav_compile_time_${variant})
+endforeach()
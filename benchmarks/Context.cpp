@@ -0,0 +1,78 @@
+#include <eav/Context.hpp>
+
+#include <string>
+#include <string_view>
+
+#include "Common.hpp"
+
+// Context on error paths: a three-stage chain with and without Context stages. On the success
+// path Context should cost nothing; on the error path it records into the thread's arena (reset
+// once per batch, like once per request) and never formats. The "heap_bytes" counter shows the
+// arena reaching a steady state.
+
+namespace bench {
+
+inline constexpr std::string_view kHeader = "Content-Length";
+
+struct Plus1 {
+    int operator()(int v) const {
+        return v + 1;
+    }
+};
+
+struct Half {
+    Result<int, Error> operator()(int v) const {
+        if (v % 2 != 0) {
+            return make::Err(Error{v});
+        }
+        return make::Ok(int{v / 2});
+    }
+};
+
+inline Result<int, Error> Source(int v) {
+    if (v < 0) {
+        return make::Err(Error{v});
+    }
+    return make::Ok(int{v * 4});
+}
+
+void BM_Context_None(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = Source(v) | combine::result::AndThen(Half{}) | combine::result::MapOk(Plus1{});
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+void BM_Context_Attached(benchmark::State& state) {
+    const auto inputs = Inputs(static_cast<int>(state.range(0)));
+    ContextArena& arena = ContextArena::ForThread();
+    for (auto _ : state) {
+        for (int v : inputs) {
+            auto res = Source(v) | combine::result::AndThen(Half{}) |
+                       combine::result::Context("while parsing header {}", kHeader) |
+                       combine::result::MapOk(Plus1{}) | combine::result::Context("in shard {}", 12);
+            benchmark::DoNotOptimize(res);
+        }
+        arena.Reset();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kBatch));
+    state.counters["heap_bytes"] = static_cast<double>(arena.heap_bytes());
+}
+
+// The eager alternative: format the message into the error on every failure
+void BM_Context_EagerString(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = Source(v) | combine::result::AndThen(Half{}) | combine::result::MapOk(Plus1{}) |
+                   combine::result::MapErr([](Error e) {
+                       return "in shard 12: while parsing header " + std::string(kHeader) + ": " +
+                              std::to_string(e.code);
+                   });
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+BENCHMARK(BM_Context_None)->Apply(Ratios);
+BENCHMARK(BM_Context_Attached)->Apply(Ratios);
+BENCHMARK(BM_Context_EagerString)->Apply(Ratios);
+
+}  // namespace bench
@@ -0,0 +1,108 @@
+#include <eav/Coro.hpp>
+
+#include <memory_resource>
+
+#include "Common.hpp"
+
+// Three-step propagation (source -> Check -> Check): coroutine with co_await vs AndThen chain
+// vs hand-written `if (is_err()) return err`; the coroutine frame from the heap or from a
+// user-supplied allocator
+
+namespace bench {
+
+// Fails on multiples of 7 (on top of the failures of the source)
+template <typename P>
+Result<P, Error> Check(P p) {
+    if (p.v % 7 == 0) {
+        return make::Err(Error{p.v});
+    }
+    p.v += 1;
+    return make::Ok(std::move(p));
+}
+
+struct CheckEav {
+    template <typename P>
+    Result<P, Error> operator()(P p) const {
+        return Check(std::move(p));
+    }
+};
+
+template <typename P>
+Result<P, Error> ViaCoro(int v) {
+    auto p = co_await EavResult<P>(v);
+    auto q = co_await Check(std::move(p));
+    co_return co_await Check(std::move(q));
+}
+
+// The frame comes from `alloc` (a pool resource below): no heap allocation per call
+template <typename P>
+Result<P, Error> ViaCoroAlloc(std::allocator_arg_t, const std::pmr::polymorphic_allocator<>&, int v) {
+    auto p = co_await EavResult<P>(v);
+    auto q = co_await Check(std::move(p));
+    co_return co_await Check(std::move(q));
+}
+
+template <typename P>
+Result<P, Error> ViaAndThen(int v) {
+    return EavResult<P>(v) | combine::result::AndThen(CheckEav{}) | combine::result::AndThen(CheckEav{});
+}
+
+template <typename P>
+Result<P, Error> ViaManual(int v) {
+    auto p = EavResult<P>(v);
+    if (p.is_err()) {
+        return make::Err(std::move(p).unwrap_err());
+    }
+    auto q = Check(std::move(p).unwrap_ok());
+    if (q.is_err()) {
+        return make::Err(std::move(q).unwrap_err());
+    }
+    return Check(std::move(q).unwrap_ok());
+}
+
+template <typename P>
+void BM_Propagate_Coro(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = ViaCoro<P>(v);
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+template <typename P>
+void BM_Propagate_CoroAllocator(benchmark::State& state) {
+    // Frames are freed before the next call starts, so a tiny pool is enough
+    std::pmr::unsynchronized_pool_resource pool;
+    std::pmr::polymorphic_allocator<> alloc(&pool);
+    Run(state, [&alloc](int v) {
+        auto res = ViaCoroAlloc<P>(std::allocator_arg, alloc, v);
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+template <typename P>
+void BM_Propagate_AndThen(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = ViaAndThen<P>(v);
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+template <typename P>
+void BM_Propagate_Manual(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = ViaManual<P>(v);
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+BENCHMARK_TEMPLATE(BM_Propagate_Coro, Small)->Apply(Ratios);
+BENCHMARK_TEMPLATE(BM_Propagate_CoroAllocator, Small)->Apply(Ratios);
+BENCHMARK_TEMPLATE(BM_Propagate_AndThen, Small)->Apply(Ratios);
+BENCHMARK_TEMPLATE(BM_Propagate_Manual, Small)->Apply(Ratios);
+
+BENCHMARK_TEMPLATE(BM_Propagate_Coro, Large)->Apply(Ratios);
+BENCHMARK_TEMPLATE(BM_Propagate_CoroAllocator, Large)->Apply(Ratios);
+BENCHMARK_TEMPLATE(BM_Propagate_AndThen, Large)->Apply(Ratios);
+BENCHMARK_TEMPLATE(BM_Propagate_Manual, Large)->Apply(Ratios);
+
+}  // namespace bench
@@ -0,0 +1,55 @@
+#include <eav/ErrorCode.hpp>
+
+#include <string>
+
+#include "Common.hpp"
+
+// Error-heavy paths (rate limiting): a reject as std::string vs as eav::ErrorCode, and the
+// success path for comparison
+
+namespace bench {
+
+enum class Reject { kOk, kRateLimited };
+
+}  // namespace bench
+
+template <>
+struct eav::ErrorCategoryTraits<bench::Reject> {
+    static constexpr std::string_view messages[] = {"ok", "rate limited"};
+    static constexpr ErrorCategory category{"reject", messages};
+};
+
+namespace bench {
+
+inline Result<int, std::string> AdmitString(int v) {
+    if (v < 0) {
+        return make::Err(std::string("rate limited: too many requests from this client"));
+    }
+    return make::Ok(int{v});
+}
+
+inline Result<int, ErrorCode> AdmitCode(int v) {
+    if (v < 0) {
+        return make::Err(ErrorCode(Reject::kRateLimited));
+    }
+    return make::Ok(int{v});
+}
+
+void BM_Reject_String(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = AdmitString(v);
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+void BM_Reject_ErrorCode(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = AdmitCode(v);
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+BENCHMARK(BM_Reject_String)->Apply(Ratios);
+BENCHMARK(BM_Reject_ErrorCode)->Apply(Ratios);
+
+}  // namespace bench
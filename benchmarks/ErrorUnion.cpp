@@ -0,0 +1,123 @@
+#include <string>
+
+#include "Common.hpp"
+
+// Three steps that fail with different error types: each error turned into a std::string so
+// that they chain (the usual workaround) vs the typed errors widened into an ErrorUnion by
+// AndThen (eager and fused), and Match recovering one alternative
+
+namespace bench {
+
+struct ParseFail {
+    int pos;
+};
+
+struct IoFail {
+    int fd;
+};
+
+struct NotFound {};
+
+inline Result<int, ParseFail> ParseTyped(int v) {
+    if (v < 0) {
+        return make::Err(ParseFail{v});
+    }
+    return make::Ok(int{v});
+}
+
+inline Result<long, IoFail> ReadTyped(int v) {
+    if (v == -2) {  // never: the failures are the parse's
+        return make::Err(IoFail{v});
+    }
+    return make::Ok(long{v} + 1);
+}
+
+inline Result<long, NotFound> FindTyped(long v) {
+    if (v == -3) {
+        return make::Err(NotFound{});
+    }
+    return make::Ok(long{v} * 2);
+}
+
+inline Result<int, std::string> ParseString(int v) {
+    if (v < 0) {
+        return make::Err("parse error at " + std::to_string(v));
+    }
+    return make::Ok(int{v});
+}
+
+inline Result<long, std::string> ReadString(int v) {
+    if (v == -2) {
+        return make::Err("i/o error on fd " + std::to_string(v));
+    }
+    return make::Ok(long{v} + 1);
+}
+
+inline Result<long, std::string> FindString(long v) {
+    if (v == -3) {
+        return make::Err(std::string("not found"));
+    }
+    return make::Ok(long{v} * 2);
+}
+
+void BM_MixedErrors_String(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = ParseString(v)
+            | combine::result::AndThen(&ReadString)
+            | combine::result::AndThen(&FindString);
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+void BM_MixedErrors_Union(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = ParseTyped(v)
+            | combine::result::AndThen(&ReadTyped)
+            | combine::result::AndThen(&FindTyped);
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+void BM_MixedErrors_UnionLazy(benchmark::State& state) {
+    // Lambdas: a function pointer kept in a stage is not always called directly
+    static constexpr auto pipeline = combine::result::AndThen([](int v) { return ReadTyped(v); })
+        | combine::result::AndThen([](long v) { return FindTyped(v); });
+    Run(state, [](int v) {
+        auto res = ParseTyped(v) | pipeline;
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+// Recovering the parse errors: comparing strings vs checking the tag
+void BM_MixedErrors_RecoverString(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = ParseString(v)
+            | combine::result::AndThen(&ReadString)
+            | combine::result::AndThen(&FindString)
+            | combine::result::OrElse([](std::string err) -> Result<long, std::string> {
+                  if (err.starts_with("parse error")) {
+                      return make::Ok(0L);
+                  }
+                  return make::Err(std::move(err));
+              });
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+void BM_MixedErrors_RecoverMatch(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = ParseTyped(v)
+            | combine::result::AndThen(&ReadTyped)
+            | combine::result::AndThen(&FindTyped)
+            | combine::result::Match([](ParseFail) -> Result<long, NotFound> { return make::Ok(0L); });
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+BENCHMARK(BM_MixedErrors_String)->Apply(Ratios);
+BENCHMARK(BM_MixedErrors_Union)->Apply(Ratios);
+BENCHMARK(BM_MixedErrors_UnionLazy)->Apply(Ratios);
+BENCHMARK(BM_MixedErrors_RecoverString)->Apply(Ratios);
+BENCHMARK(BM_MixedErrors_RecoverMatch)->Apply(Ratios);
+
+}  // namespace bench
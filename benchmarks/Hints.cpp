@@ -0,0 +1,96 @@
+#include "Common.hpp"
+
+#include <string>
+
+// Branch hints: the same chain (MapOk -> Filter -> AndThen -> MapErr -> MapErr), eager and
+// fused, with every BranchHint, at 99.9%, 50% and 1% success. Only the Filter rejects (the
+// failed inputs), so the ratio is the success rate of the whole chain. A std::string error
+// makes the error path heavy enough to be worth outlining.
+
+namespace bench {
+
+// Never fails: failures come from the Filter only
+template <typename P>
+Result<P, Error> Source(int v) {
+    return make::Ok(Payload<P>(v));
+}
+
+struct Positive {
+    template <typename P>
+    bool operator()(const P& p) const {
+        return p.v > 0;
+    }
+};
+
+struct Double {
+    template <typename P>
+    Result<P, Error> operator()(P p) const {
+        if (p.v < 0) {
+            return make::Err(Error{p.v});
+        }
+        p.v *= 2;
+        return make::Ok(std::move(p));
+    }
+};
+
+struct Failure {
+    std::string what;
+};
+
+struct Describe {
+    Failure operator()(Error e) const {
+        return Failure{"code " + std::to_string(e.code)};
+    }
+};
+
+struct Annotate {
+    Failure operator()(Failure f) const {
+        f.what += " (annotated)";
+        return f;
+    }
+};
+
+
+template <typename P, BranchHint H>
+void BM_Hint_Eager(benchmark::State& state) {
+    Run(
+        state,
+        [](int v) {
+            auto res = Source<P>(v)
+                | combine::result::MapOk<H>(Inc{})
+                | combine::result::Filter<H>(Positive{}, Error{0})
+                | combine::result::AndThen<H>(Double{})
+                | combine::result::MapErr<H>(Describe{})
+                | combine::result::MapErr<H>(Annotate{});
+            benchmark::DoNotOptimize(res);
+        },
+        1000);
+}
+
+template <typename P, BranchHint H>
+void BM_Hint_Fused(benchmark::State& state) {
+    const auto pipeline = combine::result::MapOk<H>(Inc{})
+        | combine::result::Filter<H>(Positive{}, Error{0})
+        | combine::result::AndThen<H>(Double{})
+        | combine::result::MapErr<H>(Describe{})
+        | combine::result::MapErr<H>(Annotate{});
+    Run(
+        state,
+        [&pipeline](int v) {
+            auto res = Source<P>(v) | pipeline;
+            benchmark::DoNotOptimize(res);
+        },
+        1000);
+}
+
+#define EAV_BENCH_HINTS(fn, P)                                                                  \
+    BENCHMARK_TEMPLATE(fn, P, BranchHint::kErrorsRare)->Apply(RatiosPerMille);   \
+    BENCHMARK_TEMPLATE(fn, P, BranchHint::kErrorsCommon)->Apply(RatiosPerMille); \
+    BENCHMARK_TEMPLATE(fn, P, BranchHint::kNone)->Apply(RatiosPerMille)
+
+EAV_BENCH_HINTS(BM_Hint_Eager, Small);
+EAV_BENCH_HINTS(BM_Hint_Fused, Small);
+EAV_BENCH_HINTS(BM_Hint_Eager, Large);
+EAV_BENCH_HINTS(BM_Hint_Fused, Large);
+
+}  // namespace bench
@@ -0,0 +1,82 @@
+#include "Common.hpp"
+
+// Construction: make::Ok / make::Err and the PendingType upgrade to a complete Result<T, E>
+
+namespace bench {
+
+template <typename P>
+void BM_MakeOk_Pending(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = make::Ok(Payload<P>(v));  // Result<P, ?>
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+template <typename P>
+void BM_MakeErr_Pending(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = make::Err(Error{v});  // Result<?, Error>
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+// make::Ok / make::Err + upgrade constructor
+template <typename P>
+void BM_Make_Eav(benchmark::State& state) {
+    Run(state, [](int v) {
+        Result<P, Error> res = EavResult<P>(v);
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+#if EAV_BENCH_HAS_EXPECTED
+template <typename P>
+void BM_Make_Expected(benchmark::State& state) {
+    Run(state, [](int v) {
+        std::expected<P, Error> res = StdExpected<P>(v);
+        benchmark::DoNotOptimize(res);
+    });
+}
+#endif
+
+// make::Some / make::None + upgrade constructor
+template <typename P>
+void BM_Make_EavOption(benchmark::State& state) {
+    Run(state, [](int v) {
+        Option<P> opt = EavOption<P>(v);
+        benchmark::DoNotOptimize(opt);
+    });
+}
+
+template <typename P>
+void BM_Make_Optional(benchmark::State& state) {
+    Run(state, [](int v) {
+        std::optional<P> opt = StdOptional<P>(v);
+        benchmark::DoNotOptimize(opt);
+    });
+}
+
+template <typename P>
+void BM_Make_Hand(benchmark::State& state) {
+    Run(state, [](int v) {
+        if (v >= 0) {
+            P val = Payload<P>(v);
+            benchmark::DoNotOptimize(val);
+        } else {
+            Error err{v};
+            benchmark::DoNotOptimize(err);
+        }
+    });
+}
+
+EAV_BENCH(BM_MakeOk_Pending);
+EAV_BENCH(BM_MakeErr_Pending);
+EAV_BENCH(BM_Make_Eav);
+#if EAV_BENCH_HAS_EXPECTED
+EAV_BENCH(BM_Make_Expected);
+#endif
+EAV_BENCH(BM_Make_EavOption);
+EAV_BENCH(BM_Make_Optional);
+EAV_BENCH(BM_Make_Hand);
+
+}  // namespace bench
@@ -0,0 +1,155 @@
+#include "Common.hpp"
+
+// Every Option combinator vs std::optional monadic ops vs hand-written if/else
+
+namespace bench {
+
+// --- Map ---
+
+template <typename P>
+void BM_Map_Eav(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto opt = EavOption<P>(v) | combine::option::Map(Inc{});
+        benchmark::DoNotOptimize(opt);
+    });
+}
+
+#if EAV_BENCH_HAS_OPTIONAL
+template <typename P>
+void BM_Map_Optional(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto opt = StdOptional<P>(v).transform(Inc{});
+        benchmark::DoNotOptimize(opt);
+    });
+}
+#endif
+
+template <typename P>
+void BM_Map_Hand(benchmark::State& state) {
+    Run(state, [](int v) {
+        if (v >= 0) {
+            P val = Inc{}(Payload<P>(v));
+            benchmark::DoNotOptimize(val);
+        }
+    });
+}
+
+// --- AndThen ---
+
+template <typename P>
+void BM_OptAndThen_Eav(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto opt = EavOption<P>(v) | combine::option::AndThen(StepSome{});
+        benchmark::DoNotOptimize(opt);
+    });
+}
+
+#if EAV_BENCH_HAS_OPTIONAL
+template <typename P>
+void BM_OptAndThen_Optional(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto opt = StdOptional<P>(v).and_then([](P&& p) -> std::optional<P> {
+            if (p.v % 7 == 0) {
+                return std::nullopt;
+            }
+            p.v += 1;
+            return std::move(p);
+        });
+        benchmark::DoNotOptimize(opt);
+    });
+}
+#endif
+
+template <typename P>
+void BM_OptAndThen_Hand(benchmark::State& state) {
+    Run(state, [](int v) {
+        if (v >= 0 && v % 7 != 0) {
+            P val = Payload<P>(v);
+            val.v += 1;
+            benchmark::DoNotOptimize(val);
+        }
+    });
+}
+
+// --- Filter ---
+
+template <typename P>
+void BM_OptFilter_Eav(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto opt = EavOption<P>(v) | combine::option::Filter(NotSeven{});
+        benchmark::DoNotOptimize(opt);
+    });
+}
+
+#if EAV_BENCH_HAS_OPTIONAL
+template <typename P>
+void BM_OptFilter_Optional(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto opt = StdOptional<P>(v).and_then([](P&& p) -> std::optional<P> {
+            if (NotSeven{}(p)) {
+                return std::move(p);
+            }
+            return std::nullopt;
+        });
+        benchmark::DoNotOptimize(opt);
+    });
+}
+#endif
+
+template <typename P>
+void BM_OptFilter_Hand(benchmark::State& state) {
+    Run(state, [](int v) {
+        if (v >= 0) {
+            P val = Payload<P>(v);
+            if (NotSeven{}(val)) {
+                benchmark::DoNotOptimize(val);
+            }
+        }
+    });
+}
+
+// --- OrElse ---
+
+template <typename P>
+void BM_OptOrElse_Eav(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto opt = EavOption<P>(v) | combine::option::OrElse(Fallback<P>{});
+        benchmark::DoNotOptimize(opt);
+    });
+}
+
+#if EAV_BENCH_HAS_OPTIONAL
+template <typename P>
+void BM_OptOrElse_Optional(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto opt = StdOptional<P>(v).or_else([]() -> std::optional<P> { return Payload<P>(0); });
+        benchmark::DoNotOptimize(opt);
+    });
+}
+#endif
+
+template <typename P>
+void BM_OptOrElse_Hand(benchmark::State& state) {
+    Run(state, [](int v) {
+        P val = Payload<P>(v >= 0 ? v : 0);
+        benchmark::DoNotOptimize(val);
+    });
+}
+
+EAV_BENCH(BM_Map_Eav);
+EAV_BENCH(BM_Map_Hand);
+EAV_BENCH(BM_OptAndThen_Eav);
+EAV_BENCH(BM_OptAndThen_Hand);
+EAV_BENCH(BM_OptFilter_Eav);
+EAV_BENCH(BM_OptFilter_Hand);
+EAV_BENCH(BM_OptOrElse_Eav);
+EAV_BENCH(BM_OptOrElse_Hand);
+
+#if EAV_BENCH_HAS_OPTIONAL
+EAV_BENCH(BM_Map_Optional);
+EAV_BENCH(BM_OptAndThen_Optional);
+EAV_BENCH(BM_OptFilter_Optional);
+EAV_BENCH(BM_OptOrElse_Optional);
+#endif
+
+}  // namespace bench
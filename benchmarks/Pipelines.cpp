@@ -0,0 +1,232 @@
+#include "Common.hpp"
+
+#include <utility>  // std::index_sequence
+
+// N-stage pipelines (MapOk -> Filter -> AndThen -> MapErr -> MapOk -> ...):
+// eager eav chain vs lazy (fused) eav pipeline vs std::expected chain vs hand-written if/else
+
+namespace bench {
+
+struct NonNegative {
+    template <typename P>
+    bool operator()(const P& p) const {
+        return p.v >= 0;
+    }
+};
+
+struct AddOneEav {
+    template <typename P>
+    Result<P, Error> operator()(P p) const {
+        p.v += 1;
+        return make::Ok(std::move(p));
+    }
+};
+
+// Payload that counts its moves and copies (reported as counters)
+struct Counted {
+    static inline std::int64_t moves = 0;
+    static inline std::int64_t copies = 0;
+
+    int v = 0;
+
+    Counted() = default;
+
+    Counted(const Counted& oth) : v(oth.v) {
+        ++copies;
+    }
+
+    Counted(Counted&& oth) noexcept : v(oth.v) {
+        ++moves;
+    }
+
+    Counted& operator=(const Counted& oth) {
+        v = oth.v;
+        ++copies;
+        return *this;
+    }
+
+    Counted& operator=(Counted&& oth) noexcept {
+        v = oth.v;
+        ++moves;
+        return *this;
+    }
+};
+
+// --- eav ---
+
+template <std::size_t I>
+auto Stage() {
+    if constexpr (I % 4 == 0) {
+        return combine::result::MapOk(Inc{});
+    } else if constexpr (I % 4 == 1) {
+        return combine::result::Filter(NonNegative{}, Error{1});
+    } else if constexpr (I % 4 == 2) {
+        return combine::result::AndThen(AddOneEav{});
+    } else {
+        return combine::result::MapErr(Bump{});
+    }
+}
+
+template <std::size_t I, std::size_t N, typename R>
+auto Eager(R&& res) {
+    if constexpr (I == N) {
+        return std::move(res);
+    } else {
+        return Eager<I + 1, N>(std::move(res) | Stage<I>());
+    }
+}
+
+template <std::size_t... I>
+auto MakeLazy(std::index_sequence<I...>) {
+    return (Stage<I>() | ...);
+}
+
+template <std::size_t N>
+const auto& Lazy() {
+    static const auto pipeline = MakeLazy(std::make_index_sequence<N>{});
+    return pipeline;
+}
+
+template <typename P, std::size_t N>
+void BM_Pipeline_Eager(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = Eager<0, N>(EavResult<P>(v));
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+template <typename P, std::size_t N>
+void BM_Pipeline_Lazy(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = EavResult<P>(v) | Lazy<N>();
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+// --- std::expected ---
+
+#if EAV_BENCH_HAS_EXPECTED
+struct NonNegativeStd {
+    template <typename P>
+    std::expected<P, Error> operator()(P p) const {
+        if (NonNegative{}(p)) {
+            return p;
+        }
+        return std::unexpected(Error{1});
+    }
+};
+
+struct AddOneStd {
+    template <typename P>
+    std::expected<P, Error> operator()(P p) const {
+        p.v += 1;
+        return p;
+    }
+};
+
+template <std::size_t I, std::size_t N, typename X>
+auto ExpectedChain(X&& exp) {
+    if constexpr (I == N) {
+        return std::move(exp);
+    } else if constexpr (I % 4 == 0) {
+        return ExpectedChain<I + 1, N>(std::move(exp).transform(Inc{}));
+    } else if constexpr (I % 4 == 1) {
+        return ExpectedChain<I + 1, N>(std::move(exp).and_then(NonNegativeStd{}));
+    } else if constexpr (I % 4 == 2) {
+        return ExpectedChain<I + 1, N>(std::move(exp).and_then(AddOneStd{}));
+    } else {
+        return ExpectedChain<I + 1, N>(std::move(exp).transform_error(Bump{}));
+    }
+}
+
+template <typename P, std::size_t N>
+void BM_Pipeline_Expected(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = ExpectedChain<0, N>(StdExpected<P>(v));
+        benchmark::DoNotOptimize(res);
+    });
+}
+#endif
+
+// --- hand-written ---
+
+template <std::size_t I, std::size_t N, typename P>
+bool HandChain(P& val, Error& err, bool ok) {
+    if constexpr (I == N) {
+        return ok;
+    } else {
+        if constexpr (I % 4 == 0) {
+            if (ok) val = Inc{}(std::move(val));
+        } else if constexpr (I % 4 == 1) {
+            if (ok && !NonNegative{}(val)) {
+                ok = false;
+                err = Error{1};
+            }
+        } else if constexpr (I % 4 == 2) {
+            if (ok) val.v += 1;
+        } else {
+            if (!ok) err = Bump{}(err);
+        }
+        return HandChain<I + 1, N>(val, err, ok);
+    }
+}
+
+template <typename P, std::size_t N>
+void BM_Pipeline_Hand(benchmark::State& state) {
+    Run(state, [](int v) {
+        P val = Payload<P>(v >= 0 ? v : 0);
+        Error err{v};
+        bool ok = HandChain<0, N>(val, err, v >= 0);
+        benchmark::DoNotOptimize(ok);
+        benchmark::DoNotOptimize(val);
+        benchmark::DoNotOptimize(err);
+    });
+}
+
+// --- payload moves per item: eager vs lazy ---
+
+template <typename F>
+void RunCounted(benchmark::State& state, F&& body) {
+    Counted::moves = 0;
+    Counted::copies = 0;
+    Run(state, std::forward<F>(body));
+    const double items = static_cast<double>(state.iterations() * kBatch);
+    state.counters["moves/item"] = static_cast<double>(Counted::moves) / items;
+    state.counters["copies/item"] = static_cast<double>(Counted::copies) / items;
+}
+
+template <std::size_t N>
+void BM_PipelineMoves_Eager(benchmark::State& state) {
+    RunCounted(state, [](int v) {
+        auto res = Eager<0, N>(EavResult<Counted>(v));
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+template <std::size_t N>
+void BM_PipelineMoves_Lazy(benchmark::State& state) {
+    RunCounted(state, [](int v) {
+        auto res = EavResult<Counted>(v) | Lazy<N>();
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+#define EAV_BENCH_PIPELINE(fn)                                        \
+    BENCHMARK_TEMPLATE(fn, ::bench::Small, 5)->Apply(::bench::Ratios);  \
+    BENCHMARK_TEMPLATE(fn, ::bench::Small, 20)->Apply(::bench::Ratios); \
+    BENCHMARK_TEMPLATE(fn, ::bench::Large, 5)->Apply(::bench::Ratios);  \
+    BENCHMARK_TEMPLATE(fn, ::bench::Large, 20)->Apply(::bench::Ratios)
+
+EAV_BENCH_PIPELINE(BM_Pipeline_Eager);
+EAV_BENCH_PIPELINE(BM_Pipeline_Lazy);
+#if EAV_BENCH_HAS_EXPECTED
+EAV_BENCH_PIPELINE(BM_Pipeline_Expected);
+#endif
+EAV_BENCH_PIPELINE(BM_Pipeline_Hand);
+
+BENCHMARK_TEMPLATE(BM_PipelineMoves_Eager, 5)->Apply(Ratios);
+BENCHMARK_TEMPLATE(BM_PipelineMoves_Lazy, 5)->Apply(Ratios);
+BENCHMARK_TEMPLATE(BM_PipelineMoves_Eager, 20)->Apply(Ratios);
+BENCHMARK_TEMPLATE(BM_PipelineMoves_Lazy, 20)->Apply(Ratios);
+
+}  // namespace bench
@@ -0,0 +1,120 @@
+#include <memory>
+#include <string>
+
+#include <eav/Traits/Relocatable.hpp>
+
+#include "Common.hpp"
+
+// Container growth: trivially copyable Option/Result are moved by the vector as raw bytes,
+// a non-trivial payload forces an element-wise move + destroy on every reallocation.
+// RelocateN additionally lets a container memcpy opted-in payloads (unique_ptr, ...).
+
+namespace bench {
+
+// int with user-provided special members: what Option<int> used to look like to the vector
+struct Boxed {
+    int v;
+
+    Boxed(int val) : v(val) {}
+    Boxed(const Boxed& oth) : v(oth.v) {}
+    Boxed(Boxed&& oth) noexcept : v(oth.v) {}
+    Boxed& operator=(const Boxed& oth) {
+        v = oth.v;
+        return *this;
+    }
+    ~Boxed() {}
+};
+
+// Minimal growable buffer that relocates through RelocateN
+template <typename T>
+class GrowBuffer {
+  private:  // data members:
+    std::allocator<T> alloc_;
+    T* data_ = nullptr;
+    std::size_t size_ = 0;
+    std::size_t cap_ = 0;
+
+  public:  // member functions:
+    GrowBuffer() = default;
+    GrowBuffer(const GrowBuffer&) = delete;
+
+    ~GrowBuffer() {
+        std::destroy_n(data_, size_);
+        if (data_ != nullptr) {
+            alloc_.deallocate(data_, cap_);
+        }
+    }
+
+    void push_back(T&& val) {
+        if (size_ == cap_) {
+            std::size_t new_cap = cap_ == 0 ? 1 : 2 * cap_;
+            T* new_data = alloc_.allocate(new_cap);
+            RelocateN(data_, size_, new_data);
+            if (data_ != nullptr) {
+                alloc_.deallocate(data_, cap_);
+            }
+            data_ = new_data;
+            cap_ = new_cap;
+        }
+        std::construct_at(data_ + size_, std::move(val));
+        ++size_;
+    }
+
+    T* data() {
+        return data_;
+    }
+};
+
+template <typename T>
+T Element(int i) {
+    if constexpr (std::same_as<T, Option<int>>) {
+        return make::Some(i);
+    } else if constexpr (std::same_as<T, Option<Boxed>>) {
+        return make::Some(Boxed(i));
+    } else if constexpr (std::same_as<T, Result<int, Error>>) {
+        return make::Ok(int{i});
+    } else if constexpr (std::same_as<T, Result<Boxed, Error>>) {
+        return make::Ok(Boxed(i));
+    } else if constexpr (std::same_as<T, Result<std::unique_ptr<int>, Error>>) {
+        return make::Ok(std::unique_ptr<int>(nullptr));
+    } else {
+        return make::Err(Error{i});  // Result<std::string, Error>: no allocation
+    }
+}
+
+// push_back without reserve(): log2(n) reallocations
+template <typename Container, typename T>
+void BM_Growth(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        Container c;
+        for (int i = 0; i < n; ++i) {
+            c.push_back(Element<T>(i));
+        }
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+inline void Sizes(benchmark::internal::Benchmark* b) {
+    b->ArgName("n")->Arg(1 << 10)->Arg(1 << 16);
+}
+
+#define EAV_BENCH_GROWTH(Container, ...)                                                 \
+    BENCHMARK(BM_Growth<Container<__VA_ARGS__>, __VA_ARGS__>)                            \
+        ->Name("BM_Growth<" #Container ", " #__VA_ARGS__ ">")                           \
+        ->Apply(Sizes)
+
+// trivially copyable vs non-trivial payload
+EAV_BENCH_GROWTH(std::vector, Option<int>);
+EAV_BENCH_GROWTH(std::vector, Option<Boxed>);
+EAV_BENCH_GROWTH(std::vector, Result<int, Error>);
+EAV_BENCH_GROWTH(std::vector, Result<Boxed, Error>);
+
+// element-wise move (std::vector) vs memcpy (RelocateN) of opted-in / non-relocatable payloads
+EAV_BENCH_GROWTH(std::vector, Result<std::unique_ptr<int>, Error>);
+EAV_BENCH_GROWTH(GrowBuffer, Result<std::unique_ptr<int>, Error>);
+EAV_BENCH_GROWTH(std::vector, Result<std::string, Error>);
+EAV_BENCH_GROWTH(GrowBuffer, Result<std::string, Error>);
+
+}  // namespace bench
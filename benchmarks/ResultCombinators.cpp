@@ -0,0 +1,194 @@
+#include "Common.hpp"
+
+// Every Result combinator vs std::expected monadic ops vs hand-written if/else
+
+namespace bench {
+
+// --- MapOk ---
+
+template <typename P>
+void BM_MapOk_Eav(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = EavResult<P>(v) | combine::result::MapOk(Inc{});
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+#if EAV_BENCH_HAS_EXPECTED
+template <typename P>
+void BM_MapOk_Expected(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = StdExpected<P>(v).transform(Inc{});
+        benchmark::DoNotOptimize(res);
+    });
+}
+#endif
+
+template <typename P>
+void BM_MapOk_Hand(benchmark::State& state) {
+    Run(state, [](int v) {
+        if (v >= 0) {
+            P val = Inc{}(Payload<P>(v));
+            benchmark::DoNotOptimize(val);
+        } else {
+            Error err{v};
+            benchmark::DoNotOptimize(err);
+        }
+    });
+}
+
+// --- AndThen ---
+
+template <typename P>
+void BM_AndThen_Eav(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = EavResult<P>(v) | combine::result::AndThen(StepEav{});
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+#if EAV_BENCH_HAS_EXPECTED
+template <typename P>
+void BM_AndThen_Expected(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = StdExpected<P>(v).and_then(StepStd{});
+        benchmark::DoNotOptimize(res);
+    });
+}
+#endif
+
+template <typename P>
+void BM_AndThen_Hand(benchmark::State& state) {
+    Run(state, [](int v) {
+        if (v >= 0 && v % 7 != 0) {
+            P val = Payload<P>(v);
+            val.v += 1;
+            benchmark::DoNotOptimize(val);
+        } else {
+            Error err{v >= 0 ? 7 : v};
+            benchmark::DoNotOptimize(err);
+        }
+    });
+}
+
+// --- Filter ---
+
+template <typename P>
+void BM_Filter_Eav(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = EavResult<P>(v) | combine::result::Filter(NotSeven{}, Error{7});
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+#if EAV_BENCH_HAS_EXPECTED
+template <typename P>
+void BM_Filter_Expected(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = StdExpected<P>(v).and_then([](P&& p) -> std::expected<P, Error> {
+            if (NotSeven{}(p)) {
+                return std::move(p);
+            }
+            return std::unexpected(Error{7});
+        });
+        benchmark::DoNotOptimize(res);
+    });
+}
+#endif
+
+template <typename P>
+void BM_Filter_Hand(benchmark::State& state) {
+    Run(state, [](int v) {
+        if (v >= 0) {
+            P val = Payload<P>(v);
+            if (NotSeven{}(val)) {
+                benchmark::DoNotOptimize(val);
+                return;
+            }
+        }
+        Error err{7};
+        benchmark::DoNotOptimize(err);
+    });
+}
+
+// --- MapErr ---
+
+template <typename P>
+void BM_MapErr_Eav(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = EavResult<P>(v) | combine::result::MapErr(Bump{});
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+#if EAV_BENCH_HAS_EXPECTED
+template <typename P>
+void BM_MapErr_Expected(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = StdExpected<P>(v).transform_error(Bump{});
+        benchmark::DoNotOptimize(res);
+    });
+}
+#endif
+
+template <typename P>
+void BM_MapErr_Hand(benchmark::State& state) {
+    Run(state, [](int v) {
+        if (v >= 0) {
+            P val = Payload<P>(v);
+            benchmark::DoNotOptimize(val);
+        } else {
+            Error err = Bump{}(Error{v});
+            benchmark::DoNotOptimize(err);
+        }
+    });
+}
+
+// --- OrElse ---
+
+template <typename P>
+void BM_OrElse_Eav(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = EavResult<P>(v) | combine::result::OrElse(RecoverEav<P>{});
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+#if EAV_BENCH_HAS_EXPECTED
+template <typename P>
+void BM_OrElse_Expected(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = StdExpected<P>(v).or_else(RecoverStd<P>{});
+        benchmark::DoNotOptimize(res);
+    });
+}
+#endif
+
+template <typename P>
+void BM_OrElse_Hand(benchmark::State& state) {
+    Run(state, [](int v) {
+        P val = Payload<P>(v >= 0 ? v : 0);
+        benchmark::DoNotOptimize(val);
+    });
+}
+
+EAV_BENCH(BM_MapOk_Eav);
+EAV_BENCH(BM_MapOk_Hand);
+EAV_BENCH(BM_AndThen_Eav);
+EAV_BENCH(BM_AndThen_Hand);
+EAV_BENCH(BM_Filter_Eav);
+EAV_BENCH(BM_Filter_Hand);
+EAV_BENCH(BM_MapErr_Eav);
+EAV_BENCH(BM_MapErr_Hand);
+EAV_BENCH(BM_OrElse_Eav);
+EAV_BENCH(BM_OrElse_Hand);
+
+#if EAV_BENCH_HAS_EXPECTED
+EAV_BENCH(BM_MapOk_Expected);
+EAV_BENCH(BM_AndThen_Expected);
+EAV_BENCH(BM_Filter_Expected);
+EAV_BENCH(BM_MapErr_Expected);
+EAV_BENCH(BM_OrElse_Expected);
+#endif
+
+}  // namespace bench
@@ -0,0 +1,47 @@
+#include <eav/Traced.hpp>
+
+#include "Common.hpp"
+
+// Cost of Traced<E> errors: no trace, a frame-pointer walk on every error, 1-in-64 sampling
+// and first-per-site sampling, against a plain error (error-heavy and success-heavy inputs)
+
+namespace bench {
+
+EAV_NOINLINE Result<int, Error> PlainErr(int v) {
+    if (v < 0) {
+        return make::Err(Error{v});
+    }
+    return make::Ok(int{v});
+}
+
+EAV_NOINLINE Result<int, Traced<Error>> TracedErr(int v) {
+    if (v < 0) {
+        return make::Err(Traced(Error{v}));
+    }
+    return make::Ok(int{v});
+}
+
+void BM_Traced_Plain(benchmark::State& state) {
+    Run(state, [](int v) {
+        auto res = PlainErr(v);
+        benchmark::DoNotOptimize(res);
+    });
+}
+
+template <TraceSampling Mode, std::uint32_t N = 1>
+void BM_Traced(benchmark::State& state) {
+    SetTraceSampling(Mode, N);
+    Run(state, [](int v) {
+        auto res = TracedErr(v);
+        benchmark::DoNotOptimize(res);
+    });
+    SetTraceSampling(TraceSampling::kAlways);
+}
+
+BENCHMARK(BM_Traced_Plain)->Apply(Ratios);
+BENCHMARK_TEMPLATE(BM_Traced, TraceSampling::kNever)->Apply(Ratios);
+BENCHMARK_TEMPLATE(BM_Traced, TraceSampling::kAlways)->Apply(Ratios);
+BENCHMARK_TEMPLATE(BM_Traced, TraceSampling::kEveryN, 64)->Apply(Ratios);
+BENCHMARK_TEMPLATE(BM_Traced, TraceSampling::kFirstPerSite)->Apply(Ratios);
+
+}  // namespace bench
@@ -0,0 +1,67 @@
+#include <eav/Traverse.hpp>
+
+#include "Common.hpp"
+
+// Parallel Traverse scaling: a CPU-bound validator over 64K records, sequential vs pools of
+// 1..N threads (real time; the caller thread works too, so a pool of k runs k + 1 threads)
+
+namespace bench {
+
+inline constexpr std::size_t kRecords = 1 << 16;
+
+// ~1 us of integer work per record; rejects nothing, so the whole input is always processed
+inline Result<std::uint64_t, Error> Validate(std::uint64_t record) {
+    std::uint64_t h = record;
+    for (int round = 0; round < 512; ++round) {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+    }
+    if (h == 0) {
+        return make::Err(Error{-1});
+    }
+    return make::Ok(std::uint64_t{h});
+}
+
+inline std::vector<std::uint64_t> Records() {
+    std::vector<std::uint64_t> records(kRecords);
+    for (std::size_t i = 0; i < kRecords; ++i) records[i] = i + 1;
+    return records;
+}
+
+void BM_Traverse_Seq(benchmark::State& state) {
+    const auto records = Records();
+    for (auto _ : state) {
+        auto res = combine::result::Traverse(exec::seq, records, Validate);
+        benchmark::DoNotOptimize(res);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kRecords));
+}
+
+void BM_Traverse_Par(benchmark::State& state) {
+    const auto records = Records();
+    exec::ThreadPool pool(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto res = combine::result::Traverse(exec::par.on(pool), records, Validate);
+        benchmark::DoNotOptimize(res);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kRecords));
+}
+
+// Early cancellation: the first record fails, the rest should not be validated
+void BM_Traverse_ParFailFast(benchmark::State& state) {
+    auto records = Records();
+    records[0] = 0;
+    exec::ThreadPool pool(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto res = combine::result::Traverse(exec::par.on(pool), records, [](std::uint64_t r) {
+            return r == 0 ? Result<std::uint64_t, Error>(make::Err(Error{0})) : Validate(r);
+        });
+        benchmark::DoNotOptimize(res);
+    }
+}
+
+BENCHMARK(BM_Traverse_Seq)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Traverse_Par)->ArgName("threads")->RangeMultiplier(2)->Range(1, 64)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Traverse_ParFailFast)->ArgName("threads")->Arg(4)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+}  // namespace bench
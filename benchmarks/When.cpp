@@ -0,0 +1,125 @@
+#include <future>
+
+#include <eav/Async.hpp>
+
+#include "Common.hpp"
+
+// Fan-out over 4 shard queries of ~2 us of work each (real time): WhenAll/WhenAny on a pool of 3
+// threads (+ the caller) vs a sequential AndThen/OrElse chain vs hand-rolled std::async.
+// The argument is the shard that fails (WhenAll) or the only one that hits (WhenAny); 4: none.
+
+namespace bench {
+
+inline constexpr int kShards = 4;
+
+inline Result<std::uint64_t, Error> Query(int shard, int bad) {
+    std::uint64_t h = static_cast<std::uint64_t>(shard) + 1;
+    for (int round = 0; round < 1024; ++round) {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+    }
+    if (shard == bad) {
+        return make::Err(Error{shard});
+    }
+    return make::Ok(std::uint64_t{h});
+}
+
+// WhenAny: only shard `hit` has the key
+inline Result<std::uint64_t, Error> Probe(int shard, int hit) {
+    auto res = Query(shard, -1);
+    if (shard != hit) {
+        return make::Err(Error{shard});
+    }
+    return res;
+}
+
+void BM_WhenAll_Eav(benchmark::State& state) {
+    exec::ThreadPool pool(kShards - 1);
+    const int bad = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        auto res = combine::result::WhenAll(
+            pool, [=] { return Query(0, bad); }, [=] { return Query(1, bad); }, [=] { return Query(2, bad); },
+            [=] { return Query(3, bad); });
+        benchmark::DoNotOptimize(res);
+    }
+}
+
+void BM_WhenAll_Sequential(benchmark::State& state) {
+    const int bad = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        auto res = Query(0, bad)
+            | combine::result::AndThen([&](std::uint64_t v) { sum += v; return Query(1, bad); })
+            | combine::result::AndThen([&](std::uint64_t v) { sum += v; return Query(2, bad); })
+            | combine::result::AndThen([&](std::uint64_t v) { sum += v; return Query(3, bad); });
+        benchmark::DoNotOptimize(res);
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+void BM_WhenAll_StdAsync(benchmark::State& state) {
+    const int bad = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        std::array<std::future<Result<std::uint64_t, Error>>, kShards> futures;
+        for (int shard = 0; shard < kShards; ++shard) {
+            futures[shard] = std::async(std::launch::async, [=] { return Query(shard, bad); });
+        }
+        bool ok = true;
+        for (auto& f : futures) {
+            auto res = f.get();
+            ok = ok && res.is_ok();
+            benchmark::DoNotOptimize(res);
+        }
+        benchmark::DoNotOptimize(ok);
+    }
+}
+
+void BM_WhenAny_Eav(benchmark::State& state) {
+    exec::ThreadPool pool(kShards - 1);
+    const int hit = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        auto res = combine::result::WhenAny(
+            pool, [=] { return Probe(0, hit); }, [=] { return Probe(1, hit); }, [=] { return Probe(2, hit); },
+            [=] { return Probe(3, hit); });
+        benchmark::DoNotOptimize(res);
+    }
+}
+
+void BM_WhenAny_Sequential(benchmark::State& state) {
+    const int hit = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        auto res = Probe(0, hit)
+            | combine::result::OrElse([=](Error) { return Probe(1, hit); })
+            | combine::result::OrElse([=](Error) { return Probe(2, hit); })
+            | combine::result::OrElse([=](Error) { return Probe(3, hit); });
+        benchmark::DoNotOptimize(res);
+    }
+}
+
+void BM_WhenAny_StdAsync(benchmark::State& state) {
+    const int hit = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        std::array<std::future<Result<std::uint64_t, Error>>, kShards> futures;
+        for (int shard = 0; shard < kShards; ++shard) {
+            futures[shard] = std::async(std::launch::async, [=] { return Probe(shard, hit); });
+        }
+        // No cancellation: every future is waited for
+        Option<std::uint64_t> found = make::None();
+        for (auto& f : futures) {
+            auto res = f.get();
+            if (res.is_ok() && !found.has_value()) {
+                found.emplace(res.unwrap_ok());
+            }
+        }
+        benchmark::DoNotOptimize(found);
+    }
+}
+
+BENCHMARK(BM_WhenAll_Eav)->ArgName("bad")->Arg(4)->Arg(0)->UseRealTime();
+BENCHMARK(BM_WhenAll_Sequential)->ArgName("bad")->Arg(4)->Arg(0)->UseRealTime();
+BENCHMARK(BM_WhenAll_StdAsync)->ArgName("bad")->Arg(4)->Arg(0)->UseRealTime();
+BENCHMARK(BM_WhenAny_Eav)->ArgName("hit")->Arg(0)->Arg(3)->UseRealTime();
+BENCHMARK(BM_WhenAny_Sequential)->ArgName("hit")->Arg(0)->Arg(3)->UseRealTime();
+BENCHMARK(BM_WhenAny_StdAsync)->ArgName("hit")->Arg(0)->Arg(3)->UseRealTime();
+
+}  // namespace bench
@@ -0,0 +1,6 @@
+#pragma once
+
+// Option/Result-returning lookups and parsing that refer to what they find instead of copying
+// it; kept out of Option.hpp and Result.hpp because it pulls in <ranges> and <charconv>
+#include "Adapters/Lookup.hpp"
+#include "Adapters/Parse.hpp"
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <algorithm>   // std::ranges::find_if
+#include <cstddef>     // std::size_t
+#include <functional>  // std::identity
+#include <iterator>    // std::indirect_unary_predicate, std::projected
+#include <ranges>
+#include <type_traits>
+#include <utility>     // std::declval, std::move
+
+#include "../Option.hpp"
+
+namespace eav::detail {
+
+// `map.find(key)->second` as an lvalue reference
+template <typename Map, typename Key>
+using MappedRef = decltype((std::declval<Map&>().find(std::declval<const Key&>())->second));
+
+}  // namespace eav::detail
+
+namespace eav::adapt {
+
+// Lookups that refer to the element they find: Option<T&> is a pointer (None is null), the
+// element is never copied and nothing throws. The container must outlive the Option, so
+// temporaries are rejected.
+
+// Get(map, key) => Option<mapped_type&> (const mapped_type& for a const map); any container
+// with find(key) and iterators to pairs: std::map, std::unordered_map, their multi- and
+// heterogeneous-lookup variants
+template <typename Map, typename Key>
+requires requires(Map& map, const Key& key) {
+    { map.find(key)->second };
+    { map.find(key) == map.end() } -> std::convertible_to<bool>;
+}
+constexpr Option<detail::MappedRef<Map, Key>> Get(Map& map, const Key& key) {
+    auto it = map.find(key);
+    if (it == map.end()) {
+        return make::None();
+    }
+    return make::SomeRef(it->second);
+}
+
+template <typename Map, typename Key>
+void Get(const Map&&, const Key&) = delete;
+
+// A range whose elements can be handed out by reference (not vector<bool>), and that stays
+// alive after the call: an lvalue or a view such as std::span
+template <typename R>
+concept RefRange = std::ranges::borrowed_range<R> &&
+                   std::is_lvalue_reference_v<std::ranges::range_reference_t<R>>;
+
+// At(range, i) => Option<T&>, None if i is out of bounds
+template <std::ranges::random_access_range R> requires RefRange<R> && std::ranges::sized_range<R>
+constexpr Option<std::ranges::range_reference_t<R>> At(R&& range, std::size_t index) {
+    if (index >= static_cast<std::size_t>(std::ranges::size(range))) {
+        return make::None();
+    }
+    return make::SomeRef(std::ranges::begin(range)[static_cast<std::ranges::range_difference_t<R>>(index)]);
+}
+
+// FindIf(range, pred[, proj]) => Option<T&>: the first element satisfying `pred`
+template <std::ranges::input_range R, typename Proj = std::identity,
+          std::indirect_unary_predicate<std::projected<std::ranges::iterator_t<R>, Proj>> Pred>
+requires RefRange<R>
+constexpr Option<std::ranges::range_reference_t<R>> FindIf(R&& range, Pred pred, Proj proj = {}) {
+    auto it = std::ranges::find_if(range, std::move(pred), std::move(proj));
+    if (it == std::ranges::end(range)) {
+        return make::None();
+    }
+    return make::SomeRef(*it);
+}
+
+}  // namespace eav::adapt
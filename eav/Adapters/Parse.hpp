@@ -0,0 +1,79 @@
+#pragma once
+
+#include <charconv>  // std::from_chars, std::chars_format
+#include <concepts>
+#include <cstdint>
+#include <string_view>
+#include <system_error>  // std::errc
+
+#include "../Detail/Instrument.hpp"
+#include "../Result.hpp"
+#include "../Traits/ErrorCategory.hpp"
+
+namespace eav::adapt {
+
+// Why Parse failed: one byte, so Result<int, ParseError> is 8 bytes. The codes follow what
+// std::from_chars reports, plus input left over after the number
+enum class ParseError : std::uint8_t {
+    kInvalidArgument,     // no number at the start (std::errc::invalid_argument)
+    kOutOfRange,          // does not fit in T (std::errc::result_out_of_range)
+    kTrailingCharacters,  // a number followed by something else
+};
+
+}  // namespace eav::adapt
+
+// ParseError converts to ErrorCode (see eav/ErrorCode.hpp)
+template <>
+struct eav::ErrorCategoryTraits<eav::adapt::ParseError> {
+    static constexpr std::string_view messages[] = {"invalid argument", "out of range", "trailing characters"};
+    static constexpr ErrorCategory category{"parse", messages};
+};
+
+namespace eav::detail {
+
+template <typename T>
+constexpr Result<T, adapt::ParseError> FromChars(std::string_view text, std::from_chars_result res, T value) {
+    using Out = Access<Result<T, adapt::ParseError>>;
+    if (res.ec == std::errc::invalid_argument) {
+        return Out::Err(adapt::ParseError::kInvalidArgument);
+    }
+    if (res.ec == std::errc::result_out_of_range) {
+        return Out::Err(adapt::ParseError::kOutOfRange);
+    }
+    if (res.ptr != text.data() + text.size()) {
+        return Out::Err(adapt::ParseError::kTrailingCharacters);
+    }
+    return Out::Ok(value);
+}
+
+}  // namespace eav::detail
+
+namespace eav::adapt {
+
+// Parse<T>(text) => Result<T, ParseError>: the whole of `text` is one number, as read by
+// std::from_chars (no whitespace, no leading '+', no "0x" prefix, locale-independent); no
+// allocation and no exceptions.
+//     auto port = adapt::Parse<std::uint16_t>(arg) | combine::result::MapErr(IntoErrorCode{});
+template <std::integral T> requires(!std::same_as<T, bool>)
+Result<T, ParseError> Parse(std::string_view text, int base = 10 EAV_SITE_PARAM) {
+    T value{};
+    const std::from_chars_result read = std::from_chars(text.data(), text.data() + text.size(), value, base);
+    auto res = detail::FromChars(text, read, value);
+    if (res.is_err()) {
+        EAV_REPORT(ParseError, kMakeErr);
+    }
+    return res;
+}
+
+template <std::floating_point T>
+Result<T, ParseError> Parse(std::string_view text, std::chars_format fmt = std::chars_format::general EAV_SITE_PARAM) {
+    T value{};
+    const std::from_chars_result read = std::from_chars(text.data(), text.data() + text.size(), value, fmt);
+    auto res = detail::FromChars(text, read, value);
+    if (res.is_err()) {
+        EAV_REPORT(ParseError, kMakeErr);
+    }
+    return res;
+}
+
+}  // namespace eav::adapt
@@ -0,0 +1,10 @@
+#pragma once
+
+// AsyncResult and lazy asynchronous chains of Result combinators, WhenAll/WhenAny fan-out;
+// kept out of Result.hpp, which does not need <atomic> or the executors
+#include "Async/Result.hpp"
+#include "Exec/Executor.hpp"
+#include "Exec/StopToken.hpp"
+#include "Exec/ThreadPool.hpp"
+#include "Result.hpp"
+#include "Result/Combinators/When.hpp"
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+#include <utility>
+
+#include "../../Option/Core.hpp"
+#include "../../Option/Detail/Access.hpp"
+#include "../../Result/Core.hpp"
+
+namespace eav::detail {
+
+// Receives the completion of an AsyncState it subscribed to
+class AsyncWaiter {
+  public:  // member functions:
+    virtual void Resume() noexcept = 0;
+
+  protected:  // member functions:
+    ~AsyncWaiter() = default;
+};
+
+// Shared state behind an AsyncResult<T, E>, the only allocation of a started chain: the chain
+// itself (source and stages, see AsyncChain) derives from it. It has two owners, the producer
+// that completes it and the AsyncResult handle, and is freed by the last one to let go.
+// Completion is lock-free: a single atomic phase decides who goes on once both the value and
+// the consumer are there. If the consumer subscribed first the producer resumes it, otherwise
+// the consumer finds the value ready; a blocking wait() sleeps on the phase (std::atomic::wait).
+template <typename T, typename E>
+class AsyncState {
+  private:  // nested types:
+    enum Phase : unsigned char {
+        kPending,     // neither the value nor a waiter yet
+        kSubscribed,  // a waiter, no value
+        kDone,        // the value (the waiter, if any, has been resumed)
+    };
+
+  private:  // data members:
+    std::atomic<unsigned char> phase_{kPending};
+    std::atomic<unsigned char> owners_{2};
+    AsyncWaiter* waiter_ = nullptr;
+    Option<Result<T, E>> value_ = make::None();
+
+  public:  // member functions:
+    AsyncState() = default;
+    AsyncState(const AsyncState&) = delete;
+    AsyncState& operator=(const AsyncState&) = delete;
+    virtual ~AsyncState() = default;
+
+    // Producer side, once: stores the value, resumes the waiter or wakes wait(), lets go
+    void Complete(Result<T, E>&& res) noexcept {
+        value_.emplace(std::move(res));
+        if (phase_.exchange(kDone, std::memory_order_acq_rel) == kSubscribed) {
+            waiter_->Resume();
+        } else {
+            phase_.notify_all();
+        }
+        Release();
+    }
+
+    // Consumer side, at most once and not together with wait(): `waiter` is resumed when the
+    // value is there, right here if it already is, otherwise on the thread that completes
+    void Subscribe(AsyncWaiter& waiter) noexcept {
+        waiter_ = &waiter;
+        unsigned char expected = kPending;
+        if (!phase_.compare_exchange_strong(expected, kSubscribed, std::memory_order_acq_rel,
+                                            std::memory_order_acquire)) {
+            waiter.Resume();
+        }
+    }
+
+    bool is_ready() const noexcept {
+        return phase_.load(std::memory_order_acquire) == kDone;
+    }
+
+    void wait() const noexcept {
+        for (auto phase = phase_.load(std::memory_order_acquire); phase != kDone;
+             phase = phase_.load(std::memory_order_acquire)) {
+            phase_.wait(phase, std::memory_order_acquire);
+        }
+    }
+
+    // Precondition: is_ready()
+    Result<T, E> Take() {
+        return Access<Option<Result<T, E>>>::Take(std::move(value_));
+    }
+
+    void Release() noexcept {
+        if (owners_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete this;
+        }
+    }
+};
+
+}  // namespace eav::detail
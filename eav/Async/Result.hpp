@@ -0,0 +1,321 @@
+#pragma once
+
+#include <cstddef>  // std::size_t
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../Detail/Call.hpp"
+#include "../Detail/Pipeline.hpp"
+#include "../Exec/Executor.hpp"
+#include "../Result/Core.hpp"
+#include "../Result/Detail/Fuse.hpp"
+#include "Detail/State.hpp"
+
+// Asynchronous Results, lazy like the pipelines:
+//
+//     auto chain = async::Spawn(pool, [&] { return Fetch(key); })   // nothing runs yet
+//         | combine::result::MapOk(Decode)
+//         | combine::result::AndThen(Validate);
+//     AsyncResult<Config, Error> pending = std::move(chain).start();  // Fetch posted to the pool
+//     ...
+//     Result<Config, Error> config = std::move(pending).get();        // blocks until done
+//
+// A LazyResult is a description: a source (Spawn, Ready, or an AsyncResult to wait for) and
+// the combinators piped after it, kept by value as in a lazy pipeline. start() allocates one
+// shared state holding the whole chain and schedules the source; the stages then run fused
+// (see Result/Detail/Fuse.hpp) on the thread that produced the value, with no hop, lock or
+// allocation between them. Completion is lock-free (see Detail/State.hpp).
+// The functions of a chain must not throw: they run on executor threads.
+
+namespace eav {
+
+template <typename T, typename E>
+class AsyncResult;
+
+template <typename Source, typename... Stages>
+class LazyResult;
+
+namespace detail {
+
+template <typename R>
+inline constexpr bool kIsAsyncResult = false;
+
+template <typename T, typename E>
+inline constexpr bool kIsAsyncResult<AsyncResult<T, E>> = true;
+
+template <typename Source, typename... Stages>
+LazyResult<Source, Stages...> MakeLazy(Source&& source, std::tuple<Stages...>&& stages);
+
+// A Result<T, E> (not an Option)
+template <typename R>
+concept IsResultType = requires {
+    typename R::OkType;
+    typename R::ErrType;
+} && !std::is_void_v<typename R::ErrType>;
+
+// --- Sources: what starts a chain and produces its input ---
+//   Input              the Result the source produces
+//   Start(chain)       schedules it; the chain is an exec::Job and an AsyncWaiter
+//   Produce()          the input, once it is there
+
+// func() run on an executor
+template <typename X, typename F>
+class SpawnSource {
+  public:  // nested types:
+    using Input = std::remove_cvref_t<std::invoke_result_t<F&&>>;
+
+  private:  // data members:
+    X* executor_;
+    F func_;
+
+  public:  // member functions:
+    SpawnSource(X& executor, F&& func) : executor_(&executor), func_(std::move(func)) {}
+
+    template <typename Chain>
+    void Start(Chain& chain) {
+        executor_->Post(static_cast<exec::Job&>(chain));
+    }
+
+    Input Produce() {
+        return Call(std::move(func_));
+    }
+};
+
+// A value that is already there: the chain runs inside start()
+template <typename R>
+class ReadySource {
+  public:  // nested types:
+    using Input = R;
+
+  private:  // data members:
+    R value_;
+
+  public:  // member functions:
+    explicit ReadySource(R&& value) : value_(std::move(value)) {}
+
+    template <typename Chain>
+    void Start(Chain& chain) {
+        chain.Run();
+    }
+
+    Input Produce() {
+        return std::move(value_);
+    }
+};
+
+// The value of another AsyncResult: the chain subscribes to it and runs where it completes
+template <typename T, typename E>
+class AwaitSource {
+  public:  // nested types:
+    using Input = Result<T, E>;
+
+  private:  // data members:
+    AsyncState<T, E>* upstream_;
+
+  public:  // member functions:
+    explicit AwaitSource(AsyncState<T, E>* upstream) noexcept : upstream_(upstream) {}
+
+    AwaitSource(AwaitSource&& oth) noexcept : upstream_(std::exchange(oth.upstream_, nullptr)) {}
+    AwaitSource& operator=(AwaitSource&&) = delete;
+
+    ~AwaitSource() {
+        if (upstream_ != nullptr) {
+            upstream_->Release();
+        }
+    }
+
+    template <typename Chain>
+    void Start(Chain& chain) {
+        upstream_->Subscribe(static_cast<AsyncWaiter&>(chain));
+    }
+
+    Input Produce() {
+        Input res = upstream_->Take();
+        std::exchange(upstream_, nullptr)->Release();
+        return res;
+    }
+};
+
+// Output of a chain: the type of the equivalent eager pipeline on the input
+template <typename Source, typename... Stages>
+using AsyncOutput = typename FusedOutput<typename Source::Input, std::tuple<Stages...>>::Type;
+
+// The one allocation of a started chain: its shared state, source and stages
+template <typename Source, typename... Stages>
+class AsyncChain final
+    : public AsyncState<typename AsyncOutput<Source, Stages...>::OkType,
+                        typename AsyncOutput<Source, Stages...>::ErrType>,
+      public exec::Job,
+      public AsyncWaiter {
+  private:  // data members:
+    Source source_;
+    std::tuple<Stages...> stages_;
+
+  public:  // member functions:
+    AsyncChain(Source&& source, std::tuple<Stages...>&& stages)
+        : source_(std::move(source)), stages_(std::move(stages)) {}
+
+    void Start() {
+        source_.Start(*this);
+    }
+
+    // exec::Job: the source is produced here (SpawnSource, ReadySource)
+    void Run() noexcept override {
+        Finish();
+    }
+
+    // AsyncWaiter: the upstream value is there (AwaitSource)
+    void Resume() noexcept override {
+        Finish();
+    }
+
+  private:  // member functions:
+    void Finish() noexcept {
+        if constexpr (sizeof...(Stages) == 0) {
+            this->Complete(source_.Produce());
+        } else {
+            this->Complete(ResultStage::Run(stages_, source_.Produce()));
+        }
+    }
+};
+
+}  // namespace detail
+
+// Handle to a started chain (see LazyResult::start): move-only, the value is taken with get().
+// Dropping it without get() detaches the chain, which still runs to completion.
+template <typename T, typename E>
+class [[nodiscard]] AsyncResult {
+  public:  // nested types:
+    using ResultType = Result<T, E>;
+
+  private:  // data members:
+    detail::AsyncState<T, E>* state_;
+
+  public:  // member functions:
+    // Constructors and destructor:
+    AsyncResult(const AsyncResult&) = delete;
+    AsyncResult(AsyncResult&& oth) noexcept : state_(std::exchange(oth.state_, nullptr)) {}
+
+    ~AsyncResult() {
+        if (state_ != nullptr) {
+            state_->Release();
+        }
+    }
+
+    // Operators:
+    AsyncResult& operator=(const AsyncResult&) = delete;
+    AsyncResult& operator=(AsyncResult&& oth) noexcept {
+        if (this != &oth) {
+            if (state_ != nullptr) {
+                state_->Release();
+            }
+            state_ = std::exchange(oth.state_, nullptr);
+        }
+        return *this;
+    }
+
+    // Observers:
+    bool is_ready() const noexcept {
+        return state_->is_ready();
+    }
+
+    // Blocks until the value is there
+    void wait() const noexcept {
+        state_->wait();
+    }
+
+    // Accessors: the value, after waiting for it; the handle is empty afterwards
+    Result<T, E> get() && {
+        state_->wait();
+        Result<T, E> res = state_->Take();
+        std::exchange(state_, nullptr)->Release();
+        return res;
+    }
+
+  private:  // member functions:
+    explicit AsyncResult(detail::AsyncState<T, E>* state) noexcept : state_(state) {}
+
+    detail::AwaitSource<T, E> Detach() && noexcept {
+        return detail::AwaitSource<T, E>(std::exchange(state_, nullptr));
+    }
+
+  private:  // friends declaration:
+    template <typename Source, typename... Stages>
+    friend class LazyResult;
+
+    template <typename C>
+    friend auto operator|(AsyncResult&& async, C&& comb)
+    requires(detail::Composable<C> &&
+             std::same_as<typename std::remove_cvref_t<C>::StageKind, detail::ResultStage>) {
+        return LazyResult<detail::AwaitSource<T, E>>(std::move(async).Detach(), std::tuple<>{})
+            | std::forward<C>(comb);
+    }
+};
+
+// A chain that has not started: its source and the stages piped after it. Piping more
+// combinators (or lazy pipelines) extends it without running anything.
+template <typename Source, typename... Stages>
+class [[nodiscard]] LazyResult {
+  public:  // nested types:
+    using ResultType = detail::AsyncOutput<Source, Stages...>;
+
+  private:  // data members:
+    Source source_;
+    std::tuple<Stages...> stages_;
+
+  public:  // member functions:
+    LazyResult(Source&& source, std::tuple<Stages...>&& stages)
+        : source_(std::move(source)), stages_(std::move(stages)) {}
+
+    // Allocates the shared state and schedules the source
+    AsyncResult<typename ResultType::OkType, typename ResultType::ErrType> start() && {
+        auto* chain = new detail::AsyncChain<Source, Stages...>(std::move(source_), std::move(stages_));
+        AsyncResult<typename ResultType::OkType, typename ResultType::ErrType> handle(chain);
+        chain->Start();
+        return handle;
+    }
+
+    // start(), then waits for the value
+    ResultType get() && {
+        return std::move(*this).start().get();
+    }
+
+    template <typename C>
+    requires(detail::Composable<C> &&
+             std::same_as<typename std::remove_cvref_t<C>::StageKind, detail::ResultStage>)
+    friend auto operator|(LazyResult&& lazy, C&& comb) {
+        auto stages = std::tuple_cat(std::move(lazy.stages_), detail::AsStageTuple(std::forward<C>(comb)));
+        return detail::MakeLazy(std::move(lazy.source_), std::move(stages));
+    }
+};
+
+namespace detail {
+
+template <typename Source, typename... Stages>
+LazyResult<Source, Stages...> MakeLazy(Source&& source, std::tuple<Stages...>&& stages) {
+    return LazyResult<Source, Stages...>(std::move(source), std::move(stages));
+}
+
+}  // namespace detail
+
+namespace async {
+
+// func() -> Result<T, E>, run on `executor` when the chain is started
+template <exec::Executor X, typename F>
+requires detail::IsResultType<std::remove_cvref_t<std::invoke_result_t<std::decay_t<F>&&>>>
+auto Spawn(X& executor, F&& func) {
+    using Source = detail::SpawnSource<X, std::decay_t<F>>;
+    return LazyResult<Source>(Source(executor, std::decay_t<F>(std::forward<F>(func))), std::tuple<>{});
+}
+
+// A chain over a value that is already there (it runs inside start())
+template <typename T, typename E>
+auto Ready(Result<T, E>&& res) {
+    using Source = detail::ReadySource<Result<T, E>>;
+    return LazyResult<Source>(Source(std::move(res)), std::tuple<>{});
+}
+
+}  // namespace async
+
+}  // namespace eav
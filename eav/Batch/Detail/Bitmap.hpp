@@ -0,0 +1,120 @@
+#pragma once
+
+#include <bit>      // std::countr_zero, std::popcount
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint64_t
+#include <vector>
+
+namespace eav::detail {
+
+// Packed validity bitmap of a batch container: bit i set <=> row i holds a value (Ok / Some).
+// Bits past size() are always zero, so whole words can be tested and counted without masking.
+class Bitmap {
+  public:  // nested types:
+    using Word = std::uint64_t;
+    static constexpr std::size_t kWordBits = 64;
+
+  private:  // data members:
+    std::vector<Word> words_;
+    std::size_t size_ = 0;
+
+  public:  // member functions:
+    constexpr Bitmap() = default;
+
+    constexpr explicit Bitmap(std::size_t n, bool value = false) : words_(WordsFor(n), value ? ~Word{0} : 0), size_(n) {
+        ClearTail();
+    }
+
+    constexpr std::size_t size() const noexcept {
+        return size_;
+    }
+
+    constexpr bool test(std::size_t i) const noexcept {
+        return (words_[i / kWordBits] >> (i % kWordBits)) & 1u;
+    }
+
+    constexpr void set(std::size_t i) noexcept {
+        words_[i / kWordBits] |= Word{1} << (i % kWordBits);
+    }
+
+    constexpr void reset(std::size_t i) noexcept {
+        words_[i / kWordBits] &= ~(Word{1} << (i % kWordBits));
+    }
+
+    constexpr void push_back(bool value) {
+        if (size_ % kWordBits == 0) {
+            words_.push_back(0);
+        }
+        ++size_;
+        if (value) set(size_ - 1);
+    }
+
+    constexpr void reserve(std::size_t n) {
+        words_.reserve(WordsFor(n));
+    }
+
+    constexpr void clear() noexcept {
+        words_.clear();
+        size_ = 0;
+    }
+
+    constexpr std::size_t count() const noexcept {
+        std::size_t n = 0;
+        for (Word w : words_) n += static_cast<std::size_t>(std::popcount(w));
+        return n;
+    }
+
+    constexpr const std::vector<Word>& words() const noexcept {
+        return words_;
+    }
+
+    // Calls f(i) for every set bit in increasing order. A full word runs as a plain counted
+    // loop over its 64 rows (no per-row test), which the compiler can vectorize once f is
+    // inlined; empty words are skipped, mixed words walk their set bits.
+    template <typename F>
+    constexpr void ForEachSet(F&& f) const {
+        for (std::size_t w = 0; w < words_.size(); ++w) {
+            const std::size_t base = w * kWordBits;
+            Word bits = words_[w];
+            if (bits == ~Word{0}) {
+                for (std::size_t j = 0; j < kWordBits; ++j) f(base + j);
+                continue;
+            }
+            while (bits != 0) {
+                f(base + static_cast<std::size_t>(std::countr_zero(bits)));
+                bits &= bits - 1;
+            }
+        }
+    }
+
+    // Calls f(i) for every clear bit below size() in increasing order
+    template <typename F>
+    constexpr void ForEachClear(F&& f) const {
+        for (std::size_t w = 0; w < words_.size(); ++w) {
+            const std::size_t base = w * kWordBits;
+            Word bits = ~words_[w];
+            if (w + 1 == words_.size()) {
+                if (const std::size_t tail = size_ % kWordBits; tail != 0) {
+                    bits &= (Word{1} << tail) - 1;
+                }
+            }
+            while (bits != 0) {
+                f(base + static_cast<std::size_t>(std::countr_zero(bits)));
+                bits &= bits - 1;
+            }
+        }
+    }
+
+  private:  // member functions:
+    static constexpr std::size_t WordsFor(std::size_t n) noexcept {
+        return (n + kWordBits - 1) / kWordBits;
+    }
+
+    constexpr void ClearTail() noexcept {
+        if (const std::size_t tail = size_ % kWordBits; tail != 0) {
+            words_.back() &= (Word{1} << tail) - 1;
+        }
+    }
+};
+
+}  // namespace eav::detail
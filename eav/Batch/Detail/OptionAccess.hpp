@@ -0,0 +1,28 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "../../Detail/Access.hpp"
+#include "../../OptionVector.hpp"
+#include "Bitmap.hpp"
+
+namespace eav::detail {
+
+template <typename T>
+struct Access<OptionVector<T>> {
+    // A batch assembled from ready columns (of the same size)
+    static constexpr OptionVector<T> FromColumns(Bitmap&& valid, std::vector<T>&& values) {
+        return OptionVector<T>(std::move(valid), std::move(values));
+    }
+
+    static constexpr Bitmap& Valid(OptionVector<T>& vec) noexcept {
+        return vec.valid_;
+    }
+
+    static constexpr std::vector<T>& Values(OptionVector<T>& vec) noexcept {
+        return vec.values_;
+    }
+};
+
+}  // namespace eav::detail
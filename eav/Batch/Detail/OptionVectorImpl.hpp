@@ -0,0 +1,151 @@
+#pragma once
+
+#include <utility>
+
+#include "../../OptionVector.hpp"
+#include "OptionAccess.hpp"
+
+namespace eav {
+
+// --- Constructors ---
+
+template <typename T>
+requires(!std::is_void_v<T> && std::default_initializable<T>)
+constexpr OptionVector<T>::OptionVector(std::vector<Option<T>>&& rows) {
+    reserve(rows.size());
+    for (auto& row : rows) {
+        push_back(std::move(row));
+    }
+}
+
+template <typename T>
+requires(!std::is_void_v<T> && std::default_initializable<T>)
+constexpr OptionVector<T>::OptionVector(detail::Bitmap&& valid, std::vector<T>&& values)
+    : valid_(std::move(valid)), values_(std::move(values)) {}
+
+// --- Observers ---
+
+template <typename T>
+requires(!std::is_void_v<T> && std::default_initializable<T>)
+constexpr std::size_t OptionVector<T>::size() const noexcept {
+    return valid_.size();
+}
+
+template <typename T>
+requires(!std::is_void_v<T> && std::default_initializable<T>)
+constexpr bool OptionVector<T>::empty() const noexcept {
+    return valid_.size() == 0;
+}
+
+template <typename T>
+requires(!std::is_void_v<T> && std::default_initializable<T>)
+constexpr std::size_t OptionVector<T>::some_count() const noexcept {
+    return valid_.count();
+}
+
+template <typename T>
+requires(!std::is_void_v<T> && std::default_initializable<T>)
+constexpr bool OptionVector<T>::has_value(std::size_t i) const noexcept {
+    return valid_.test(i);
+}
+
+// --- Accessors ---
+
+template <typename T>
+requires(!std::is_void_v<T> && std::default_initializable<T>)
+constexpr Option<T> OptionVector<T>::operator[](std::size_t i) const {
+    if (has_value(i)) {
+        return detail::Access<Option<T>>::Some(values_[i]);
+    }
+    return detail::Access<Option<T>>::None();
+}
+
+template <typename T>
+requires(!std::is_void_v<T> && std::default_initializable<T>)
+constexpr std::span<T> OptionVector<T>::values() noexcept {
+    return values_;
+}
+
+template <typename T>
+requires(!std::is_void_v<T> && std::default_initializable<T>)
+constexpr std::span<const T> OptionVector<T>::values() const noexcept {
+    return values_;
+}
+
+template <typename T>
+requires(!std::is_void_v<T> && std::default_initializable<T>)
+constexpr const detail::Bitmap& OptionVector<T>::validity() const noexcept {
+    return valid_;
+}
+
+// --- Modifiers ---
+
+template <typename T>
+requires(!std::is_void_v<T> && std::default_initializable<T>)
+template <typename... Args>
+constexpr void OptionVector<T>::push_some(Args&&... args) {
+    values_.emplace_back(std::forward<Args>(args)...);
+    valid_.push_back(true);
+}
+
+template <typename T>
+requires(!std::is_void_v<T> && std::default_initializable<T>)
+constexpr void OptionVector<T>::push_none() {
+    values_.emplace_back();
+    valid_.push_back(false);
+}
+
+template <typename T>
+requires(!std::is_void_v<T> && std::default_initializable<T>)
+constexpr void OptionVector<T>::push_back(Option<T>&& opt) {
+    if (opt.has_value()) {
+        push_some(detail::Access<Option<T>>::Take(std::move(opt)));
+    } else {
+        push_none();
+    }
+}
+
+template <typename T>
+requires(!std::is_void_v<T> && std::default_initializable<T>)
+constexpr void OptionVector<T>::reserve(std::size_t n) {
+    valid_.reserve(n);
+    values_.reserve(n);
+}
+
+template <typename T>
+requires(!std::is_void_v<T> && std::default_initializable<T>)
+constexpr void OptionVector<T>::clear() noexcept {
+    valid_.clear();
+    values_.clear();
+}
+
+// --- Conversion: to std::vector<Option<T>> ---
+
+template <typename T>
+requires(!std::is_void_v<T> && std::default_initializable<T>)
+constexpr std::vector<Option<T>> OptionVector<T>::to_vector() const& {
+    std::vector<Option<T>> rows;
+    rows.reserve(size());
+    for (std::size_t i = 0; i < size(); ++i) {
+        rows.push_back((*this)[i]);
+    }
+    return rows;
+}
+
+template <typename T>
+requires(!std::is_void_v<T> && std::default_initializable<T>)
+constexpr std::vector<Option<T>> OptionVector<T>::to_vector() && {
+    std::vector<Option<T>> rows;
+    rows.reserve(size());
+    for (std::size_t i = 0; i < size(); ++i) {
+        if (has_value(i)) {
+            rows.push_back(detail::Access<Option<T>>::Some(std::move(values_[i])));
+        } else {
+            rows.push_back(detail::Access<Option<T>>::None());
+        }
+    }
+    clear();
+    return rows;
+}
+
+}  // namespace eav
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "../../Detail/Access.hpp"
+#include "../../ResultVector.hpp"
+#include "Bitmap.hpp"
+
+namespace eav::detail {
+
+template <typename T, typename E>
+struct Access<ResultVector<T, E>> {
+    // A batch assembled from ready columns (all three of the same size)
+    static constexpr ResultVector<T, E> FromColumns(Bitmap&& valid, std::vector<T>&& ok, std::vector<E>&& err) {
+        return ResultVector<T, E>(std::move(valid), std::move(ok), std::move(err));
+    }
+
+    static constexpr Bitmap& Valid(ResultVector<T, E>& vec) noexcept {
+        return vec.valid_;
+    }
+
+    static constexpr std::vector<T>& Oks(ResultVector<T, E>& vec) noexcept {
+        return vec.ok_;
+    }
+
+    static constexpr std::vector<E>& Errs(ResultVector<T, E>& vec) noexcept {
+        return vec.err_;
+    }
+};
+
+}  // namespace eav::detail
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <utility>
+
+#include "../../ResultVector.hpp"
+#include "ResultAccess.hpp"
+
+namespace eav {
+
+// --- Constructors ---
+
+template <typename T, concepts::IsError E>
+requires(std::default_initializable<T> && std::default_initializable<E>)
+constexpr ResultVector<T, E>::ResultVector(std::vector<Result<T, E>>&& rows) {
+    reserve(rows.size());
+    for (auto& row : rows) {
+        push_back(std::move(row));
+    }
+}
+
+template <typename T, concepts::IsError E>
+requires(std::default_initializable<T> && std::default_initializable<E>)
+constexpr ResultVector<T, E>::ResultVector(detail::Bitmap&& valid, std::vector<T>&& ok, std::vector<E>&& err)
+    : valid_(std::move(valid)), ok_(std::move(ok)), err_(std::move(err)) {}
+
+// --- Observers ---
+
+template <typename T, concepts::IsError E>
+requires(std::default_initializable<T> && std::default_initializable<E>)
+constexpr std::size_t ResultVector<T, E>::size() const noexcept {
+    return valid_.size();
+}
+
+template <typename T, concepts::IsError E>
+requires(std::default_initializable<T> && std::default_initializable<E>)
+constexpr bool ResultVector<T, E>::empty() const noexcept {
+    return valid_.size() == 0;
+}
+
+template <typename T, concepts::IsError E>
+requires(std::default_initializable<T> && std::default_initializable<E>)
+constexpr std::size_t ResultVector<T, E>::ok_count() const noexcept {
+    return valid_.count();
+}
+
+template <typename T, concepts::IsError E>
+requires(std::default_initializable<T> && std::default_initializable<E>)
+constexpr bool ResultVector<T, E>::is_ok(std::size_t i) const noexcept {
+    return valid_.test(i);
+}
+
+template <typename T, concepts::IsError E>
+requires(std::default_initializable<T> && std::default_initializable<E>)
+constexpr bool ResultVector<T, E>::is_err(std::size_t i) const noexcept {
+    return !valid_.test(i);
+}
+
+// --- Accessors ---
+
+template <typename T, concepts::IsError E>
+requires(std::default_initializable<T> && std::default_initializable<E>)
+constexpr Result<T, E> ResultVector<T, E>::operator[](std::size_t i) const {
+    if (is_ok(i)) {
+        return detail::Access<Result<T, E>>::Ok(ok_[i]);
+    }
+    return detail::Access<Result<T, E>>::Err(err_[i]);
+}
+
+template <typename T, concepts::IsError E>
+requires(std::default_initializable<T> && std::default_initializable<E>)
+constexpr std::span<T> ResultVector<T, E>::ok_column() noexcept {
+    return ok_;
+}
+
+template <typename T, concepts::IsError E>
+requires(std::default_initializable<T> && std::default_initializable<E>)
+constexpr std::span<const T> ResultVector<T, E>::ok_column() const noexcept {
+    return ok_;
+}
+
+template <typename T, concepts::IsError E>
+requires(std::default_initializable<T> && std::default_initializable<E>)
+constexpr std::span<E> ResultVector<T, E>::err_column() noexcept {
+    return err_;
+}
+
+template <typename T, concepts::IsError E>
+requires(std::default_initializable<T> && std::default_initializable<E>)
+constexpr std::span<const E> ResultVector<T, E>::err_column() const noexcept {
+    return err_;
+}
+
+template <typename T, concepts::IsError E>
+requires(std::default_initializable<T> && std::default_initializable<E>)
+constexpr const detail::Bitmap& ResultVector<T, E>::validity() const noexcept {
+    return valid_;
+}
+
+// --- Modifiers ---
+
+template <typename T, concepts::IsError E>
+requires(std::default_initializable<T> && std::default_initializable<E>)
+template <typename... Args>
+constexpr void ResultVector<T, E>::push_ok(Args&&... args) {
+    ok_.emplace_back(std::forward<Args>(args)...);
+    err_.emplace_back();
+    valid_.push_back(true);
+}
+
+template <typename T, concepts::IsError E>
+requires(std::default_initializable<T> && std::default_initializable<E>)
+template <typename... Args>
+constexpr void ResultVector<T, E>::push_err(Args&&... args) {
+    ok_.emplace_back();
+    err_.emplace_back(std::forward<Args>(args)...);
+    valid_.push_back(false);
+}
+
+template <typename T, concepts::IsError E>
+requires(std::default_initializable<T> && std::default_initializable<E>)
+constexpr void ResultVector<T, E>::push_back(Result<T, E>&& res) {
+    if (res.is_ok()) {
+        push_ok(detail::Access<Result<T, E>>::TakeOk(std::move(res)));
+    } else {
+        push_err(detail::Access<Result<T, E>>::TakeErr(std::move(res)));
+    }
+}
+
+template <typename T, concepts::IsError E>
+requires(std::default_initializable<T> && std::default_initializable<E>)
+constexpr void ResultVector<T, E>::reserve(std::size_t n) {
+    valid_.reserve(n);
+    ok_.reserve(n);
+    err_.reserve(n);
+}
+
+template <typename T, concepts::IsError E>
+requires(std::default_initializable<T> && std::default_initializable<E>)
+constexpr void ResultVector<T, E>::clear() noexcept {
+    valid_.clear();
+    ok_.clear();
+    err_.clear();
+}
+
+// --- Conversion: to std::vector<Result<T,E>> ---
+
+template <typename T, concepts::IsError E>
+requires(std::default_initializable<T> && std::default_initializable<E>)
+constexpr std::vector<Result<T, E>> ResultVector<T, E>::to_vector() const& {
+    std::vector<Result<T, E>> rows;
+    rows.reserve(size());
+    for (std::size_t i = 0; i < size(); ++i) {
+        rows.push_back((*this)[i]);
+    }
+    return rows;
+}
+
+template <typename T, concepts::IsError E>
+requires(std::default_initializable<T> && std::default_initializable<E>)
+constexpr std::vector<Result<T, E>> ResultVector<T, E>::to_vector() && {
+    std::vector<Result<T, E>> rows;
+    rows.reserve(size());
+    for (std::size_t i = 0; i < size(); ++i) {
+        if (is_ok(i)) {
+            rows.push_back(detail::Access<Result<T, E>>::Ok(std::move(ok_[i])));
+        } else {
+            rows.push_back(detail::Access<Result<T, E>>::Err(std::move(err_[i])));
+        }
+    }
+    clear();
+    return rows;
+}
+
+}  // namespace eav
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>     // std::size_t
+#include <tuple>
+#include <type_traits>
+#include <utility>  // std::move, std::as_const
+#include <vector>
+
+#include "../Detail/Call.hpp"
+#include "../Option.hpp"
+#include "../OptionVector.hpp"
+#include "Detail/OptionAccess.hpp"
+
+// Batch versions of the Option combinators: `vec | combine::option::Map(f)` applies f to the
+// whole column in one pass over the validity bitmap (see Batch/ResultCombinators.hpp)
+
+namespace eav::detail {
+
+// OptionVector<T> -> (T -> U) -> OptionVector<U>
+template <typename T, typename F, BranchHint H> requires std::invocable<const F&, T&&>
+constexpr auto BatchPipe(OptionVector<T>&& vec, const combine::option::pipe::Map<F, H>& stage) {
+    using U = std::invoke_result_t<const F&, T&&>;
+    using In = Access<OptionVector<T>>;
+
+    Bitmap& valid = In::Valid(vec);
+    std::vector<T>& values = In::Values(vec);
+    std::vector<U> out(vec.size());
+    valid.ForEachSet([&](std::size_t i) { out[i] = detail::Call(stage.func_, std::move(values[i])); });
+
+    return Access<OptionVector<U>>::FromColumns(std::move(valid), std::move(out));
+}
+
+// OptionVector<T> -> (T -> bool) -> OptionVector<T>
+template <typename T, typename P, BranchHint H>
+requires std::invocable<const P&, const T&> && std::same_as<std::invoke_result_t<const P&, const T&>, bool>
+constexpr auto BatchPipe(OptionVector<T>&& vec, const combine::option::pipe::Filter<P, H>& stage) {
+    using In = Access<OptionVector<T>>;
+
+    Bitmap& valid = In::Valid(vec);
+    const std::vector<T>& values = In::Values(vec);
+    // ForEachSet reads a word before visiting its rows, so clearing the current bit is safe
+    valid.ForEachSet([&](std::size_t i) {
+        if (!detail::Call(stage.predicate_, values[i])) {
+            valid.reset(i);
+            stage.site_.template Report<Option<T>>(instrument::Event::kFilter);
+        }
+    });
+
+    return std::move(vec);
+}
+
+// OptionVector<T> -> (T -> Option<U>) -> OptionVector<U>
+template <typename T, typename F, BranchHint H>
+requires std::invocable<const F&, T&&> && concepts::IsResult<std::invoke_result_t<const F&, T&&>>
+constexpr auto BatchPipe(OptionVector<T>&& vec, const combine::option::pipe::AndThen<F, H>& stage) {
+    using NextOpt = std::invoke_result_t<const F&, T&&>;
+    using U = typename NextOpt::OkType;
+    using In = Access<OptionVector<T>>;
+
+    Bitmap& valid = In::Valid(vec);
+    std::vector<T>& values = In::Values(vec);
+    std::vector<U> out(vec.size());
+    valid.ForEachSet([&](std::size_t i) {
+        NextOpt opt = detail::Call(stage.func_, std::move(values[i]));
+        if (opt.has_value()) {
+            out[i] = Access<NextOpt>::Take(std::move(opt));
+        } else {
+            valid.reset(i);
+            stage.site_.template Report<NextOpt>(instrument::Event::kAndThen);
+        }
+    });
+
+    return Access<OptionVector<U>>::FromColumns(std::move(valid), std::move(out));
+}
+
+// Lazy pipeline: its stages are applied to the batch one after another
+template <std::size_t I = 0, typename T, typename... Stages>
+constexpr auto BatchPipe(OptionVector<T>&& vec, const Pipeline<OptionStage, Stages...>& pipeline) {
+    if constexpr (I == sizeof...(Stages)) {
+        return std::move(vec);
+    } else {
+        return BatchPipe<I + 1>(BatchPipe(std::move(vec), std::get<I>(pipeline.stages())), pipeline);
+    }
+}
+
+}  // namespace eav::detail
+
+namespace eav {
+
+template <typename T, typename C>
+requires requires(OptionVector<T>&& vec, const std::remove_cvref_t<C>& comb) {
+    detail::BatchPipe(std::move(vec), comb);
+}
+constexpr auto operator|(OptionVector<T>&& vec, C&& comb) {
+    return detail::BatchPipe(std::move(vec), std::as_const(comb));
+}
+
+}  // namespace eav
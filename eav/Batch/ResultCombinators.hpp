@@ -0,0 +1,124 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>     // std::size_t
+#include <tuple>
+#include <type_traits>
+#include <utility>  // std::move, std::as_const
+#include <vector>
+
+#include "../Detail/Call.hpp"
+#include "../Result.hpp"
+#include "../ResultVector.hpp"
+#include "Detail/ResultAccess.hpp"
+
+// Batch versions of the Result combinators: `vec | combine::result::MapOk(f)` applies f to the
+// whole Ok column in one pass over the validity bitmap. Rows of a fully Ok 64-row block are
+// processed by a plain counted loop, so a simple `f` is vectorized; the column that a
+// combinator does not touch (errors for MapOk, values for MapErr) is handed over without a copy.
+// Stages are applied as const, as in lazy pipelines: `f` is called once per row.
+
+namespace eav::detail {
+
+// ResultVector<T, E> -> (T -> U) -> ResultVector<U, E>
+template <typename T, typename E, typename F, BranchHint H> requires std::invocable<const F&, T&&>
+constexpr auto BatchPipe(ResultVector<T, E>&& vec, const combine::result::pipe::MapOk<F, H>& stage) {
+    using U = std::invoke_result_t<const F&, T&&>;
+    using In = Access<ResultVector<T, E>>;
+
+    Bitmap& valid = In::Valid(vec);
+    std::vector<T>& ok = In::Oks(vec);
+    std::vector<U> out(vec.size());
+    valid.ForEachSet([&](std::size_t i) { out[i] = detail::Call(stage.func_, std::move(ok[i])); });
+
+    return Access<ResultVector<U, E>>::FromColumns(std::move(valid), std::move(out), std::move(In::Errs(vec)));
+}
+
+// ResultVector<T, E> -> (E -> R) -> ResultVector<T, R>
+template <typename T, typename E, typename F, BranchHint H> requires std::invocable<const F&, E&&>
+constexpr auto BatchPipe(ResultVector<T, E>&& vec, const combine::result::pipe::MapErr<F, H>& stage) {
+    using R = std::invoke_result_t<const F&, E&&>;
+    using In = Access<ResultVector<T, E>>;
+
+    Bitmap& valid = In::Valid(vec);
+    std::vector<E>& err = In::Errs(vec);
+    std::vector<R> out(vec.size());
+    valid.ForEachClear([&](std::size_t i) { out[i] = detail::Call(stage.func_, std::move(err[i])); });
+
+    return Access<ResultVector<T, R>>::FromColumns(std::move(valid), std::move(In::Oks(vec)), std::move(out));
+}
+
+// ResultVector<T, E> -> (T -> bool) -> ResultVector<T, E>; rejected rows get a copy of else_err
+template <typename T, typename E, typename P, BranchHint H>
+requires std::invocable<const P&, const T&> && std::same_as<std::invoke_result_t<const P&, const T&>, bool>
+constexpr auto BatchPipe(ResultVector<T, E>&& vec, const combine::result::pipe::Filter<P, E, H>& stage) {
+    using In = Access<ResultVector<T, E>>;
+
+    Bitmap& valid = In::Valid(vec);
+    const std::vector<T>& ok = In::Oks(vec);
+    std::vector<E>& err = In::Errs(vec);
+    // ForEachSet reads a word before visiting its rows, so clearing the current bit is safe
+    valid.ForEachSet([&](std::size_t i) {
+        if (!detail::Call(stage.predicate_, ok[i])) {
+            valid.reset(i);
+            err[i] = stage.else_err_;
+            stage.site_.template Report<E>(instrument::Event::kFilter);
+        }
+    });
+
+    return std::move(vec);
+}
+
+// ResultVector<T, E> -> (T -> Result<U, E>) -> ResultVector<U, E>
+template <typename T, typename E, typename F, BranchHint H>
+requires std::invocable<const F&, T&&> && concepts::IsResult<std::invoke_result_t<const F&, T&&>>
+constexpr auto BatchPipe(ResultVector<T, E>&& vec, const combine::result::pipe::AndThen<F, H>& stage) {
+    using NextResultT = std::invoke_result_t<const F&, T&&>;
+    using U = typename NextResultT::OkType;
+    using R = typename NextResultT::ErrType;
+    static_assert(std::same_as<R, E> || std::same_as<R, PendingType>,
+                  "eav::ResultVector: AndThen must keep the error type");
+    using In = Access<ResultVector<T, E>>;
+    using Next = Access<NextResultT>;
+
+    Bitmap& valid = In::Valid(vec);
+    std::vector<T>& ok = In::Oks(vec);
+    std::vector<E>& err = In::Errs(vec);
+    std::vector<U> out(vec.size());
+    valid.ForEachSet([&](std::size_t i) {
+        NextResultT res = detail::Call(stage.func_, std::move(ok[i]));
+        if (res.is_ok()) {
+            out[i] = Next::TakeOk(std::move(res));
+        } else if constexpr (!std::same_as<R, PendingType>) {
+            valid.reset(i);
+            err[i] = Next::TakeErr(std::move(res));
+            stage.site_.template Report<E>(instrument::Event::kAndThen);
+        }
+    });
+
+    return Access<ResultVector<U, E>>::FromColumns(std::move(valid), std::move(out), std::move(err));
+}
+
+// Lazy pipeline: its stages are applied to the batch one after another
+template <std::size_t I = 0, typename T, typename E, typename... Stages>
+constexpr auto BatchPipe(ResultVector<T, E>&& vec, const Pipeline<ResultStage, Stages...>& pipeline) {
+    if constexpr (I == sizeof...(Stages)) {
+        return std::move(vec);
+    } else {
+        return BatchPipe<I + 1>(BatchPipe(std::move(vec), std::get<I>(pipeline.stages())), pipeline);
+    }
+}
+
+}  // namespace eav::detail
+
+namespace eav {
+
+template <typename T, typename E, typename C>
+requires requires(ResultVector<T, E>&& vec, const std::remove_cvref_t<C>& comb) {
+    detail::BatchPipe(std::move(vec), comb);
+}
+constexpr auto operator|(ResultVector<T, E>&& vec, C&& comb) {
+    return detail::BatchPipe(std::move(vec), std::as_const(comb));
+}
+
+}  // namespace eav
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <concepts>
+
+#include "../Traits/Niche.hpp"
+
+namespace eav::concepts {
+
+// T has a reserved value (see NicheTraits) that can encode an empty state
+template <typename T>
+concept HasNiche = NicheTraits<T>::has_niche && requires(const T& val) {
+    { NicheTraits<T>::none() } -> std::same_as<T>;
+    { NicheTraits<T>::is_none(val) } -> std::same_as<bool>;
+};
+
+// The reserved value of T is never a valid T (NicheTraits<T>::none_is_invalid), so it can also
+// encode the other alternative of a Result
+template <typename T>
+concept HasInvalidNiche = HasNiche<T> && requires {
+    requires NicheTraits<T>::none_is_invalid;
+};
+
+}  // namespace eav::concepts
@@ -0,0 +1,11 @@
+#pragma once
+
+#include "../Traits/Relocatable.hpp"
+
+namespace eav::concepts {
+
+// T can be moved to new storage with memcpy (see RelocationTraits)
+template <typename T>
+concept TriviallyRelocatable = RelocationTraits<T>::trivially_relocatable;
+
+}  // namespace eav::concepts
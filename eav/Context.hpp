@@ -0,0 +1,7 @@
+#pragma once
+
+// Context messages for errors, formatted only when displayed; kept out of Result.hpp, which
+// does not need <string> or the per-thread arena
+#include "Error/ContextArena.hpp"
+#include "Error/WithContext.hpp"
+#include "Result/Combinators/Context.hpp"
@@ -0,0 +1,6 @@
+#pragma once
+
+// co_await on Result/Option inside functions returning Result/Option; kept out of Result.hpp
+// and Option.hpp, which do not need <coroutine>
+#include "Coro/Option.hpp"
+#include "Coro/Result.hpp"
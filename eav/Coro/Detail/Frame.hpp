@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>  // std::size_t, std::max_align_t
+#include <memory>   // std::allocator_arg_t, std::allocator_traits
+#include <new>
+#include <utility>  // std::move
+
+namespace eav::detail {
+
+// Frame allocation of the Result/Option coroutines.
+// By default the frame comes from the global operator new. A coroutine whose parameters start
+// with (std::allocator_arg_t, const Alloc&) - after the object parameter for a member function -
+// gets its frame from `Alloc` instead (an arena, a pool, std::pmr::polymorphic_allocator, ...).
+// Either way a small trailer after the frame records how to free it, so operator delete does
+// not need to know which form allocated it.
+struct FrameAllocation {
+  private:  // nested types:
+    using Dealloc = void (*)(void* frame, std::size_t total) noexcept;
+
+    // Unit of allocation: one maximally aligned block (sizeof(std::max_align_t) may be larger)
+    struct alignas(std::max_align_t) Block {
+        std::byte bytes[alignof(std::max_align_t)];
+    };
+
+    // [ frame (size rounded up) | Dealloc | allocator copy (allocator form only) ]
+    static constexpr std::size_t Align(std::size_t n) noexcept {
+        return (n + sizeof(Block) - 1) & ~(sizeof(Block) - 1);
+    }
+
+    template <typename Alloc>
+    using ByteAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Block>;
+
+    template <typename Alloc>
+    static constexpr std::size_t TotalFor(std::size_t size) noexcept {
+        return Align(size) + Align(sizeof(Dealloc)) + Align(sizeof(ByteAlloc<Alloc>));
+    }
+
+    static Dealloc& DeallocOf(void* frame, std::size_t size) noexcept {
+        return *reinterpret_cast<Dealloc*>(static_cast<std::byte*>(frame) + Align(size));
+    }
+
+    template <typename Alloc>
+    static ByteAlloc<Alloc>& AllocOf(void* frame, std::size_t size) noexcept {
+        return *reinterpret_cast<ByteAlloc<Alloc>*>(static_cast<std::byte*>(frame) + Align(size) +
+                                                    Align(sizeof(Dealloc)));
+    }
+
+    template <typename Alloc>
+    static void* Allocate(std::size_t size, const Alloc& alloc) {
+        using Traits = std::allocator_traits<ByteAlloc<Alloc>>;
+        ByteAlloc<Alloc> bytes(alloc);
+        const std::size_t total = TotalFor<Alloc>(size);
+        void* frame = Traits::allocate(bytes, total / sizeof(Block));
+        ::new (&AllocOf<Alloc>(frame, size)) ByteAlloc<Alloc>(std::move(bytes));
+        DeallocOf(frame, size) = [](void* ptr, std::size_t sz) noexcept {
+            ByteAlloc<Alloc>& stored = AllocOf<Alloc>(ptr, sz);
+            ByteAlloc<Alloc> owner(std::move(stored));
+            stored.~ByteAlloc<Alloc>();
+            Traits::deallocate(owner, static_cast<Block*>(ptr),
+                               TotalFor<Alloc>(sz) / sizeof(Block));
+        };
+        return frame;
+    }
+
+  public:  // member functions:
+    static void* operator new(std::size_t size) {
+        void* frame = ::operator new(Align(size) + sizeof(Dealloc));
+        DeallocOf(frame, size) = [](void* ptr, std::size_t sz) noexcept {
+            ::operator delete(ptr, Align(sz) + sizeof(Dealloc));
+        };
+        return frame;
+    }
+
+    // Free function coroutine: f(std::allocator_arg, alloc, args...)
+    template <typename Alloc, typename... Args>
+    static void* operator new(std::size_t size, std::allocator_arg_t, const Alloc& alloc, const Args&...) {
+        return Allocate(size, alloc);
+    }
+
+    // Member function coroutine: obj.f(std::allocator_arg, alloc, args...)
+    template <typename This, typename Alloc, typename... Args>
+    static void* operator new(std::size_t size, const This&, std::allocator_arg_t, const Alloc& alloc, const Args&...) {
+        return Allocate(size, alloc);
+    }
+
+    static void operator delete(void* frame, std::size_t size) noexcept {
+        DeallocOf(frame, size)(frame, size);
+    }
+};
+
+}  // namespace eav::detail
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <memory>       // std::addressof, std::destroy_at
+#include <new>
+#include <type_traits>
+#include <utility>      // std::move
+
+#include "../../Detail/Access.hpp"
+#include "../../Detail/Call.hpp"
+#include "../../Detail/Panic.hpp"
+
+namespace eav::detail {
+
+// The value a Result/Option coroutine starts from on a compiler that converts the return object
+// before the body runs (see ReturnObject); specialized in Coro/Result.hpp and Coro/Option.hpp
+template <typename R>
+struct ReturnPlaceholder;
+
+// Where the body of a Result/Option coroutine puts its value; kept by the promise
+template <typename R>
+class ReturnSlot {
+  private:  // data members:
+    ReturnObject<R>* object_ = nullptr;  // the return object, until it is converted
+    R* value_ = nullptr;                 // the return value, if it was converted before the body
+
+    friend class ReturnObject<R>;
+
+  public:  // member functions:
+    // The value of the call, built from the prvalue returned by func() (once)
+    template <typename F>
+    void Fill(F&& func) {
+        if (value_ == nullptr) {
+            object_->Fill(std::forward<F>(func));
+            return;
+        }
+        // the placeholder is replaced only once the value exists, in case func() throws
+        R res = Call(std::forward<F>(func));
+        std::destroy_at(value_);
+        ::new (static_cast<void*>(value_)) R(std::move(res));
+    }
+};
+
+// The object returned by get_return_object() of the Result/Option coroutines; R is built from it
+// by a constructor of R (ReturnObject&&). When that happens is up to the compiler:
+// - after the body ran (GCC, Clang 17+): the promise has filled the value stored here, and R
+//   is moved from it;
+// - before the body (Clang 15/16): R starts as ReturnPlaceholder<R>::Make() and the promise,
+//   told where R is, replaces it once the body has a value. That R is the ramp function's return
+//   value (or a local of its, returned at the end), alive until the ramp returns.
+// Either way nothing is read from or written to a temporary that is gone.
+template <typename R>
+class ReturnObject {
+  private:  // data members:
+    ReturnSlot<R>* slot_;  // in the promise, alive while the body runs
+    union {
+        R value_;
+    };
+    bool filled_ = false;
+
+  public:  // member functions:
+    explicit ReturnObject(ReturnSlot<R>& slot) noexcept : slot_(&slot) {
+        slot.object_ = this;
+    }
+
+    // Before the body ran the promise follows the object; after it, the promise is gone
+    ReturnObject(ReturnObject&& oth) noexcept(std::is_nothrow_move_constructible_v<R>) : slot_(oth.slot_) {
+        if (oth.filled_) {
+            ::new (static_cast<void*>(std::addressof(value_))) R(std::move(oth.value_));
+            filled_ = true;
+        } else {
+            slot_->object_ = this;
+        }
+    }
+
+    ReturnObject(const ReturnObject&) = delete;
+    ReturnObject& operator=(const ReturnObject&) = delete;
+    ReturnObject& operator=(ReturnObject&&) = delete;
+
+    ~ReturnObject() {
+        if (filled_) {
+            std::destroy_at(std::addressof(value_));
+        }
+    }
+
+    template <typename F>
+    void Fill(F&& func) {
+        ::new (static_cast<void*>(std::addressof(value_))) R(Call(std::forward<F>(func)));
+        filled_ = true;
+    }
+
+    // What `self`, the R being built from this object, is moved from: the value of the body,
+    // or a placeholder that the promise replaces in `self` later
+    R& Take(R* self) {
+        if (!filled_) {
+            ::new (static_cast<void*>(std::addressof(value_))) R(ReturnPlaceholder<R>::Make());
+            filled_ = true;
+            slot_->value_ = self;
+        }
+        return value_;
+    }
+};
+
+}  // namespace eav::detail
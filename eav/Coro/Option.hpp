@@ -0,0 +1,126 @@
+#pragma once
+
+#include <concepts>
+#include <coroutine>
+#include <type_traits>
+#include <utility>
+
+#include "../Detail/Compiler.hpp"
+#include "../Option.hpp"
+#include "Detail/Frame.hpp"
+#include "Detail/Return.hpp"
+
+// A function returning Option<T> may be a coroutine: `co_await opt` evaluates to the value or
+// returns None from the coroutine (see Coro/Result.hpp)
+
+namespace eav::detail {
+
+template <typename T>
+struct ReturnPlaceholder<Option<T>> {
+    static Option<T> Make() noexcept {
+        return Access<Option<T>>::None();
+    }
+};
+
+// `co_await opt` inside an Option<T> coroutine
+template <typename Promise, typename O>
+class OptionAwaiter {
+  private:  // data members:
+    O& opt_;  // Option<U> or const Option<U>; lives until the end of the full-expression
+
+  public:  // member functions:
+    explicit OptionAwaiter(O& opt) noexcept : opt_(opt) {}
+
+    bool await_ready() const noexcept {
+        return opt_.has_value();
+    }
+
+    // None: the coroutine returns None
+    void await_suspend(std::coroutine_handle<Promise> handle) {
+        handle.promise().SetNone();
+        handle.destroy();
+    }
+
+    decltype(auto) await_resume() noexcept {
+        if constexpr (std::is_const_v<O>) {
+            return opt_.unwrap_unchecked();
+        } else {
+            return Access<O>::Take(std::move(opt_));
+        }
+    }
+};
+
+template <typename T>
+class OptionPromise : public FrameAllocation {
+  private:  // data members:
+    ReturnSlot<Option<T>> return_;  // filled by the body (see Detail/Return.hpp)
+
+  public:  // member functions:
+    ReturnObject<Option<T>> get_return_object() noexcept {
+        return ReturnObject<Option<T>>(return_);
+    }
+
+    std::suspend_never initial_suspend() const noexcept {
+        return {};
+    }
+
+    std::suspend_never final_suspend() const noexcept {
+        return {};
+    }
+
+    void unhandled_exception() const {
+#if defined(__cpp_exceptions)
+        throw;
+#else
+        EAV_TRAP();
+#endif
+    }
+
+    // co_return value; / co_return {args...};
+    void return_value(T&& val) {
+        SetSome(std::move(val));
+    }
+
+    template <typename U> requires(!concepts::IsResult<std::remove_cvref_t<U>> && std::constructible_from<T, U>)
+    void return_value(U&& val) {
+        SetSome(std::forward<U>(val));
+    }
+
+    // co_return make::None(); / co_return other_option;
+    template <typename U> requires(std::same_as<U, T> || std::same_as<U, PendingType>)
+    void return_value(Option<U>&& opt) {
+        if constexpr (std::same_as<U, PendingType>) {
+            SetNone();
+        } else if (opt.has_value()) {
+            SetSome(Access<Option<U>>::Take(std::move(opt)));
+        } else {
+            SetNone();
+        }
+    }
+
+    template <typename U>
+    auto await_transform(Option<U>&& opt) noexcept {
+        return OptionAwaiter<OptionPromise, Option<U>>(opt);
+    }
+
+    template <typename U>
+    auto await_transform(const Option<U>& opt) noexcept {
+        return OptionAwaiter<OptionPromise, const Option<U>>(opt);
+    }
+
+    template <typename... Args>
+    void SetSome(Args&&... args) {
+        return_.Fill([&] { return Access<Option<T>>::Some(std::forward<Args>(args)...); });
+    }
+
+    void SetNone() {
+        return_.Fill([] { return Access<Option<T>>::None(); });
+    }
+};
+
+}  // namespace eav::detail
+
+template <typename T, typename... Args>
+struct std::coroutine_traits<eav::Option<T>, Args...> {
+    using promise_type = eav::detail::OptionPromise<T>;
+};
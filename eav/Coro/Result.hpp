@@ -0,0 +1,181 @@
+#pragma once
+
+#include <concepts>
+#include <coroutine>
+#include <type_traits>
+#include <utility>
+
+#include "../Detail/Compiler.hpp"
+#include "../Result.hpp"
+#include "Detail/Frame.hpp"
+#include "Detail/Return.hpp"
+
+// A function returning Result<T, E> may be a coroutine:
+//
+//     Result<Config, ParseError> Load(std::string_view path) {
+//         auto text = co_await ReadFile(path);    // Err => returned from Load as is
+//         auto json = co_await Parse(text);
+//         co_return Config(std::move(json));      // or: co_return make::Err(...)
+//     }
+//
+// `co_await res` evaluates to the Ok value (moved out of an rvalue Result, by const reference
+// otherwise); on Err the coroutine stops, its frame is destroyed and the error (converted to E)
+// becomes the return value. The coroutine never really suspends: it runs to completion inside
+// the call, so the frame is short-lived (see Detail/Frame.hpp for custom allocators).
+// A Result<void, E> coroutine ends with `co_return;` and fails with `co_await make::Err(...)`.
+
+namespace eav::detail {
+
+template <typename T, typename E>
+class ResultPromise;
+
+// Only used where the return object is converted before the body runs: E{} or T{} is then the
+// value until the body has one, so such a compiler needs one of them default-constructible
+template <typename T, typename E>
+struct ReturnPlaceholder<Result<T, E>> {
+    static Result<T, E> Make() {
+        if constexpr (std::default_initializable<E>) {
+            return Access<Result<T, E>>::Err();
+        } else if constexpr (std::is_void_v<T> || std::default_initializable<T>) {
+            return Access<Result<T, E>>::Ok();
+        } else {
+            Panic("eav: this compiler converts the return object of a coroutine before the body runs; "
+                  "a Result<T, E> coroutine then needs a default-constructible E or T");
+        }
+    }
+};
+
+// `co_await res` inside a Result<T, E> coroutine
+template <typename Promise, typename R>
+class ResultAwaiter {
+  private:  // data members:
+    R& res_;  // Result<U, R> or const Result<U, R>; lives until the end of the full-expression
+
+  public:  // member functions:
+    explicit ResultAwaiter(R& res) noexcept : res_(res) {}
+
+    bool await_ready() const noexcept {
+        if constexpr (std::same_as<typename std::remove_const_t<R>::ErrType, PendingType>) {
+            return true;
+        } else {
+            return res_.is_ok();
+        }
+    }
+
+    // Err: the error becomes the return value and the coroutine is finished here
+    void await_suspend(std::coroutine_handle<Promise> handle) {
+        if constexpr (std::is_const_v<R>) {
+            handle.promise().SetErr(res_.unwrap_err_unchecked());
+        } else {
+            handle.promise().SetErr(Access<R>::TakeErr(std::move(res_)));
+        }
+        handle.destroy();
+    }
+
+    // Nothing for a Result<void, E>
+    decltype(auto) await_resume() noexcept {
+        if constexpr (std::is_void_v<typename std::remove_const_t<R>::OkType>) {
+            return;
+        } else if constexpr (std::is_const_v<R>) {
+            return res_.unwrap_ok_unchecked();
+        } else {
+            return Access<R>::TakeOk(std::move(res_));
+        }
+    }
+};
+
+// Everything but the co_return of a value, which Result<void, E> does not have
+template <typename T, typename E>
+class ResultPromiseBase : public FrameAllocation {
+  private:  // data members:
+    ReturnSlot<Result<T, E>> return_;  // filled by the body (see Detail/Return.hpp)
+
+  public:  // member functions:
+    ReturnObject<Result<T, E>> get_return_object() noexcept {
+        return ReturnObject<Result<T, E>>(return_);
+    }
+
+    std::suspend_never initial_suspend() const noexcept {
+        return {};
+    }
+
+    std::suspend_never final_suspend() const noexcept {
+        return {};
+    }
+
+    void unhandled_exception() const {
+#if defined(__cpp_exceptions)
+        throw;
+#else
+        EAV_TRAP();
+#endif
+    }
+
+    template <typename U, typename R> requires(std::constructible_from<E, const R&> || std::same_as<R, PendingType>)
+    auto await_transform(Result<U, R>&& res) noexcept {
+        return ResultAwaiter<ResultPromise<T, E>, Result<U, R>>(res);
+    }
+
+    template <typename U, typename R> requires(std::constructible_from<E, const R&> || std::same_as<R, PendingType>)
+    auto await_transform(const Result<U, R>& res) noexcept {
+        return ResultAwaiter<ResultPromise<T, E>, const Result<U, R>>(res);
+    }
+
+    template <typename... Args>
+    void SetOk(Args&&... args) {
+        return_.Fill([&] { return Access<Result<T, E>>::Ok(std::forward<Args>(args)...); });
+    }
+
+    template <typename... Args>
+    void SetErr(Args&&... args) {
+        return_.Fill([&] { return Access<Result<T, E>>::Err(std::forward<Args>(args)...); });
+    }
+};
+
+template <typename T, typename E>
+class ResultPromise : public ResultPromiseBase<T, E> {
+  public:  // member functions:
+    // co_return value; / co_return {args...};
+    void return_value(T&& val) {
+        this->SetOk(std::move(val));
+    }
+
+    template <typename U> requires(!concepts::IsResult<std::remove_cvref_t<U>> && std::constructible_from<T, U>)
+    void return_value(U&& val) {
+        this->SetOk(std::forward<U>(val));
+    }
+
+    // co_return make::Err(...); / co_return other_result;
+    template <typename U, typename R>
+    requires((std::same_as<U, T> || std::same_as<U, PendingType>) &&
+             (std::constructible_from<E, R> || std::same_as<R, PendingType>))
+    void return_value(Result<U, R>&& res) {
+        using In = Access<Result<U, R>>;
+        if constexpr (std::same_as<U, PendingType>) {
+            this->SetErr(In::TakeErr(std::move(res)));
+        } else if constexpr (std::same_as<R, PendingType>) {
+            this->SetOk(In::TakeOk(std::move(res)));
+        } else if (res.is_ok()) {
+            this->SetOk(In::TakeOk(std::move(res)));
+        } else {
+            this->SetErr(In::TakeErr(std::move(res)));
+        }
+    }
+};
+
+// A coroutine returning Result<void, E> ends with `co_return;` (or by flowing off its end) and
+// fails with `co_await make::Err(...)`: a promise has return_void() or return_value(), not both
+template <typename E>
+class ResultPromise<void, E> : public ResultPromiseBase<void, E> {
+  public:  // member functions:
+    void return_void() {
+        this->SetOk();
+    }
+};
+
+}  // namespace eav::detail
+
+template <typename T, typename E, typename... Args>
+struct std::coroutine_traits<eav::Result<T, E>, Args...> {
+    using promise_type = eav::detail::ResultPromise<T, E>;
+};
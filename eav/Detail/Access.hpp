@@ -0,0 +1,19 @@
+#pragma once
+
+namespace eav::detail {
+
+// Tag for constructing a value in place from the result of `func(args...)`: the returned
+// prvalue initializes the storage directly (guaranteed copy elision), no temporary is moved
+struct InvokeTag {};
+
+// Internal access to Result/Option for combinators and pipelines: builds values in place
+// and moves payloads out by reference, so that a combinator adds no copies or moves of its
+// own. Specialized in Result/Detail/Access.hpp and Option/Detail/Access.hpp
+template <typename R>
+struct Access;
+
+// What a Result/Option coroutine returns before it becomes the Result/Option (see Coro/Detail/Return.hpp)
+template <typename R>
+class ReturnObject;
+
+}  // namespace eav::detail
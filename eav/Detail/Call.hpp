@@ -0,0 +1,44 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>  // std::forward
+
+namespace eav::detail {
+
+// std::invoke without <functional>: the core headers only need <type_traits> for it.
+// Same rules: a member pointer is applied to an object, a reference to one, a
+// std::reference_wrapper (recognized through std::unwrap_reference, which is in <type_traits>)
+// or a pointer; anything else is called directly.
+template <typename Obj, typename Class>
+constexpr decltype(auto) MemberObject(Obj&& obj) noexcept {
+    using Raw = std::remove_cvref_t<Obj>;
+    if constexpr (std::is_base_of_v<Class, Raw>) {
+        return std::forward<Obj>(obj);
+    } else if constexpr (!std::is_same_v<std::unwrap_reference_t<Raw>, Raw>) {
+        return obj.get();
+    } else {
+        return *std::forward<Obj>(obj);
+    }
+}
+
+template <typename M, typename Class, typename Obj, typename... Args>
+constexpr decltype(auto) CallMember(M Class::*member, Obj&& obj, Args&&... args) {
+    if constexpr (std::is_function_v<M>) {
+        return (MemberObject<Obj, Class>(std::forward<Obj>(obj)).*member)(std::forward<Args>(args)...);
+    } else {
+        static_assert(sizeof...(Args) == 0, "a data member pointer takes only the object");
+        return (MemberObject<Obj, Class>(std::forward<Obj>(obj)).*member);
+    }
+}
+
+template <typename F, typename... Args> requires std::is_invocable_v<F, Args...>
+constexpr std::invoke_result_t<F, Args...> Call(F&& func, Args&&... args) noexcept(
+    std::is_nothrow_invocable_v<F, Args...>) {
+    if constexpr (std::is_member_pointer_v<std::remove_cvref_t<F>>) {
+        return CallMember(func, std::forward<Args>(args)...);
+    } else {
+        return std::forward<F>(func)(std::forward<Args>(args)...);
+    }
+}
+
+}  // namespace eav::detail
@@ -0,0 +1,50 @@
+#pragma once
+
+// Portability macros
+
+#if defined(__GNUC__) || defined(__clang__)
+#    define EAV_COLD __attribute__((cold))
+#    define EAV_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#    define EAV_COLD
+#    define EAV_NOINLINE __declspec(noinline)
+#else
+#    define EAV_COLD
+#    define EAV_NOINLINE
+#endif
+
+// Branch-layout hint: `cond` is expected to be `expected` (a bool constant)
+#if defined(__GNUC__) || defined(__clang__)
+#    define EAV_EXPECT(cond, expected) __builtin_expect(static_cast<bool>(cond), (expected))
+#else
+#    define EAV_EXPECT(cond, expected) static_cast<bool>(cond)
+#endif
+
+// Optimizer hint: `cond` holds (UB otherwise)
+#if defined(__clang__)
+#    define EAV_ASSUME(cond) __builtin_assume(cond)
+#elif defined(__GNUC__)
+#    define EAV_ASSUME(cond) (static_cast<bool>(cond) ? static_cast<void>(0) : __builtin_unreachable())
+#elif defined(_MSC_VER)
+#    define EAV_ASSUME(cond) __assume(cond)
+#else
+#    define EAV_ASSUME(cond) static_cast<void>(0)
+#endif
+
+// Terminates the program without a message (needs <cstdlib> on non-GNU compilers)
+#if defined(__GNUC__) || defined(__clang__)
+#    define EAV_TRAP() __builtin_trap()
+#else
+#    define EAV_TRAP() std::abort()
+#endif
+
+// GNU statement expressions: ({ stmt; ...; value; }) as an expression
+#if defined(__GNUC__) || defined(__clang__)
+#    define EAV_HAS_STATEMENT_EXPRESSIONS 1
+#else
+#    define EAV_HAS_STATEMENT_EXPRESSIONS 0
+#endif
+
+// Pastes two tokens after expanding them (EAV_CONCAT(name_, __LINE__))
+#define EAV_CONCAT_IMPL(a, b) a##b
+#define EAV_CONCAT(a, b) EAV_CONCAT_IMPL(a, b)
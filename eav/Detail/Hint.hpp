@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>  // std::forward
+
+#include "Compiler.hpp"
+
+namespace eav {
+
+// How often a combinator expects errors (its template argument: AndThen<BranchHint::kErrorsCommon>(f)).
+// Only the code layout depends on it, never the result.
+enum class BranchHint : std::uint8_t {
+    kErrorsRare,    // default: the error branch is unlikely and built out of line (cold)
+    kErrorsCommon,  // the error branch is likely, nothing is outlined
+    kNone,          // no hint: the compiler (or PGO) decides
+};
+
+}  // namespace eav
+
+namespace eav::detail {
+
+// `ok`, with the expectation of H attached
+template <BranchHint H>
+constexpr bool ExpectOk(bool ok) noexcept {
+    if constexpr (H == BranchHint::kErrorsRare) {
+        return EAV_EXPECT(ok, true);
+    } else if constexpr (H == BranchHint::kErrorsCommon) {
+        return EAV_EXPECT(ok, false);
+    } else {
+        return ok;
+    }
+}
+
+template <typename F>
+EAV_COLD EAV_NOINLINE constexpr decltype(auto) ColdCall(F&& func) {
+    return std::forward<F>(func)();
+}
+
+// Returns `make()`, which builds the output of an error branch. Under kErrorsRare it runs out of
+// line, in a cold function, so the hot path keeps only the call. A small trivially copyable
+// output is built inline anyway: it takes fewer instructions than the call.
+template <BranchHint H, typename F>
+constexpr decltype(auto) OnErrorPath(F&& make) {
+    using Out = std::remove_cvref_t<decltype(std::forward<F>(make)())>;
+    if constexpr (H == BranchHint::kErrorsRare &&
+                  !(std::is_trivially_copyable_v<Out> && sizeof(Out) <= 2 * sizeof(void*))) {
+        return ColdCall(std::forward<F>(make));
+    } else {
+        return std::forward<F>(make)();
+    }
+}
+
+}  // namespace eav::detail
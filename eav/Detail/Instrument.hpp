@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdint>
+
+// Error statistics by call site (see eav/Instrument.hpp). Off unless the whole program is
+// built with -DEAV_INSTRUMENT=1 (it must be the same in all translation units); when off, none
+// of the hooks below exist in the generated code.
+#ifndef EAV_INSTRUMENT
+#    define EAV_INSTRUMENT 0
+#endif
+
+#if EAV_INSTRUMENT
+#    include <source_location>
+#    include <type_traits>  // std::is_constant_evaluated, std::remove_cvref_t
+#    include <utility>      // std::forward
+
+// Trailing parameter of the instrumented entry points: the caller's location
+#    define EAV_SITE_PARAM , ::std::source_location eav_site = ::std::source_location::current()
+// The same in redeclarations and out-of-line definitions
+#    define EAV_SITE_PARAM_NODEFAULT , ::std::source_location eav_site
+// A combinator stage remembers where it was created
+#    define EAV_SITE_SLOT ::eav::detail::SiteSlot{eav_site}
+// Reports `event` for type T at `eav_site` (inside an entry point with EAV_SITE_PARAM)
+#    define EAV_REPORT(T, event) ::eav::detail::Report<T>(::eav::instrument::Event::event, eav_site)
+#else
+#    define EAV_SITE_PARAM
+#    define EAV_SITE_PARAM_NODEFAULT
+#    define EAV_SITE_SLOT ::eav::detail::SiteSlot{}
+#    define EAV_REPORT(T, event) static_cast<void>(0)
+#endif
+
+namespace eav::instrument {
+
+// What happened at a call site
+enum class Event : std::uint8_t {
+    kMakeErr,       // make::Err(...)
+    kFilter,        // a Filter stage rejected a value
+    kAndThen,       // an AndThen stage returned Err/None
+    kOrElse,        // an OrElse stage returned Err (the recovery failed)
+    kUnwrapMisuse,  // unwrap_*() on the wrong alternative (right before the panic)
+};
+
+}  // namespace eav::instrument
+
+#if EAV_INSTRUMENT
+#    include "../Instrument/Detail/Record.hpp"
+#endif
+
+namespace eav::detail {
+
+inline constexpr bool kInstrumented = EAV_INSTRUMENT != 0;
+
+#if EAV_INSTRUMENT
+
+// Stored in combinator stages: where the stage was created
+struct SiteSlot {
+    std::source_location site;
+
+    // Reports `event` for an error of type T at the stage's creation site
+    template <typename T>
+    constexpr void Report(instrument::Event event) const noexcept {
+        if (!std::is_constant_evaluated()) {
+            Record(event, site, TypeName<T>());
+        }
+    }
+
+    // Reports `event` if `out` (a Result or an Option) holds Err/None; passes `out` through
+    template <instrument::Event event, typename R>
+    constexpr R&& ReportIfEmpty(R&& out) const noexcept {
+        if constexpr (requires { out.is_err(); }) {
+            if (out.is_err()) {
+                Report<typename std::remove_cvref_t<R>::ErrType>(event);
+            }
+        } else {
+            if (!out.has_value()) {
+                Report<std::remove_cvref_t<R>>(event);
+            }
+        }
+        return std::forward<R>(out);
+    }
+};
+
+template <typename T>
+constexpr void Report(instrument::Event event, const std::source_location& site) noexcept {
+    if (!std::is_constant_evaluated()) {
+        Record(event, site, TypeName<T>());
+    }
+}
+
+#else
+
+struct SiteSlot {
+    template <typename T>
+    constexpr void Report(instrument::Event) const noexcept {}
+
+    template <instrument::Event, typename R>
+    constexpr R&& ReportIfEmpty(R&& out) const noexcept {
+        return static_cast<R&&>(out);
+    }
+};
+
+#endif
+
+}  // namespace eav::detail
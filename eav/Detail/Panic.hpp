@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <cstdio>   // std::fwrite, stderr
+#include <cstdlib>  // std::abort
+#include <string_view>
+
+#include "Compiler.hpp"
+
+// Bugs (e.g. .unwrap() on None) panic. The reaction is chosen at compile time and must be
+// the same in all translation units:
+#define EAV_PANIC_ABORT 0    // message to stderr + std::abort() (default)
+#define EAV_PANIC_HANDLER 1  // call the handler installed by eav::SetPanicHandler(), abort if it returns
+#define EAV_PANIC_TRAP 2     // trap instruction: no message, smallest code
+#define EAV_PANIC_THROW 3    // throw std::runtime_error(msg), for tests
+
+#ifndef EAV_PANIC_POLICY
+#    define EAV_PANIC_POLICY EAV_PANIC_ABORT
+#endif
+
+#if EAV_PANIC_POLICY == EAV_PANIC_THROW
+#    if !defined(__cpp_exceptions)
+#        error "EAV_PANIC_THROW requires exceptions"
+#    endif
+#    include <stdexcept>
+#    include <string>
+#endif
+
+namespace eav {
+
+// Called with the panic message; must not return (may throw or longjmp)
+using PanicHandler = void (*)(std::string_view msg);
+
+namespace detail {
+
+inline std::atomic<PanicHandler> panic_handler{nullptr};
+
+}  // namespace detail
+
+// Returns the previous handler
+inline PanicHandler SetPanicHandler(PanicHandler handler) noexcept {
+    return detail::panic_handler.exchange(handler);
+}
+
+namespace detail {
+
+// Out of line and cold: keeps the failure path out of the callers' hot code
+[[noreturn]] EAV_COLD EAV_NOINLINE inline void Panic(std::string_view msg) {
+#if EAV_PANIC_POLICY == EAV_PANIC_THROW
+    throw std::runtime_error(std::string(msg));
+#elif EAV_PANIC_POLICY == EAV_PANIC_TRAP
+    static_cast<void>(msg);
+    EAV_TRAP();
+#else
+#    if EAV_PANIC_POLICY == EAV_PANIC_HANDLER
+    if (PanicHandler handler = panic_handler.load(std::memory_order_acquire)) {
+        handler(msg);
+    }
+#    endif
+    std::fwrite("eav panic: ", 1, 11, stderr);
+    std::fwrite(msg.data(), 1, msg.size(), stderr);
+    std::fwrite("\n", 1, 1, stderr);
+    std::abort();
+#endif
+}
+
+}  // namespace detail
+
+}  // namespace eav
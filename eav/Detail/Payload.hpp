@@ -0,0 +1,133 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>     // std::nullptr_t
+#include <memory>      // std::addressof
+#include <type_traits>
+#include <utility>
+
+#include "../Traits/Niche.hpp"
+#include "Call.hpp"
+
+namespace eav::detail {
+
+// Result<T, E> and Option<T> keep their value as an object of type PayloadOf<T>:
+//   T     => T
+//   U&    => RefPayload<U>: a pointer that is never null, so null is its niche and
+//            sizeof(Option<U&>) == sizeof(Result<U&, NotFound>) == sizeof(U*)
+//   void  => Unit: stateless, so Result<void, E> is E + tag (just E if E's niche is invalid,
+//            see NicheTraits)
+// Accessors turn the stored object back into the payload (see Unwrap)
+
+// The value of a Result<void, E>
+struct Unit {
+    friend constexpr bool operator==(Unit, Unit) noexcept = default;
+};
+
+// Rebindable reference: assigning a Result<U&, E>/Option<U&> rebinds it, like a pointer
+template <typename U>
+class RefPayload {
+  private:  // data members:
+    U* ptr_;
+
+  public:  // member functions:
+    constexpr RefPayload(U& ref) noexcept : ptr_(std::addressof(ref)) {}  // NOLINT: implicit on purpose
+    RefPayload(U&&) = delete;  // never binds a temporary
+
+    constexpr U& get() const noexcept {
+        return *ptr_;
+    }
+
+  private:  // member functions:
+    constexpr explicit RefPayload(std::nullptr_t) noexcept : ptr_(nullptr) {}
+
+    friend struct NicheTraits<RefPayload<U>>;
+};
+
+template <typename T>
+struct PayloadFor {
+    using Type = T;
+};
+
+template <typename U>
+struct PayloadFor<U&> {
+    using Type = RefPayload<U>;
+};
+
+template <>
+struct PayloadFor<void> {
+    using Type = Unit;
+};
+
+template <typename T>
+using PayloadOf = typename PayloadFor<T>::Type;
+
+// The borrowed form of a payload type (Result::as_ref): const T&, U& for T = U&, void for void
+template <typename T>
+using BorrowOf = std::conditional_t<std::is_void_v<T>, void, std::add_lvalue_reference_t<const T>>;
+
+template <typename S>
+inline constexpr bool kIsRefPayload = false;
+
+template <typename U>
+inline constexpr bool kIsRefPayload<RefPayload<U>> = true;
+
+// Stored object => what the accessors return: U& for a RefPayload, nothing for a Unit, the
+// object itself (same value category) otherwise
+template <typename S>
+constexpr decltype(auto) Unwrap(S&& stored) noexcept {
+    if constexpr (kIsRefPayload<std::remove_cvref_t<S>>) {
+        return stored.get();
+    } else if constexpr (std::same_as<std::remove_cvref_t<S>, Unit>) {
+        return;
+    } else {
+        return std::forward<S>(stored);
+    }
+}
+
+// std::invoke for payloads: the Unit of a Result<void, E> is not passed on (a function applied
+// to it takes no arguments), and a function returning void produces a Unit
+template <typename F, typename... Args>
+constexpr decltype(auto) Invoke(F&& func, Args&&... args) {
+    if constexpr (sizeof...(Args) == 1 && (std::same_as<std::remove_cvref_t<Args>, Unit> && ...)) {
+        return Invoke(std::forward<F>(func));
+    } else if constexpr (std::is_void_v<std::invoke_result_t<F, Args...>>) {
+        Call(std::forward<F>(func), std::forward<Args>(args)...);
+        return Unit{};
+    } else {
+        return Call(std::forward<F>(func), std::forward<Args>(args)...);
+    }
+}
+
+// F applied to the value of a Result<T, E>: F() for T = void, F(T) otherwise
+template <typename F, typename T>
+concept InvocableOn = (std::is_void_v<T> && std::invocable<F>) || (!std::is_void_v<T> && std::invocable<F, T>);
+
+template <typename F, typename T>
+struct InvokeOn : std::invoke_result<F, T> {};
+
+template <typename F>
+struct InvokeOn<F, void> : std::invoke_result<F> {};
+
+template <typename F, typename T>
+using InvokeResultOn = typename InvokeOn<F, T>::type;
+
+}  // namespace eav::detail
+
+namespace eav {
+
+template <typename U>
+struct NicheTraits<detail::RefPayload<U>> {
+    static constexpr bool has_niche = true;
+    static constexpr bool none_is_invalid = true;
+
+    static constexpr detail::RefPayload<U> none() noexcept {
+        return detail::RefPayload<U>(nullptr);
+    }
+
+    static constexpr bool is_none(const detail::RefPayload<U>& val) noexcept {
+        return val.ptr_ == nullptr;
+    }
+};
+
+}  // namespace eav
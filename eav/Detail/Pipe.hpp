@@ -1,13 +1,26 @@
 #pragma once
 
+#include <type_traits>
+#include <utility>  // std::forward
+
 #include "../Concepts/PipeableWith.hpp"
+#include "Pipeline.hpp"
 
 namespace eav {
 
 template <typename R, typename C>
 requires(concepts::IsResult<R> && concepts::PipeableWith<C, R>)
-auto operator|(R&& res, C&& comb) {
+constexpr auto operator|(R&& res, C&& comb) {
     return std::forward<C>(comb).Pipe(std::forward<R>(res));
 }
 
+// A named or const source is borrowed (see detail::Borrow): it is still there afterwards
+template <typename R, typename C>
+requires(concepts::IsResult<std::remove_cvref_t<R>> &&
+         (std::is_lvalue_reference_v<R> || std::is_const_v<std::remove_reference_t<R>>) &&
+         detail::BorrowableWith<C, std::remove_cvref_t<R>>)
+constexpr auto operator|(R&& res, const C& comb) {
+    return detail::Borrow(comb, std::as_const(res));
+}
+
 }  // namespace eav
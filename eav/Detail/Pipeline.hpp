@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstddef>  // std::size_t
+#include <tuple>
+#include <type_traits>
+#include <utility>  // std::forward, std::move
+
+namespace eav::detail {
+
+// Type produced by the stage S (eager semantics) for an rvalue `In`
+template <typename S, typename In>
+using StageOutput =
+    std::remove_cvref_t<decltype(std::declval<std::remove_cvref_t<S>&>().Pipe(std::declval<In&&>()))>;
+
+// Type produced by applying `Stages...` one by one (eager semantics) to `In`
+template <typename In, typename Stages>
+struct FusedOutput;
+
+template <typename In>
+struct FusedOutput<In, std::tuple<>> {
+    using Type = In;
+};
+
+template <typename In, typename S, typename... Rest>
+struct FusedOutput<In, std::tuple<S, Rest...>> {
+    using Type = typename FusedOutput<StageOutput<S, In>, std::tuple<Rest...>>::Type;
+};
+
+// The branch hint of the first stage, the one applied to the source
+template <typename Stages>
+inline constexpr auto FirstHint = std::remove_cvref_t<std::tuple_element_t<0, Stages>>::kHint;
+
+// Lazy pipeline: `combinator | combinator | ...` without a source value composes the stages
+// into one callable. Applied to a Result/Option it runs in a single pass: every stage hands
+// its output to the next one by reference (continuation-passing), the first failure goes
+// straight to the error exit, and only the final Result/Option is materialized.
+// Stages are not consumed, so a pipeline can be built once and reused. A named (lvalue) or const
+// source is borrowed: see Borrow.
+template <typename Kind, typename... Stages>
+class Pipeline {
+  public:  // nested types:
+    using StageKind = Kind;
+
+  private:  // data members:
+    std::tuple<Stages...> stages_;
+
+  public:  // member functions:
+    constexpr explicit Pipeline(std::tuple<Stages...> stages) : stages_(std::move(stages)) {}
+
+    template <typename R> requires requires(const std::tuple<Stages...>& st, R&& src) {
+        Kind::Run(st, std::forward<R>(src));
+    }
+    constexpr auto Pipe(R&& src) const {
+        return Kind::Run(stages_, std::forward<R>(src));
+    }
+
+    constexpr const std::tuple<Stages...>& stages() const& noexcept {
+        return stages_;
+    }
+
+    constexpr std::tuple<Stages...>&& stages() && noexcept {
+        return std::move(stages_);
+    }
+};
+
+// A combinator (or a pipeline) that can take part in a lazy pipeline
+template <typename C>
+concept Composable = requires { typename std::remove_cvref_t<C>::StageKind; };
+
+template <typename C>
+constexpr auto AsStageTuple(C&& comb) {
+    using D = std::remove_cvref_t<C>;
+    if constexpr (requires { std::forward<C>(comb).stages(); }) {
+        return std::tuple_cat(std::forward<C>(comb).stages());
+    } else {
+        return std::tuple<D>(std::forward<C>(comb));
+    }
+}
+
+template <typename Kind, typename... Stages>
+constexpr auto MakePipeline(std::tuple<Stages...>&& stages) {
+    return Pipeline<Kind, Stages...>(std::move(stages));
+}
+
+// A combinator (or a pipeline) that takes a Result/Option of type R when it is an rvalue
+template <typename C, typename R>
+concept BorrowableWith = Composable<C> && requires(std::remove_cvref_t<C>& comb, R&& src) {
+    comb.Pipe(std::move(src));
+};
+
+// `source | combinator` for a named (lvalue) or const source: it is borrowed, not consumed. The
+// combinator runs as a one-stage lazy pipeline (Kind::Run for a const source), so a stage sees
+// the payload as `const T&`/`const E&` and only what ends up in the output is copied into it:
+// the value a Filter lets through, the error a MapOk passes on. The output type is the one the
+// combinator gives for an rvalue source; a function that takes its argument by rvalue reference
+// does not compile here, the value is not ours to move from.
+template <typename C, typename R>
+constexpr auto Borrow(const C& comb, const R& src) {
+    using Kind = typename C::StageKind;
+    if constexpr (requires { comb.stages(); }) {
+        return Kind::Run(comb.stages(), src);
+    } else {
+        return Kind::Run(std::tuple<const C&>(comb), src);
+    }
+}
+
+// combinator | combinator => Pipeline (found by ADL: every stage derives from a detail:: tag)
+template <typename A, typename B>
+requires(Composable<A> && Composable<B> &&
+         std::same_as<typename std::remove_cvref_t<A>::StageKind, typename std::remove_cvref_t<B>::StageKind>)
+constexpr auto operator|(A&& lhs, B&& rhs) {
+    using Kind = typename std::remove_cvref_t<A>::StageKind;
+    return MakePipeline<Kind>(std::tuple_cat(AsStageTuple(std::forward<A>(lhs)), AsStageTuple(std::forward<B>(rhs))));
+}
+
+}  // namespace eav::detail
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>  // std::declval
+
+namespace eav::detail {
+
+// Tag for the constructor of a storage from another storage (copy, move or PendingType upgrade)
+struct FromStorageTag {};
+
+// The layers below give a storage class `Payload` special members that are trivial exactly
+// when the ones of its payload types `Ts...` are, without C++20 constrained special members
+// (not supported by clang < 16). `Payload` must provide:
+//   Payload(FromStorageTag, const Payload&);  Payload(FromStorageTag, Payload&&);
+//   void assign_from(const Payload&);         void assign_from(Payload&&);
+//   void destroy() noexcept;
+// A layer is "custom" when all `Ts...` support the operation, but not trivially; otherwise
+// the implicit member of the layer below (trivial or deleted) is kept.
+
+template <typename... Ts>
+struct SpecialMemberTraits {
+    static constexpr bool custom_dtor = !(std::is_trivially_destructible_v<Ts> && ...);
+
+    static constexpr bool custom_copy_ctor =
+        (std::is_copy_constructible_v<Ts> && ...) &&
+        !(std::is_trivially_copy_constructible_v<Ts> && ...);
+
+    static constexpr bool custom_move_ctor =
+        (std::is_move_constructible_v<Ts> && ...) &&
+        !(std::is_trivially_move_constructible_v<Ts> && ...);
+
+    static constexpr bool custom_copy_assign =
+        (std::is_copy_constructible_v<Ts> && ...) && (std::is_copy_assignable_v<Ts> && ...) &&
+        !((std::is_trivially_copy_constructible_v<Ts> && ...) &&
+          (std::is_trivially_copy_assignable_v<Ts> && ...) &&
+          (std::is_trivially_destructible_v<Ts> && ...));
+
+    static constexpr bool custom_move_assign =
+        (std::is_move_constructible_v<Ts> && ...) && (std::is_move_assignable_v<Ts> && ...) &&
+        !((std::is_trivially_move_constructible_v<Ts> && ...) &&
+          (std::is_trivially_move_assignable_v<Ts> && ...) &&
+          (std::is_trivially_destructible_v<Ts> && ...));
+};
+
+// --- Destructor ---
+
+template <typename Base, bool Custom>
+struct DtorLayer : Base {
+    using Base::Base;
+};
+
+template <typename Base>
+struct DtorLayer<Base, true> : Base {
+    using Base::Base;
+
+    DtorLayer(const DtorLayer&) = default;
+    DtorLayer(DtorLayer&&) = default;
+    DtorLayer& operator=(const DtorLayer&) = default;
+    DtorLayer& operator=(DtorLayer&&) = default;
+
+    constexpr ~DtorLayer() {
+        this->destroy();
+    }
+};
+
+// --- Copy constructor ---
+
+template <typename Base, bool Custom>
+struct CopyCtorLayer : Base {
+    using Base::Base;
+};
+
+template <typename Base>
+struct CopyCtorLayer<Base, true> : Base {
+    using Base::Base;
+
+    constexpr CopyCtorLayer(const CopyCtorLayer& oth)
+        : Base(FromStorageTag{}, static_cast<const Base&>(oth)) {}
+
+    CopyCtorLayer(CopyCtorLayer&&) = default;
+    CopyCtorLayer& operator=(const CopyCtorLayer&) = default;
+    CopyCtorLayer& operator=(CopyCtorLayer&&) = default;
+};
+
+// --- Move constructor ---
+
+template <typename Base, bool Custom>
+struct MoveCtorLayer : Base {
+    using Base::Base;
+};
+
+template <typename Base>
+struct MoveCtorLayer<Base, true> : Base {
+    using Base::Base;
+
+    MoveCtorLayer(const MoveCtorLayer&) = default;
+
+    constexpr MoveCtorLayer(MoveCtorLayer&& oth) noexcept(std::is_nothrow_constructible_v<Base, FromStorageTag, Base&&>)
+        : Base(FromStorageTag{}, static_cast<Base&&>(oth)) {}
+
+    MoveCtorLayer& operator=(const MoveCtorLayer&) = default;
+    MoveCtorLayer& operator=(MoveCtorLayer&&) = default;
+};
+
+// --- Copy assignment ---
+
+template <typename Base, bool Custom>
+struct CopyAssignLayer : Base {
+    using Base::Base;
+};
+
+template <typename Base>
+struct CopyAssignLayer<Base, true> : Base {
+    using Base::Base;
+
+    CopyAssignLayer(const CopyAssignLayer&) = default;
+    CopyAssignLayer(CopyAssignLayer&&) = default;
+
+    constexpr CopyAssignLayer& operator=(const CopyAssignLayer& oth) {
+        if (this != &oth) {
+            this->assign_from(static_cast<const Base&>(oth));
+        }
+        return *this;
+    }
+
+    CopyAssignLayer& operator=(CopyAssignLayer&&) = default;
+};
+
+// --- Move assignment ---
+
+template <typename Base, bool Custom>
+struct MoveAssignLayer : Base {
+    using Base::Base;
+};
+
+template <typename Base>
+struct MoveAssignLayer<Base, true> : Base {
+    using Base::Base;
+
+    MoveAssignLayer(const MoveAssignLayer&) = default;
+    MoveAssignLayer(MoveAssignLayer&&) = default;
+    MoveAssignLayer& operator=(const MoveAssignLayer&) = default;
+
+    constexpr MoveAssignLayer& operator=(MoveAssignLayer&& oth) noexcept(
+        noexcept(std::declval<Base&>().assign_from(std::declval<Base&&>()))) {
+        if (this != &oth) {
+            this->assign_from(static_cast<Base&&>(oth));
+        }
+        return *this;
+    }
+};
+
+// A layer is applied only when it is custom: an empty layer adds nothing but keeps GCC from
+// splitting a small trivially copyable storage into registers (it returns it through the stack)
+template <template <typename, bool> class Layer, typename Base, bool Custom>
+using LayerIf = std::conditional_t<Custom, Layer<Base, true>, Base>;
+
+// Payload + the layers it needs
+template <typename Payload, typename... Ts>
+using WithSpecialMembers =
+    LayerIf<MoveAssignLayer,
+        LayerIf<CopyAssignLayer,
+            LayerIf<MoveCtorLayer,
+                LayerIf<CopyCtorLayer,
+                    LayerIf<DtorLayer, Payload, SpecialMemberTraits<Ts...>::custom_dtor>,
+                    SpecialMemberTraits<Ts...>::custom_copy_ctor>,
+                SpecialMemberTraits<Ts...>::custom_move_ctor>,
+            SpecialMemberTraits<Ts...>::custom_copy_assign>,
+        SpecialMemberTraits<Ts...>::custom_move_assign>;
+
+}  // namespace eav::detail
@@ -0,0 +1,199 @@
+#pragma once
+
+#include <algorithm>  // std::max
+#include <atomic>
+#include <cstddef>    // std::byte, std::size_t, std::max_align_t
+#include <cstdint>
+#include <memory>  // std::align
+#include <new>
+
+#include "Detail/ArenaGeneration.hpp"
+
+namespace eav {
+
+// Bump allocator for the context attached to errors (combine::result::Context). Nothing is
+// allocated until an error actually gets context; the first kInlineBytes come from the arena
+// itself, then from heap chunks of growing size, up to `max_bytes` in total (later context is
+// dropped and counted instead). Reset() makes all of it reusable without freeing: a server
+// resets once per request and reaches a steady state with no allocation at all.
+//
+// Every thread has one (ForThread()); ScopedContextArena substitutes a user-provided one.
+// An arena is used by one thread at a time and is not synchronized. Errors only refer to their
+// context, so it must be rendered on the thread that recorded it, before the arena is reset or
+// destroyed; elsewhere or afterwards WithContext reports it as expired instead of reading the
+// arena. The generation it checks lives outside the arena, so this holds after the arena is gone.
+class ContextArena {
+  public:  // nested types:
+    static constexpr std::size_t kInlineBytes = 1024;
+    static constexpr std::size_t kDefaultMaxBytes = std::size_t{1} << 20;
+
+  private:  // nested types:
+    struct Chunk {
+        Chunk* next;
+        std::size_t size;  // usable bytes after the header
+    };
+
+  private:  // data members:
+    alignas(std::max_align_t) std::byte inline_[kInlineBytes];
+    std::byte* cur_ = inline_;
+    std::byte* end_ = inline_ + kInlineBytes;
+    Chunk* chunks_ = nullptr;  // all heap chunks, in allocation order
+    Chunk* active_ = nullptr;  // chunk that `cur_` points into (nullptr: the inline buffer)
+    std::size_t max_bytes_;
+    std::size_t heap_bytes_ = 0;
+    detail::ArenaGeneration* generation_ = detail::ArenaGeneration::Acquire();
+    std::uint64_t dropped_ = 0;
+
+  public:  // member functions:
+    explicit ContextArena(std::size_t max_bytes = kDefaultMaxBytes) noexcept : max_bytes_(max_bytes) {}
+
+    ContextArena(const ContextArena&) = delete;
+    ContextArena& operator=(const ContextArena&) = delete;
+
+    ~ContextArena() {
+        Release();
+        detail::ArenaGeneration::Retire(generation_);
+    }
+
+    // nullptr if the budget is exhausted (or the heap is)
+    void* Allocate(std::size_t size, std::size_t align) noexcept {
+        if (void* ptr = BumpIn(cur_, end_, size, align)) {
+            return ptr;
+        }
+        return AllocateSlow(size, align);
+    }
+
+    // Makes the whole arena reusable; context allocated before is expired from now on
+    void Reset() noexcept {
+        cur_ = inline_;
+        end_ = inline_ + kInlineBytes;
+        active_ = nullptr;
+        generation_->Advance();
+    }
+
+    // Reset() and give the heap chunks back
+    void Release() noexcept {
+        Reset();
+        while (chunks_ != nullptr) {
+            Chunk* next = chunks_->next;
+            ::operator delete(static_cast<void*>(chunks_));
+            chunks_ = next;
+        }
+        heap_bytes_ = 0;
+    }
+
+    std::uint64_t generation() const noexcept {
+        return generation_->load();
+    }
+
+    // Where generation() is kept; stays readable after the arena is destroyed
+    const detail::ArenaGeneration& generation_token() const noexcept {
+        return *generation_;
+    }
+
+    // Bytes taken from the heap so far (kept across Reset())
+    std::size_t heap_bytes() const noexcept {
+        return heap_bytes_;
+    }
+
+    // Context frames dropped because the budget was exhausted
+    std::uint64_t dropped() const noexcept {
+        return dropped_;
+    }
+
+    void CountDropped() noexcept {
+        ++dropped_;
+    }
+
+    // The arena of the calling thread: its own unless a ScopedContextArena is active
+    static ContextArena& ForThread() noexcept {
+        return *Current();
+    }
+
+    // Number of the calling thread, never reused (unlike std::thread::id): context recorded by
+    // a thread that has exited, whose own arena is gone, is never mistaken for the caller's
+    static std::uint64_t ThreadSerial() noexcept {
+        static std::atomic<std::uint64_t> next{0};
+        thread_local const std::uint64_t serial = next.fetch_add(1, std::memory_order_relaxed) + 1;
+        return serial;
+    }
+
+  private:
+    static void* BumpIn(std::byte*& cur, std::byte* end, std::size_t size, std::size_t align) noexcept {
+        void* ptr = cur;
+        std::size_t space = static_cast<std::size_t>(end - cur);
+        if (std::align(align, size, ptr, space) == nullptr) {
+            return nullptr;
+        }
+        cur = static_cast<std::byte*>(ptr) + size;
+        return ptr;
+    }
+
+    void* AllocateSlow(std::size_t size, std::size_t align) noexcept {
+        // Reuse the chunks kept by Reset(): they are in `chunks_` after the active one
+        Chunk* next = active_ != nullptr ? active_->next : chunks_;
+        for (; next != nullptr; next = next->next) {
+            std::byte* data = reinterpret_cast<std::byte*>(next + 1);
+            std::byte* cur = data;
+            if (void* ptr = BumpIn(cur, data + next->size, size, align)) {
+                active_ = next;
+                cur_ = cur;
+                end_ = data + next->size;
+                return ptr;
+            }
+        }
+
+        // A new chunk, twice as large as the last one, appended after it (so that after a
+        // Reset() the chunks are reused smallest first)
+        Chunk** link = &chunks_;
+        std::size_t last = kInlineBytes;
+        while (*link != nullptr) {
+            last = (*link)->size;
+            link = &(*link)->next;
+        }
+        const std::size_t chunk_size = std::max(last * 2, size + align);
+        if (heap_bytes_ + chunk_size > max_bytes_) {
+            return nullptr;
+        }
+        void* raw = ::operator new(sizeof(Chunk) + chunk_size, std::nothrow);
+        if (raw == nullptr) {
+            return nullptr;
+        }
+        heap_bytes_ += chunk_size;
+        Chunk* chunk = ::new (raw) Chunk{nullptr, chunk_size};
+        *link = chunk;
+        active_ = chunk;
+        std::byte* data = reinterpret_cast<std::byte*>(chunk + 1);
+        cur_ = data;
+        end_ = data + chunk_size;
+        return BumpIn(cur_, end_, size, align);
+    }
+
+    static ContextArena*& Current() noexcept {
+        thread_local ContextArena own;
+        thread_local ContextArena* current = &own;
+        return current;
+    }
+
+    friend class ScopedContextArena;
+};
+
+// Routes the calling thread's error context to `arena` until the end of the scope
+class ScopedContextArena {
+  private:  // data members:
+    ContextArena* prev_;
+
+  public:  // member functions:
+    explicit ScopedContextArena(ContextArena& arena) noexcept : prev_(ContextArena::Current()) {
+        ContextArena::Current() = &arena;
+    }
+
+    ScopedContextArena(const ScopedContextArena&) = delete;
+    ScopedContextArena& operator=(const ScopedContextArena&) = delete;
+
+    ~ScopedContextArena() {
+        ContextArena::Current() = prev_;
+    }
+};
+
+}  // namespace eav
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <new>
+
+namespace eav::detail {
+
+// The generation of a ContextArena, in a cell the arena does not own. Cells are never freed:
+// a destroyed arena gives its cell back for a later arena, so WithContext can still compare its
+// generation after the arena is gone. Generations are unique across all arenas and cells, so a
+// cell never returns to a value it held before, whichever arena it belongs to now.
+class ArenaGeneration {
+  private:  // data members:
+    std::atomic<std::uint64_t> value_{Next()};
+    ArenaGeneration* next_free_ = nullptr;
+
+    inline static std::mutex mutex_;  // guards free_
+    inline static ArenaGeneration* free_ = nullptr;
+    static ArenaGeneration fallback_;  // shared by arenas created while the heap is exhausted
+
+  public:  // member functions:
+    std::uint64_t load() const noexcept {
+        return value_.load(std::memory_order_acquire);
+    }
+
+    // Expires everything recorded under the current generation
+    void Advance() noexcept {
+        value_.store(Next(), std::memory_order_release);
+    }
+
+    // A cell with a fresh generation, for a new arena
+    static ArenaGeneration* Acquire() noexcept {
+        ArenaGeneration* cell = nullptr;
+        {
+            std::lock_guard lock(mutex_);
+            if (free_ != nullptr) {
+                cell = free_;
+                free_ = cell->next_free_;
+            }
+        }
+        if (cell != nullptr) {
+            cell->Advance();
+            return cell;
+        }
+        if ((cell = new (std::nothrow) ArenaGeneration) != nullptr) {
+            return cell;
+        }
+        // Arenas sharing a cell expire each other's context on Reset(): wasteful, never unsafe
+        return &fallback_;
+    }
+
+    // Expires everything recorded in the arena that held `cell`, and keeps it for a later one
+    static void Retire(ArenaGeneration* cell) noexcept {
+        cell->Advance();
+        if (cell == &fallback_) {
+            return;
+        }
+        std::lock_guard lock(mutex_);
+        cell->next_free_ = free_;
+        free_ = cell;
+    }
+
+  private:
+    static std::uint64_t Next() noexcept {
+        static std::atomic<std::uint64_t> next{0};
+        return next.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+};
+
+inline ArenaGeneration ArenaGeneration::fallback_;
+
+}  // namespace eav::detail
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uintptr_t
+
+#include "../../Detail/Compiler.hpp"
+
+#if defined(__linux__) && (defined(__GNUC__) || defined(__clang__))
+#    include <pthread.h>
+#    define EAV_HAS_FRAME_WALK 1
+#else
+#    define EAV_HAS_FRAME_WALK 0
+#endif
+
+namespace eav {
+
+// Which errors get a backtrace (Traced<E>); process-wide, changeable at any time
+enum class TraceSampling : std::uint8_t {
+    kAlways,        // every error
+    kNever,         // none (the error is still wrapped)
+    kEveryN,        // one error in N, counted per thread
+    kFirstPerSite,  // the first error created at each call site
+};
+
+namespace detail {
+
+struct TraceConfig {
+    inline static std::atomic<TraceSampling> mode{TraceSampling::kAlways};
+    inline static std::atomic<std::uint32_t> every_n{1};
+};
+
+// Return addresses, innermost first; not symbolized
+struct RawBacktrace {
+    static constexpr std::size_t kMaxFrames = 16;
+
+    std::array<void*, kMaxFrames> frames;
+    std::uint8_t size = 0;
+};
+
+#if EAV_HAS_FRAME_WALK
+
+// Bounds of the calling thread's stack, looked up once per thread: the walk never reads
+// outside of them, even through a frame built without a frame pointer
+struct StackBounds {
+    std::uintptr_t low = 0;
+    std::uintptr_t high = 0;
+};
+
+inline StackBounds ThreadStack() noexcept {
+    thread_local const StackBounds bounds = [] {
+        StackBounds out;
+        pthread_attr_t attr;
+        if (pthread_getattr_np(pthread_self(), &attr) == 0) {
+            void* addr = nullptr;
+            std::size_t size = 0;
+            if (pthread_attr_getstack(&attr, &addr, &size) == 0) {
+                out.low = reinterpret_cast<std::uintptr_t>(addr);
+                out.high = out.low + size;
+            }
+            pthread_attr_destroy(&attr);
+        }
+        return out;
+    }();
+    return bounds;
+}
+
+// Frame-pointer walk: every frame starts with {caller's frame pointer, return address}. Exact
+// with -fno-omit-frame-pointer; otherwise it stops early (or records a stale address) at the
+// first frame without one. The first address is the one this call returns to.
+EAV_NOINLINE inline void CaptureFrames(RawBacktrace& out) noexcept {
+    const StackBounds stack = ThreadStack();
+    auto* fp = static_cast<void* const*>(__builtin_frame_address(0));
+    std::size_t n = 0;
+    while (n < RawBacktrace::kMaxFrames) {
+        const auto addr = reinterpret_cast<std::uintptr_t>(fp);
+        if (addr < stack.low || addr + 2 * sizeof(void*) > stack.high || addr % alignof(void*) != 0) {
+            break;
+        }
+        void* ret = fp[1];
+        if (ret == nullptr) {
+            break;
+        }
+        out.frames[n++] = ret;
+        auto* next = static_cast<void* const*>(fp[0]);
+        if (next <= fp) {  // callers live at higher addresses
+            break;
+        }
+        fp = next;
+    }
+    out.size = static_cast<std::uint8_t>(n);
+}
+
+// First error at call site `key` (non-zero)? A fixed open-addressing set of call sites; when
+// it is full, sites that do not fit are never traced
+inline bool FirstAtSite(std::uintptr_t key) noexcept {
+    static constexpr std::size_t kSlots = 4096;
+    static constexpr std::size_t kProbes = 16;
+    static std::array<std::atomic<std::uintptr_t>, kSlots> seen{};
+
+    std::size_t slot = (key * 0x9E3779B97F4A7C15ULL) >> 52;  // top 12 bits: 4096 slots
+    for (std::size_t probe = 0; probe < kProbes; ++probe, slot = (slot + 1) % kSlots) {
+        std::uintptr_t cur = seen[slot].load(std::memory_order_relaxed);
+        if (cur == key) {
+            return false;
+        }
+        if (cur == 0 && seen[slot].compare_exchange_strong(cur, key, std::memory_order_relaxed)) {
+            return true;
+        }
+        if (cur == key) {
+            return false;
+        }
+    }
+    return false;
+}
+
+// Captures into `out` if the sampling policy says so (`site`: a key of the call site creating
+// the error); `out` stays empty otherwise. Inlined, so the trace starts where it is called
+// from (a tail call from there would hide one more frame).
+inline void MaybeCapture(RawBacktrace& out, std::uintptr_t site) noexcept {
+    switch (TraceConfig::mode.load(std::memory_order_relaxed)) {
+        case TraceSampling::kAlways:
+            break;
+        case TraceSampling::kNever:
+            return;
+        case TraceSampling::kEveryN: {
+            thread_local std::uint32_t countdown = 0;
+            if (countdown != 0) {
+                --countdown;
+                return;
+            }
+            countdown = TraceConfig::every_n.load(std::memory_order_relaxed) - 1;
+            break;
+        }
+        case TraceSampling::kFirstPerSite:
+            if (!FirstAtSite(site)) {
+                return;
+            }
+            break;
+    }
+    CaptureFrames(out);
+}
+
+#else
+
+inline void MaybeCapture(RawBacktrace&, std::uintptr_t) noexcept {}
+
+#endif
+
+}  // namespace detail
+
+// kEveryN with n = 0 is treated as 1
+inline void SetTraceSampling(TraceSampling mode, std::uint32_t every_n = 1) noexcept {
+    detail::TraceConfig::every_n.store(every_n == 0 ? 1 : every_n, std::memory_order_relaxed);
+    detail::TraceConfig::mode.store(mode, std::memory_order_relaxed);
+}
+
+}  // namespace eav
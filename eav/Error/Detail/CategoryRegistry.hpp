@@ -0,0 +1,49 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "../../Detail/Panic.hpp"
+#include "../../Traits/ErrorCategory.hpp"
+
+namespace eav::detail {
+
+// Process-wide table of the categories in use: id -> descriptor. A category gets its id the
+// first time one of its codes is made (never again after that), so ids depend on the order of
+// first use and must not be persisted; id 0 is the category of a default-constructed ErrorCode.
+class CategoryRegistry {
+  public:  // nested types:
+    static constexpr std::size_t kMaxCategories = 1024;
+
+  private:  // data members:
+    static constexpr std::string_view kGenericMessages[] = {"no error"};
+    static constexpr ErrorCategory kGeneric{"generic", kGenericMessages};
+
+    inline static std::array<std::atomic<const ErrorCategory*>, kMaxCategories> slots_{};
+    inline static std::atomic<std::uint32_t> size_{1};
+
+  public:  // member functions:
+    static std::uint32_t Register(const ErrorCategory& category) {
+        const std::uint32_t id = size_.fetch_add(1, std::memory_order_relaxed);
+        if (id >= kMaxCategories) [[unlikely]] {
+            Panic("too many error categories registered");
+        }
+        slots_[id].store(&category, std::memory_order_release);
+        return id;
+    }
+
+    static const ErrorCategory& Get(std::uint32_t id) noexcept {
+        const ErrorCategory* category = slots_[id].load(std::memory_order_acquire);
+        return category != nullptr ? *category : kGeneric;
+    }
+};
+
+// The id of Enum's category; registered on first use (a guarded static: one load afterwards)
+template <concepts::IsErrorEnum Enum>
+std::uint32_t CategoryId() {
+    static const std::uint32_t id = CategoryRegistry::Register(ErrorCategoryTraits<Enum>::category);
+    return id;
+}
+
+}  // namespace eav::detail
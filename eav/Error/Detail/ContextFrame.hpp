@@ -0,0 +1,105 @@
+#pragma once
+
+#include <concepts>
+#include <cstring>  // std::memcpy
+#include <new>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../ContextArena.hpp"
+#include "Format.hpp"
+
+namespace eav::detail {
+
+// Types a context argument may have: copied into the arena and formatted only when displayed
+template <typename T>
+concept ContextArg = StringLike<T> || std::is_arithmetic_v<T> || std::is_enum_v<T> ||
+                     (HasToString<T> && std::is_trivially_copyable_v<T>);
+
+// Replaces the next "{}" of `fmt` with `arg`; an argument without a placeholder is ignored
+template <typename T>
+void AppendNext(std::string& out, std::string_view& fmt, const T& arg) {
+    const std::size_t pos = fmt.find("{}");
+    if (pos == std::string_view::npos) {
+        return;
+    }
+    out += fmt.substr(0, pos);
+    AppendFormatted(out, arg);
+    fmt.remove_prefix(pos + 2);
+}
+
+// --- Frames ---
+
+// One context message, recorded in a ContextArena: the format string and its arguments, as
+// they were when the error passed by. Frames form a list, the most recent first.
+struct ContextFrame {
+    const ContextFrame* prev;
+    void (*render)(const ContextFrame& self, std::string& out);
+};
+
+// How an argument is kept in a frame: strings as views of arena copies, the rest as is
+template <typename T>
+using StoredArg = std::conditional_t<StringLike<T>, std::string_view, T>;
+
+// How an argument is kept in a Context stage until it runs: strings as owned copies (a stored
+// pipeline outlives the strings it was built from), the rest as is
+template <typename T>
+using StageArg = std::conditional_t<StringLike<T>, std::string, T>;
+
+template <typename... Stored>
+struct FormatFrame : ContextFrame {
+    std::string_view fmt;
+    std::tuple<Stored...> args;
+
+    static void Render(const ContextFrame& self, std::string& out) {
+        const auto& frame = static_cast<const FormatFrame&>(self);
+        std::string_view rest = frame.fmt;
+        std::apply([&](const auto&... arg) { (AppendNext(out, rest, arg), ...); }, frame.args);
+        out += rest;
+    }
+};
+
+// Keeps `src` in a frame: a string is copied into the arena (false if it is full)
+template <typename T>
+bool StoreArg(ContextArena& arena, const T& src, StoredArg<T>& dst) noexcept {
+    if constexpr (StringLike<T>) {
+        const std::string_view view(src);
+        if (view.empty()) {
+            dst = {};
+            return true;
+        }
+        void* mem = arena.Allocate(view.size(), 1);
+        if (mem == nullptr) {
+            return false;
+        }
+        std::memcpy(mem, view.data(), view.size());
+        dst = std::string_view(static_cast<const char*>(mem), view.size());
+        return true;
+    } else {
+        dst = src;
+        return true;
+    }
+}
+
+// Records "fmt with args" on top of `prev`; nullptr if the arena is out of budget
+template <typename... Args>
+const ContextFrame* PushFrame(ContextArena& arena, const ContextFrame* prev, std::string_view fmt,
+                              const Args&... args) noexcept {
+    using Frame = FormatFrame<StoredArg<Args>...>;
+    static_assert(std::is_trivially_destructible_v<Frame>, "eav: context arguments are never destroyed");
+
+    void* mem = arena.Allocate(sizeof(Frame), alignof(Frame));
+    if (mem == nullptr) {
+        return nullptr;
+    }
+    Frame* frame = ::new (mem) Frame{{prev, &Frame::Render}, fmt, {}};
+    const bool stored = [&]<std::size_t... I>(std::index_sequence<I...>) {
+        return (StoreArg(arena, args, std::get<I>(frame->args)) && ...);
+    }(std::index_sequence_for<Args...>{});
+    return stored ? frame : nullptr;
+}
+
+}  // namespace eav::detail
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <charconv>  // std::to_chars
+#include <concepts>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Text form of error values and context arguments, without <format>/<sstream>
+
+namespace eav::detail {
+
+template <typename T>
+concept StringLike = std::convertible_to<const T&, std::string_view>;
+
+template <typename T>
+concept HasToString = requires(const T& val) {
+    { val.to_string() } -> std::convertible_to<std::string>;
+};
+
+template <typename T>
+void AppendFormatted(std::string& out, const T& val) {
+    if constexpr (StringLike<T>) {
+        out += std::string_view(val);
+    } else if constexpr (std::same_as<T, bool>) {
+        out += val ? "true" : "false";
+    } else if constexpr (std::same_as<T, char>) {
+        out += val;
+    } else if constexpr (std::is_arithmetic_v<T>) {
+        char buf[64];
+        const auto [end, ec] = std::to_chars(buf, buf + sizeof(buf), val);
+        out.append(buf, ec == std::errc() ? end : buf);
+    } else if constexpr (std::is_enum_v<T>) {
+        AppendFormatted(out, static_cast<std::underlying_type_t<T>>(val));
+    } else if constexpr (HasToString<T>) {
+        out += val.to_string();
+    } else {
+        out += "<error>";  // an error type with no textual form
+    }
+}
+
+}  // namespace eav::detail
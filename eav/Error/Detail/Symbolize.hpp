@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>  // std::uintptr_t
+#include <cstdlib>  // std::free
+#include <string>
+
+#include "Format.hpp"
+
+#if __has_include(<dlfcn.h>) && __has_include(<cxxabi.h>)
+#    include <cxxabi.h>
+#    include <dlfcn.h>
+#    define EAV_HAS_DLADDR 1
+#else
+#    define EAV_HAS_DLADDR 0
+#endif
+
+namespace eav::detail {
+
+inline void AppendHex(std::string& out, std::uintptr_t val) {
+    char buf[2 + 2 * sizeof(val)];
+    const auto [end, ec] = std::to_chars(buf, buf + sizeof(buf), val, 16);
+    out += "0x";
+    out.append(buf, end);
+}
+
+// "0x... in Function+0x12 (module)" for a return address, from the dynamic symbol table:
+// functions of the executable need -rdynamic (CMake: ENABLE_EXPORTS) to get a name
+inline void AppendSymbolized(std::string& out, const void* ret) {
+    const auto addr = reinterpret_cast<std::uintptr_t>(ret);
+    AppendHex(out, addr);
+#if EAV_HAS_DLADDR
+    // a return address may be one past the end of the caller: look up the call instruction
+    Dl_info info;
+    if (dladdr(reinterpret_cast<const void*>(addr - 1), &info) == 0) {
+        return;
+    }
+    if (info.dli_sname != nullptr) {
+        out += " in ";
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+        out += status == 0 && demangled != nullptr ? demangled : info.dli_sname;
+        std::free(demangled);
+        out += '+';
+        AppendHex(out, addr - reinterpret_cast<std::uintptr_t>(info.dli_saddr));
+    }
+    if (info.dli_fname != nullptr) {
+        out += " (";
+        out += info.dli_fname;
+        out += ')';
+    }
+#endif
+}
+
+}  // namespace eav::detail
@@ -0,0 +1,260 @@
+#pragma once
+
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint8_t
+#include <memory>       // std::construct_at, std::destroy_at
+#include <type_traits>
+#include <utility>      // std::in_place_index_t, std::forward, std::move
+
+#include "../../Detail/Pending.hpp"
+#include "../../Detail/SpecialMembers.hpp"
+
+namespace eav {
+
+template <typename... Es>
+class FlatErrorUnion;
+
+}  // namespace eav
+
+namespace eav::detail {
+
+// --- The set of alternatives: flattened, deduplicated, in order of first appearance ---
+
+template <typename... Ts>
+struct TypeList {};
+
+template <typename T>
+inline constexpr bool kIsErrorUnion = false;
+
+template <typename... Es>
+inline constexpr bool kIsErrorUnion<FlatErrorUnion<Es...>> = true;
+
+template <typename List, typename T>
+struct AppendUnique;
+
+template <typename... Ts, typename T>
+struct AppendUnique<TypeList<Ts...>, T> {
+    using Type = std::conditional_t<(std::same_as<T, Ts> || ...), TypeList<Ts...>, TypeList<Ts..., T>>;
+};
+
+// PendingType (an error not typed yet) adds nothing
+template <typename List, typename E>
+struct AppendError : AppendUnique<List, std::remove_cvref_t<E>> {};
+
+template <typename List>
+struct AppendError<List, PendingType> {
+    using Type = List;
+};
+
+template <typename List, typename... Es>
+struct AppendErrors {
+    using Type = List;
+};
+
+template <typename List, typename E, typename... Rest>
+struct AppendErrors<List, E, Rest...> : AppendErrors<typename AppendError<List, E>::Type, Rest...> {};
+
+// A nested union is expanded in place
+template <typename List, typename... Es, typename... Rest>
+struct AppendErrors<List, FlatErrorUnion<Es...>, Rest...> : AppendErrors<List, Es..., Rest...> {};
+
+template <typename List, typename E, typename... Rest> requires kIsErrorUnion<std::remove_cvref_t<E>> && (!std::same_as<E, std::remove_cvref_t<E>>)
+struct AppendErrors<List, E, Rest...> : AppendErrors<List, std::remove_cvref_t<E>, Rest...> {};
+
+template <typename... Es>
+using ErrorSet = typename AppendErrors<TypeList<>, Es...>::Type;
+
+template <typename List>
+struct UnionFromSet;
+
+template <typename... Es>
+struct UnionFromSet<TypeList<Es...>> {
+    using Type = FlatErrorUnion<Es...>;
+};
+
+// The error type that holds any of `Es...`: the only one left after flattening and removing
+// duplicates (PendingType if none is), a FlatErrorUnion of them otherwise
+template <typename List>
+struct MergeFromSet {
+    using Type = typename UnionFromSet<List>::Type;
+};
+
+template <>
+struct MergeFromSet<TypeList<>> {
+    using Type = PendingType;
+};
+
+template <typename E>
+struct MergeFromSet<TypeList<E>> {
+    using Type = E;
+};
+
+template <typename... Es>
+using MergedError = typename MergeFromSet<ErrorSet<Es...>>::Type;
+
+template <typename T, typename... Ts>
+inline constexpr std::size_t kIndexOf = 0;
+
+template <typename T, typename Head, typename... Ts>
+inline constexpr std::size_t kIndexOf<T, Head, Ts...> = std::same_as<T, Head> ? 0 : 1 + kIndexOf<T, Ts...>;
+
+// func(std::integral_constant<std::size_t, I>{}) for I == idx (< N); a chain of compares that the
+// optimizer turns into a jump table
+template <std::size_t N, std::size_t I = 0, typename F>
+constexpr decltype(auto) DispatchIndex(std::size_t idx, F&& func) {
+    if constexpr (I + 1 >= N) {
+        return std::forward<F>(func)(std::integral_constant<std::size_t, I>{});
+    } else {
+        if (idx == I) {
+            return std::forward<F>(func)(std::integral_constant<std::size_t, I>{});
+        }
+        return DispatchIndex<N, I + 1>(idx, std::forward<F>(func));
+    }
+}
+
+// --- Storage: a union of the alternatives + 1-byte tag ---
+
+// One alternative per level; the destructor is trivial if the ones of all alternatives are
+template <bool Trivial, typename... Ts>
+union UnionCells {
+    char none_;
+
+    constexpr UnionCells() noexcept : none_() {}
+};
+
+template <typename T, typename... Rest>
+union UnionCells<true, T, Rest...> {
+    char none_;
+    T head_;
+    UnionCells<true, Rest...> tail_;
+
+    constexpr UnionCells() noexcept : none_() {}
+
+    template <typename... Args>
+    constexpr explicit UnionCells(std::in_place_index_t<0>, Args&&... args) : head_(std::forward<Args>(args)...) {}
+
+    template <std::size_t I, typename... Args> requires(I > 0)
+    constexpr explicit UnionCells(std::in_place_index_t<I>, Args&&... args)
+        : tail_(std::in_place_index<I - 1>, std::forward<Args>(args)...) {}
+};
+
+template <typename T, typename... Rest>
+union UnionCells<false, T, Rest...> {
+    char none_;
+    T head_;
+    UnionCells<false, Rest...> tail_;
+
+    constexpr UnionCells() noexcept : none_() {}
+
+    template <typename... Args>
+    constexpr explicit UnionCells(std::in_place_index_t<0>, Args&&... args) : head_(std::forward<Args>(args)...) {}
+
+    template <std::size_t I, typename... Args> requires(I > 0)
+    constexpr explicit UnionCells(std::in_place_index_t<I>, Args&&... args)
+        : tail_(std::in_place_index<I - 1>, std::forward<Args>(args)...) {}
+
+    constexpr ~UnionCells() {}
+};
+
+template <std::size_t I, typename Cells>
+constexpr auto& CellAt(Cells& cells) noexcept {
+    if constexpr (I == 0) {
+        return cells.head_;
+    } else {
+        return CellAt<I - 1>(cells.tail_);
+    }
+}
+
+template <typename... Ts>
+class ErrorUnionPayload {
+  private:  // data members:
+    UnionCells<(std::is_trivially_destructible_v<Ts> && ...), Ts...> cells_;
+    std::uint8_t index_;
+
+  public:  // member functions:
+    template <std::size_t I, typename... Args>
+    constexpr explicit ErrorUnionPayload(std::in_place_index_t<I> tag, Args&&... args)
+        : cells_(tag, std::forward<Args>(args)...), index_(I) {}
+
+    // `oth` is a payload whose alternatives are a subset of Ts... (the same payload when copied
+    // or moved)
+    template <typename Oth>
+    constexpr ErrorUnionPayload(FromStorageTag, Oth&& oth) noexcept(NothrowFrom<Oth>()) : index_() {
+        oth.visit_index([&](auto idx) {
+            constexpr std::size_t kTo = kIndexOf<std::remove_cvref_t<decltype(oth.template get<idx>())>, Ts...>;
+            std::construct_at(&CellAt<kTo>(cells_), std::forward<Oth>(oth).template get<idx>());
+            index_ = static_cast<std::uint8_t>(kTo);
+        });
+    }
+
+    constexpr std::size_t index() const noexcept {
+        return index_;
+    }
+
+    template <std::size_t I>
+    constexpr auto& get() & noexcept {
+        return CellAt<I>(cells_);
+    }
+
+    template <std::size_t I>
+    constexpr const auto& get() const& noexcept {
+        return CellAt<I>(cells_);
+    }
+
+    template <std::size_t I>
+    constexpr auto&& get() && noexcept {
+        return std::move(CellAt<I>(cells_));
+    }
+
+    // func(std::integral_constant<std::size_t, index()>{})
+    template <typename F>
+    constexpr decltype(auto) visit_index(F&& func) const {
+        return DispatchIndex<sizeof...(Ts)>(index_, std::forward<F>(func));
+    }
+
+    constexpr void destroy() noexcept {
+        visit_index([&](auto idx) { std::destroy_at(&CellAt<idx>(cells_)); });
+    }
+
+    template <typename Oth>
+    constexpr void assign_from(Oth&& oth) noexcept(NothrowFrom<Oth>() && (std::is_nothrow_move_assignable_v<Ts> && ...)) {
+        if (index_ == oth.index()) {
+            visit_index([&](auto idx) { CellAt<idx>(cells_) = std::forward<Oth>(oth).template get<idx>(); });
+            return;
+        }
+        oth.visit_index([&](auto idx) {
+            using New = std::remove_cvref_t<decltype(oth.template get<idx>())>;
+            if constexpr (std::is_nothrow_constructible_v<New, decltype(std::forward<Oth>(oth).template get<idx>())>) {
+                destroy();
+                std::construct_at(&CellAt<idx>(cells_), std::forward<Oth>(oth).template get<idx>());
+            } else {
+                static_assert(std::is_nothrow_move_constructible_v<New>,
+                              "eav::ErrorUnion: assigning an alternative that may throw on construction requires "
+                              "it to be nothrow move constructible");
+                New tmp(std::forward<Oth>(oth).template get<idx>());
+                destroy();
+                std::construct_at(&CellAt<idx>(cells_), std::move(tmp));
+            }
+            index_ = static_cast<std::uint8_t>(idx());
+        });
+    }
+
+  private:  // member functions:
+    template <typename Oth>
+    static constexpr bool NothrowFrom() {
+        using O = std::remove_cvref_t<Oth>;
+        return []<std::size_t... I>(std::index_sequence<I...>) {
+            return (std::is_nothrow_constructible_v<std::remove_cvref_t<decltype(std::declval<O&>().template get<I>())>,
+                                                    decltype(std::declval<Oth>().template get<I>())> &&
+                    ...);
+        }(std::make_index_sequence<O::kSize>{});
+    }
+
+  public:  // nested constants:
+    static constexpr std::size_t kSize = sizeof...(Ts);
+};
+
+template <typename... Ts>
+using ErrorUnionStorage = WithSpecialMembers<ErrorUnionPayload<Ts...>, Ts...>;
+
+}  // namespace eav::detail
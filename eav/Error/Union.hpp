@@ -0,0 +1,181 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>      // std::size_t
+#include <type_traits>
+#include <utility>      // std::in_place_type_t, std::forward, std::move
+
+#include "../Detail/Call.hpp"
+#include "../Detail/Panic.hpp"
+#include "Detail/Union.hpp"
+
+namespace eav {
+
+// One error out of several unrelated types, e.g. what a chain of steps that fail with ParseError,
+// IoError and NotFound can end with. The alternatives are stored in place: a union sized to the
+// largest of them and a 1-byte tag, nothing is allocated or converted to a string.
+// Spelled ErrorUnion<E...>, which flattens nested unions and removes duplicates (see below), so
+// ErrorUnion<A, ErrorUnion<B, A>> is FlatErrorUnion<A, B>. AndThen widens into it when a stage
+// fails with another error type than the input (see Result/Combinators/AndThen.hpp), Match
+// handles some of the alternatives (Result/Combinators/Match.hpp).
+template <typename... Es>
+class FlatErrorUnion {
+    static_assert(sizeof...(Es) > 0 && sizeof...(Es) < 256, "eav::ErrorUnion: 1 to 255 alternatives");
+    static_assert(((std::is_object_v<Es> && std::same_as<Es, std::remove_cv_t<Es>> && !std::is_array_v<Es> &&
+                    std::move_constructible<Es> && std::destructible<Es>) && ...),
+                  "eav::ErrorUnion: the alternatives are movable object types");
+    static_assert(std::same_as<detail::ErrorSet<Es...>, detail::TypeList<Es...>>,
+                  "eav::FlatErrorUnion: the alternatives are distinct and not unions, spell it ErrorUnion<...>");
+
+  public:  // nested constants:
+    static constexpr std::size_t kSize = sizeof...(Es);
+
+    template <typename U>
+    static constexpr bool kHolds = (std::same_as<U, Es> || ...);
+
+    // Position of the alternative U (kSize if it is not one)
+    template <typename U>
+    static constexpr std::size_t kIndexOf = detail::kIndexOf<U, Es...>;
+
+  private:  // data members:
+    detail::ErrorUnionStorage<Es...> storage_;
+
+    template <typename... Os>
+    friend class FlatErrorUnion;
+
+  public:  // member functions:
+    // Constructors:
+    // From one of the alternatives (implicit: a function returning Result<T, ErrorUnion<A, B>>
+    // can `return make::Err(A{...});`)
+    template <typename U> requires kHolds<std::remove_cvref_t<U>>
+    constexpr FlatErrorUnion(U&& err) noexcept(  // NOLINT: implicit on purpose
+        std::is_nothrow_constructible_v<std::remove_cvref_t<U>, U&&>)
+        : storage_(std::in_place_index<kIndexOf<std::remove_cvref_t<U>>>, std::forward<U>(err)) {}
+
+    template <typename U, typename... Args> requires kHolds<U> && std::constructible_from<U, Args...>
+    constexpr explicit FlatErrorUnion(std::in_place_type_t<U>, Args&&... args)
+        : storage_(std::in_place_index<kIndexOf<U>>, std::forward<Args>(args)...) {}
+
+    // From a union of some or all of the alternatives, in any order: widening or reordering,
+    // also implicit (a function declared to return Result<T, ErrorUnion<B, A>> can return the
+    // Result<T, ErrorUnion<A, B>> of a chain)
+    template <typename... Os>
+    requires(sizeof...(Os) <= kSize && !std::same_as<FlatErrorUnion<Os...>, FlatErrorUnion> && (kHolds<Os> && ...))
+    constexpr FlatErrorUnion(const FlatErrorUnion<Os...>& oth)  // NOLINT
+        : storage_(detail::FromStorageTag{}, oth.storage_) {}
+
+    template <typename... Os>
+    requires(sizeof...(Os) <= kSize && !std::same_as<FlatErrorUnion<Os...>, FlatErrorUnion> && (kHolds<Os> && ...))
+    constexpr FlatErrorUnion(FlatErrorUnion<Os...>&& oth) noexcept(  // NOLINT
+        (std::is_nothrow_move_constructible_v<Os> && ...))
+        : storage_(detail::FromStorageTag{}, std::move(oth.storage_)) {}
+
+    // Observers:
+    constexpr std::size_t index() const noexcept {
+        return storage_.index();
+    }
+
+    template <typename U> requires kHolds<U>
+    constexpr bool holds() const noexcept {
+        return storage_.index() == kIndexOf<U>;
+    }
+
+    // Accessors: the alternative U, panics if another one is held
+    template <typename U> requires kHolds<U>
+    constexpr const U& get() const& {
+        Check<U>();
+        return storage_.template get<kIndexOf<U>>();
+    }
+
+    template <typename U> requires kHolds<U>
+    constexpr U& get() & {
+        Check<U>();
+        return storage_.template get<kIndexOf<U>>();
+    }
+
+    template <typename U> requires kHolds<U>
+    constexpr U get() && {
+        Check<U>();
+        return std::move(storage_).template get<kIndexOf<U>>();
+    }
+
+    // nullptr if another alternative is held
+    template <typename U> requires kHolds<U>
+    constexpr const U* get_if() const noexcept {
+        return holds<U>() ? &storage_.template get<kIndexOf<U>>() : nullptr;
+    }
+
+    template <typename U> requires kHolds<U>
+    constexpr U* get_if() noexcept {
+        return holds<U>() ? &storage_.template get<kIndexOf<U>>() : nullptr;
+    }
+
+    // func(alternative): func takes every alternative and returns the same type for all of them
+    template <typename F>
+    constexpr decltype(auto) visit(F&& func) const& {
+        return Visit(*this, std::forward<F>(func));
+    }
+
+    template <typename F>
+    constexpr decltype(auto) visit(F&& func) & {
+        return Visit(*this, std::forward<F>(func));
+    }
+
+    template <typename F>
+    constexpr decltype(auto) visit(F&& func) && {
+        return Visit(std::move(*this), std::forward<F>(func));
+    }
+
+    // Operators:
+    friend constexpr bool operator==(const FlatErrorUnion& lhs, const FlatErrorUnion& rhs) requires(
+        std::equality_comparable<Es> && ...) {
+        if (lhs.index() != rhs.index()) {
+            return false;
+        }
+        return lhs.storage_.visit_index([&](auto idx) {
+            return static_cast<bool>(lhs.storage_.template get<idx>() == rhs.storage_.template get<idx>());
+        });
+    }
+
+    // An alternative compares equal to a union that holds an equal value
+    template <typename U> requires kHolds<U> && std::equality_comparable<U>
+    friend constexpr bool operator==(const FlatErrorUnion& lhs, const U& rhs) {
+        const U* held = lhs.get_if<U>();
+        return held != nullptr && *held == rhs;
+    }
+
+  private:  // member functions:
+    template <typename U>
+    constexpr void Check() const {
+        if (!holds<U>()) {
+            detail::Panic("eav::ErrorUnion: called .get<U>() while another alternative is held");
+        }
+    }
+
+    template <typename Self, typename F>
+    static constexpr decltype(auto) Visit(Self&& self, F&& func) {
+        using R = std::invoke_result_t<F, decltype(std::forward<Self>(self).storage_.template get<0>())>;
+        static_assert((std::same_as<R, std::invoke_result_t<F, decltype(std::forward<Self>(self).storage_.template get<
+                                                                   kIndexOf<Es>>())>> &&
+                       ...),
+                      "eav::ErrorUnion: visit() must return the same type for every alternative");
+        return self.storage_.visit_index([&](auto idx) -> R {
+            return detail::Call(std::forward<F>(func), std::forward<Self>(self).storage_.template get<idx>());
+        });
+    }
+};
+
+// The union of the error types `Es...`: nested unions are flattened, duplicates removed (the
+// first occurrence keeps its place) and cv/ref qualifiers dropped. Always a union, also of one
+// type; combinators that merge error types use detail::MergedError, which keeps a lone type as is.
+template <typename... Es>
+using ErrorUnion = typename detail::UnionFromSet<detail::ErrorSet<Es...>>::Type;
+
+}  // namespace eav
+
+namespace eav::concepts {
+
+template <typename E>
+concept IsErrorUnion = detail::kIsErrorUnion<std::remove_cvref_t<E>>;
+
+}  // namespace eav::concepts
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>  // std::move
+
+#include "../Result/Concepts/IsError.hpp"
+#include "ContextArena.hpp"
+#include "Detail/ContextFrame.hpp"
+
+namespace eav {
+
+// An error plus the context messages attached to it on its way up (combine::result::Context).
+// The messages live in a ContextArena and are formatted only by context()/to_string(); the
+// error itself is kept as is. The arena belongs to the thread that recorded the messages: on
+// any other thread (Traverse, AsyncResult, WhenAll move errors across) they read as expired
+// and the arena is not touched, so render or map the error first if its context must travel.
+template <concepts::IsError E>
+class WithContext {
+  private:  // data members:
+    E error_;
+    const detail::ContextFrame* chain_ = nullptr;  // the most recent message first
+    const detail::ArenaGeneration* token_ = nullptr;  // of the arena, outlives it
+    std::uint64_t thread_ = 0;      // ContextArena::ThreadSerial() of the thread that used the arena
+    std::uint64_t generation_ = 0;  // of the arena when the chain was started
+    std::uint32_t dropped_ = 0;     // messages lost to an exhausted arena
+
+  public:  // member functions:
+    explicit WithContext(E error) noexcept(std::is_nothrow_move_constructible_v<E>) : error_(std::move(error)) {}
+
+    const E& error() const& noexcept {
+        return error_;
+    }
+
+    E& error() & noexcept {
+        return error_;
+    }
+
+    E error() && noexcept(std::is_nothrow_move_constructible_v<E>) {
+        return std::move(error_);
+    }
+
+    bool has_context() const noexcept {
+        return chain_ != nullptr || dropped_ != 0;
+    }
+
+    // The messages are out of reach: recorded on another thread, or the arena was reset or
+    // destroyed since (the arena itself is not read)
+    bool expired() const noexcept {
+        return chain_ != nullptr && (thread_ != ContextArena::ThreadSerial() || token_->load() != generation_);
+    }
+
+    // "outermost: ...: innermost"
+    std::string context() const {
+        std::string out;
+        if (expired()) {
+            return "<context expired>";
+        }
+        for (const detail::ContextFrame* frame = chain_; frame != nullptr; frame = frame->prev) {
+            if (!out.empty()) {
+                out += ": ";
+            }
+            frame->render(*frame, out);
+        }
+        if (dropped_ != 0) {
+            out += out.empty() ? "" : " ";
+            out += "(+";
+            detail::AppendFormatted(out, dropped_);
+            out += " dropped)";
+        }
+        return out;
+    }
+
+    // "context: error"
+    std::string to_string() const {
+        std::string out = context();
+        if (!out.empty()) {
+            out += ": ";
+        }
+        detail::AppendFormatted(out, error_);
+        return out;
+    }
+
+    // Records "fmt with args" in `arena`, on top of the messages so far
+    template <typename... Args>
+    void Attach(ContextArena& arena, std::string_view fmt, const Args&... args) noexcept {
+        if (chain_ != nullptr && (token_ != &arena.generation_token() || expired())) {
+            chain_ = nullptr;  // a chain never spans arenas, threads or generations of an arena
+        }
+        if (chain_ == nullptr) {
+            token_ = &arena.generation_token();
+            thread_ = ContextArena::ThreadSerial();
+            generation_ = arena.generation();
+        }
+        if (const detail::ContextFrame* frame = detail::PushFrame(arena, chain_, fmt, args...)) {
+            chain_ = frame;
+        } else {
+            ++dropped_;
+            arena.CountDropped();
+        }
+    }
+};
+
+namespace detail {
+
+template <typename E>
+struct ContextErrorT {
+    using Type = WithContext<E>;
+};
+
+template <typename E>
+struct ContextErrorT<WithContext<E>> {
+    using Type = WithContext<E>;
+};
+
+// The error type after attaching context to an E: WithContext<E>, which stays as is
+template <typename E>
+using ContextError = typename ContextErrorT<E>::Type;
+
+}  // namespace detail
+
+}  // namespace eav
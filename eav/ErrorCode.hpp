@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>  // std::shared_ptr
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>  // std::move
+
+#include "Error/Detail/CategoryRegistry.hpp"
+#include "Option.hpp"
+#include "Traits/ErrorCategory.hpp"
+
+namespace eav {
+
+// An allocation-free error: a category id and a code in one 64-bit value, trivially copyable, so
+// Result<T, ErrorCode> errors cost as much as successes. Made from any enum with
+// ErrorCategoryTraits (implicitly: `return make::Err(ErrorCode(HttpError::kRateLimited));`);
+// its category and message come from the static tables of that enum.
+class ErrorCode {
+  private:  // data members:
+    std::uint32_t category_ = 0;  // detail::CategoryRegistry id
+    std::int32_t code_ = 0;
+
+  public:  // member functions:
+    // The "no error" code of the generic category
+    constexpr ErrorCode() noexcept = default;
+
+    template <concepts::IsErrorEnum Enum>
+    ErrorCode(Enum code) noexcept  // NOLINT: implicit on purpose
+        : category_(detail::CategoryId<Enum>()), code_(static_cast<std::int32_t>(code)) {}
+
+    constexpr std::int32_t code() const noexcept {
+        return code_;
+    }
+
+    const ErrorCategory& category() const noexcept {
+        return detail::CategoryRegistry::Get(category_);
+    }
+
+    std::string_view message() const noexcept {
+        return category().message(code_);
+    }
+
+    // Whether the code belongs to Enum's category
+    template <concepts::IsErrorEnum Enum>
+    bool is() const noexcept {
+        return category_ == detail::CategoryId<Enum>();
+    }
+
+    // The code as an Enum, None if it belongs to another category
+    template <concepts::IsErrorEnum Enum>
+    Option<Enum> as() const noexcept {
+        if (!is<Enum>()) {
+            return make::None();
+        }
+        return make::Some(static_cast<Enum>(code_));
+    }
+
+    // "category: message"
+    std::string to_string() const {
+        std::string out(category().name);
+        out += ": ";
+        out += message();
+        return out;
+    }
+
+    friend constexpr bool operator==(ErrorCode, ErrorCode) noexcept = default;
+
+    template <concepts::IsErrorEnum Enum>
+    friend bool operator==(ErrorCode err, Enum code) noexcept {
+        return err == ErrorCode(code);
+    }
+};
+
+static_assert(sizeof(ErrorCode) == 8 && std::is_trivially_copyable_v<ErrorCode>);
+
+// Functor for MapErr: an enum error (or an ErrorCode) to ErrorCode, e.g.
+// `Fetch(url) | combine::result::MapErr(IntoErrorCode{})`
+struct IntoErrorCode {
+    ErrorCode operator()(ErrorCode err) const noexcept {
+        return err;
+    }
+
+    template <concepts::IsErrorEnum Enum>
+    ErrorCode operator()(Enum code) const noexcept {
+        return ErrorCode(code);
+    }
+};
+
+// An ErrorCode with an optional message built at run time. Only attaching the context
+// allocates (once; copies share it), so rejects on hot paths can stay context-free.
+class ContextualError {
+  private:  // data members:
+    ErrorCode code_;
+    std::shared_ptr<const std::string> context_;
+
+  public:  // member functions:
+    ContextualError(ErrorCode code) noexcept : code_(code) {}  // NOLINT: implicit on purpose
+
+    template <concepts::IsErrorEnum Enum>
+    ContextualError(Enum code) noexcept : code_(code) {}  // NOLINT: implicit on purpose
+
+    ContextualError(ErrorCode code, std::string context)
+        : code_(code), context_(std::make_shared<const std::string>(std::move(context))) {}
+
+    ErrorCode code() const noexcept {
+        return code_;
+    }
+
+    // Empty if none was attached
+    std::string_view context() const noexcept {
+        return context_ != nullptr ? std::string_view(*context_) : std::string_view();
+    }
+
+    // "category: message (context)"
+    std::string to_string() const {
+        std::string out = code_.to_string();
+        if (context_ != nullptr) {
+            out += " (";
+            out += *context_;
+            out += ')';
+        }
+        return out;
+    }
+};
+
+}  // namespace eav
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <concepts>  // std::default_initializable
+#include <cstddef>   // std::size_t
+#include <utility>
+#include <vector>
+
+#include "../../Option/Core.hpp"
+
+namespace eav::detail {
+
+// Preallocated output of a parallel traversal: slot i is written once, by the thread that ran
+// element i, then the whole column is handed out as a std::vector<U>.
+// Default-constructible U is written straight into the final vector; other types are staged in
+// Option<U> slots and moved once at the end. std::vector<bool> packs its elements into shared
+// words, so bool takes the staged path too (concurrent writes to neighbours would race).
+template <typename U>
+class Slots {
+  private:  // data members:
+    std::vector<Option<U>> slots_;
+
+  public:  // member functions:
+    explicit Slots(std::size_t n) {
+        slots_.reserve(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            slots_.push_back(make::None());
+        }
+    }
+
+    void Put(std::size_t i, U&& val) {
+        slots_[i].emplace(std::move(val));
+    }
+
+    // Precondition: every slot was written
+    std::vector<U> Take() && {
+        std::vector<U> out;
+        out.reserve(slots_.size());
+        for (auto& slot : slots_) {
+            out.push_back(Access<Option<U>>::Take(std::move(slot)));
+        }
+        return out;
+    }
+
+    // Only the slots flagged in `mask` (which were written)
+    std::vector<U> TakeWhere(const std::vector<char>& mask) && {
+        std::vector<U> out;
+        for (std::size_t i = 0; i < slots_.size(); ++i) {
+            if (mask[i]) out.push_back(Access<Option<U>>::Take(std::move(slots_[i])));
+        }
+        return out;
+    }
+};
+
+template <typename U> requires(std::default_initializable<U> && !std::same_as<U, bool>)
+class Slots<U> {
+  private:  // data members:
+    std::vector<U> values_;
+
+  public:  // member functions:
+    explicit Slots(std::size_t n) : values_(n) {}
+
+    void Put(std::size_t i, U&& val) {
+        values_[i] = std::move(val);
+    }
+
+    std::vector<U> Take() && {
+        return std::move(values_);
+    }
+
+    std::vector<U> TakeWhere(const std::vector<char>& mask) && {
+        std::vector<U> out;
+        for (std::size_t i = 0; i < values_.size(); ++i) {
+            if (mask[i]) out.push_back(std::move(values_[i]));
+        }
+        return out;
+    }
+};
+
+}  // namespace eav::detail
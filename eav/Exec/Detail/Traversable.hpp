@@ -0,0 +1,20 @@
+#pragma once
+
+#include <concepts>
+#include <ranges>
+#include <type_traits>  // std::invoke_result_t
+
+#include "../Policy.hpp"
+
+namespace eav::detail {
+
+template <typename R, typename F>
+using TraverseResult = std::invoke_result_t<F&, std::ranges::range_reference_t<R>>;
+
+// Parallel policies need to index the input
+template <typename P, typename R>
+concept TraversableWith =
+    std::ranges::input_range<R> &&
+    (std::same_as<P, exec::SequencedPolicy> || (std::ranges::random_access_range<R> && std::ranges::sized_range<R>));
+
+}  // namespace eav::detail
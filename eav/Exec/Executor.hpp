@@ -0,0 +1,43 @@
+#pragma once
+
+#include <concepts>
+
+namespace eav::exec {
+
+// Unit of work handed to an executor without an allocation of its own: the object that owns
+// the work (e.g. the shared state of an AsyncResult) derives from Job and keeps itself alive
+// until Run() returns. Run() must not throw.
+class Job {
+  public:  // member functions:
+    virtual void Run() noexcept = 0;
+
+  protected:  // member functions:
+    ~Job() = default;
+};
+
+// Anything that runs a Job, now or later, on some thread: ThreadPool, InlineExecutor.
+// An executor with `bool owns_this_thread()` tells blocking fan-outs (WhenAll/WhenAny) that the
+// caller is one of its threads, so they run their inputs in place rather than wait on it
+template <typename X>
+concept Executor = requires(X& ex, Job& job) { ex.Post(job); };
+
+// True if the calling thread belongs to `executor` (never for one that cannot tell)
+template <typename X>
+bool OwnsThisThread(const X& executor) noexcept {
+    if constexpr (requires { { executor.owns_this_thread() } -> std::convertible_to<bool>; }) {
+        return executor.owns_this_thread();
+    } else {
+        return false;
+    }
+}
+
+// Runs the job on the calling thread, inside Post
+struct InlineExecutor {
+    void Post(Job& job) const noexcept {
+        job.Run();
+    }
+};
+
+inline constexpr InlineExecutor inline_executor{};
+
+}  // namespace eav::exec
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <algorithm>  // std::min, std::max
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>  // std::size_t
+#include <exception>
+#include <memory>  // std::shared_ptr
+#include <mutex>
+#include <type_traits>
+
+#include "Policy.hpp"
+#include "ThreadPool.hpp"
+
+namespace eav::exec {
+
+namespace detail {
+
+// Shared by the caller and the helper tasks of one ParallelFor. The caller keeps it alive past
+// its own return (helpers hold a shared_ptr), but only helpers that joined before the loop was
+// closed may touch `body`, which lives on the caller's stack.
+template <typename Body>
+struct ParallelForState {
+    Body* body;
+    std::size_t size;
+    std::size_t chunk;
+
+    std::atomic<std::size_t> next{0};       // start of the next unclaimed chunk
+    std::atomic<std::size_t> cancelled_at;  // smallest index whose body returned false
+
+    std::mutex mutex;
+    std::condition_variable done;
+    std::size_t active = 0;
+    bool closed = false;
+    std::exception_ptr error;
+
+    ParallelForState(Body* b, std::size_t n, std::size_t c) : body(b), size(n), chunk(c), cancelled_at(n) {}
+
+    // Claims chunks in increasing order until the range is exhausted or cancelled
+    void Run() {
+#if defined(__cpp_exceptions)
+        try {
+            RunChunks();
+        } catch (...) {
+            std::lock_guard lock(mutex);
+            if (!error) error = std::current_exception();
+            Cancel(0);
+        }
+#else
+        RunChunks();
+#endif
+    }
+
+    // Entry point of a helper task: a helper that starts after the caller closed the loop
+    // (the pool was busy) returns without touching the body
+    void Join() {
+        {
+            std::lock_guard lock(mutex);
+            if (closed) return;
+            ++active;
+        }
+        Run();
+        {
+            std::lock_guard lock(mutex);
+            --active;
+        }
+        done.notify_all();
+    }
+
+    void Close() {
+        std::unique_lock lock(mutex);
+        closed = true;
+        done.wait(lock, [this] { return active == 0; });
+    }
+
+  private:
+    void RunChunks() {
+        for (;;) {
+            const std::size_t begin = next.fetch_add(chunk, std::memory_order_relaxed);
+            if (begin >= std::min(size, cancelled_at.load(std::memory_order_acquire))) return;
+
+            const std::size_t end = std::min(begin + chunk, size);
+            for (std::size_t i = begin; i < end; ++i) {
+                if (i >= cancelled_at.load(std::memory_order_relaxed)) return;
+                if (!(*body)(i)) {
+                    Cancel(i);
+                    return;
+                }
+            }
+        }
+    }
+
+    void Cancel(std::size_t i) noexcept {
+        std::size_t cur = cancelled_at.load(std::memory_order_relaxed);
+        while (i < cur && !cancelled_at.compare_exchange_weak(cur, i, std::memory_order_acq_rel)) {
+        }
+    }
+};
+
+inline std::size_t ChunkFor(std::size_t n, std::size_t threads) noexcept {
+    // ~8 chunks per thread: small enough to balance uneven elements, large enough to keep
+    // the shared counter out of the hot loop
+    return std::max<std::size_t>(n / (threads * 8), 1);
+}
+
+}  // namespace detail
+
+// Calls body(i) for every i in [0, n); `bool body(std::size_t)` returns false to cancel.
+// Parallel: threads claim chunks of consecutive indices from a shared counter (so a thread that
+// finishes early takes over the remaining work), and the caller works too. After body(i)
+// returns false no chunk past i is started and running chunks stop at indices past i, but every
+// index below the smallest cancelled one still runs: the outcome matches the sequential loop.
+// Returns that smallest cancelled index, or n. An exception thrown by body is rethrown here.
+template <typename Body>
+std::size_t ParallelFor(SequencedPolicy, std::size_t n, Body&& body) {
+    for (std::size_t i = 0; i < n; ++i) {
+        if (!body(i)) return i;
+    }
+    return n;
+}
+
+template <typename Body>
+std::size_t ParallelFor(ParallelPolicy policy, std::size_t n, Body&& body) {
+    ThreadPool& pool = policy.pool != nullptr ? *policy.pool : ThreadPool::Default();
+    const std::size_t chunk = policy.chunk != 0 ? policy.chunk : detail::ChunkFor(n, pool.size() + 1);
+    const std::size_t chunks = (n + chunk - 1) / chunk;
+    if (chunks <= 1) {
+        return ParallelFor(seq, n, body);
+    }
+
+    using State = detail::ParallelForState<std::remove_reference_t<Body>>;
+    auto state = std::make_shared<State>(&body, n, chunk);
+
+    const std::size_t helpers = std::min(pool.size(), chunks - 1);
+    for (std::size_t h = 0; h < helpers; ++h) {
+        pool.Submit([state] { state->Join(); });
+    }
+    state->Run();
+    state->Close();
+
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+    return std::min(n, state->cancelled_at.load(std::memory_order_acquire));
+}
+
+}  // namespace eav::exec
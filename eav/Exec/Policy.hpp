@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>  // std::size_t
+#include <type_traits>
+
+#include "ThreadPool.hpp"
+
+namespace eav::exec {
+
+// Run on the calling thread, element by element
+struct SequencedPolicy {};
+
+// Run on a thread pool; `chunk` is the number of consecutive elements a thread claims at a
+// time (0: chosen from the input size and the pool size)
+struct ParallelPolicy {
+    ThreadPool* pool = nullptr;  // nullptr: ThreadPool::Default()
+    std::size_t chunk = 0;
+
+    constexpr ParallelPolicy on(ThreadPool& p) const noexcept {
+        return ParallelPolicy{&p, chunk};
+    }
+
+    constexpr ParallelPolicy with_chunk(std::size_t c) const noexcept {
+        return ParallelPolicy{pool, c};
+    }
+};
+
+inline constexpr SequencedPolicy seq{};
+inline constexpr ParallelPolicy par{};
+
+template <typename P>
+concept ExecutionPolicy = std::same_as<P, SequencedPolicy> || std::same_as<P, ParallelPolicy>;
+
+}  // namespace eav::exec
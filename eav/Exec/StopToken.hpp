@@ -0,0 +1,24 @@
+#pragma once
+
+#include <atomic>
+
+namespace eav::exec {
+
+// Cooperative cancellation without an allocation (std::stop_source allocates its shared state):
+// a view of a flag owned by the operation that may cancel (e.g. WhenAll), which outlives every
+// function it hands the token to. Long-running work polls stop_requested() and gives up early.
+class StopToken {
+  private:  // data members:
+    const std::atomic<bool>* flag_ = nullptr;
+
+  public:  // member functions:
+    // Never stopped
+    constexpr StopToken() noexcept = default;
+    constexpr explicit StopToken(const std::atomic<bool>& flag) noexcept : flag_(&flag) {}
+
+    bool stop_requested() const noexcept {
+        return flag_ != nullptr && flag_->load(std::memory_order_relaxed);
+    }
+};
+
+}  // namespace eav::exec
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <algorithm>  // std::max
+#include <condition_variable>
+#include <cstddef>  // std::size_t
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Executor.hpp"
+
+namespace eav::exec {
+
+// Fixed-size pool of worker threads with one FIFO task queue.
+// Tasks are move-only callables `void()` (Submit, one allocation per task) or Jobs owned by the
+// caller (Post, none); they must not throw. Load balancing of data-parallel work is done above
+// the pool (see ParallelFor.hpp), so the queue only sees a few coarse tasks.
+class ThreadPool {
+  private:  // nested types:
+    // A submitted callable: deletes itself once it has run
+    template <typename F>
+    class Task final : public Job {
+      private:  // data members:
+        F func_;
+
+      public:  // member functions:
+        explicit Task(F&& f) : func_(std::move(f)) {}
+
+        void Run() noexcept override {
+            func_();
+            delete this;
+        }
+    };
+
+  private:  // data members:
+    std::mutex mutex_;
+    std::condition_variable wakeup_;
+    std::deque<Job*> tasks_;
+    bool stopping_ = false;
+    std::vector<std::thread> workers_;
+
+  public:  // member functions:
+    // Constructors and destructor:
+    explicit ThreadPool(std::size_t threads = DefaultThreads()) {
+        threads = std::max<std::size_t>(threads, 1);
+        workers_.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            workers_.emplace_back([this] { WorkerLoop(); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Runs the tasks already queued, then joins the workers
+    ~ThreadPool() {
+        {
+            std::lock_guard lock(mutex_);
+            stopping_ = true;
+        }
+        wakeup_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    // Observers:
+    std::size_t size() const noexcept {
+        return workers_.size();
+    }
+
+    // True on one of this pool's workers: work that waits for tasks it posted here must run them
+    // itself instead, or it may wait for a worker that is busy waiting too
+    bool owns_this_thread() const noexcept {
+        return CurrentPool() == this;
+    }
+
+    // Modifiers:
+    template <typename F> requires std::is_invocable_r_v<void, std::decay_t<F>&>
+    void Submit(F&& func) {
+        Post(*new Task<std::decay_t<F>>(std::decay_t<F>(std::forward<F>(func))));
+    }
+
+    // Runs `job` on a worker; the pool does not own it (see Executor.hpp)
+    void Post(Job& job) {
+        {
+            std::lock_guard lock(mutex_);
+            tasks_.push_back(&job);
+        }
+        wakeup_.notify_one();
+    }
+
+    // Process-wide pool with one worker per hardware thread, created on first use
+    static ThreadPool& Default() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+  private:  // member functions:
+    static std::size_t DefaultThreads() noexcept {
+        return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    }
+
+    // The pool whose worker is the calling thread, if any
+    static const ThreadPool*& CurrentPool() noexcept {
+        thread_local const ThreadPool* pool = nullptr;
+        return pool;
+    }
+
+    void WorkerLoop() {
+        CurrentPool() = this;
+        for (;;) {
+            Job* task = nullptr;
+            {
+                std::unique_lock lock(mutex_);
+                wakeup_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+                if (tasks_.empty()) {
+                    return;  // stopping and drained
+                }
+                task = tasks_.front();
+                tasks_.pop_front();
+            }
+            task->Run();
+        }
+    }
+};
+
+}  // namespace eav::exec
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>  // std::size_t
+#include <cstdint>
+
+#include "ErrorCode.hpp"
+#include "Option/Core.hpp"
+#include "Result/Core.hpp"
+
+// Explicit instantiation for the specializations a project uses everywhere. In a header that
+// every user includes:
+//     EAV_EXTERN_RESULT(Config, ConfigError);
+// and in one source file:
+//     EAV_INSTANTIATE_RESULT(Config, ConfigError);
+// The other translation units then skip the member functions of Result<Config, ConfigError>
+// that the optimizer does not inline: at -O0 nothing is compiled again, with optimization only
+// the out-of-line copies are. Pipelines and combinators are templates over their callables and
+// are not covered.
+#define EAV_EXTERN_RESULT(T, E) extern template class ::eav::Result<T, E>
+#define EAV_INSTANTIATE_RESULT(T, E) template class ::eav::Result<T, E>
+#define EAV_EXTERN_OPTION(T) extern template class ::eav::Option<T>
+#define EAV_INSTANTIATE_OPTION(T) template class ::eav::Option<T>
+
+// The specializations instantiated by the eav_extern library (CMake option
+// EAV_BUILD_EXTERN_TEMPLATES), which defines EAV_EXTERN_TEMPLATES=1 for its users
+#define EAV_COMMON_RESULTS(X)           \
+    X(void, ::eav::ErrorCode)           \
+    X(bool, ::eav::ErrorCode)           \
+    X(int, ::eav::ErrorCode)            \
+    X(std::int64_t, ::eav::ErrorCode)   \
+    X(std::size_t, ::eav::ErrorCode)
+
+#define EAV_COMMON_OPTIONS(X) \
+    X(int)                    \
+    X(std::int64_t)           \
+    X(std::size_t)
+
+#if defined(EAV_EXTERN_TEMPLATES) && EAV_EXTERN_TEMPLATES
+#    define EAV_DETAIL_EXTERN_RESULT(T, E) EAV_EXTERN_RESULT(T, E);
+#    define EAV_DETAIL_EXTERN_OPTION(T) EAV_EXTERN_OPTION(T);
+EAV_COMMON_RESULTS(EAV_DETAIL_EXTERN_RESULT)
+EAV_COMMON_OPTIONS(EAV_DETAIL_EXTERN_OPTION)
+#    undef EAV_DETAIL_EXTERN_RESULT
+#    undef EAV_DETAIL_EXTERN_OPTION
+#endif
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <algorithm>  // std::sort
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "Detail/Instrument.hpp"
+#include "Error/Detail/Format.hpp"
+#include "Instrument/Detail/Counters.hpp"
+#include "Instrument/Detail/Record.hpp"
+
+// Which call sites produce errors, and how often. With -DEAV_INSTRUMENT=1 (whole program),
+// make::Err, the error branches of Filter/AndThen/OrElse (Result and Option) and unwrap_*()
+// misuse report to a sink, keyed by the std::source_location of the make::Err / combinator /
+// unwrap call. The default sink bumps a counter in a table owned by the calling thread, with
+// no locks or read-modify-write operations; Snapshot() adds up all threads on demand.
+//
+//     for (const auto& s : eav::instrument::Snapshot()) ...  // most frequent first
+//     std::fputs(eav::instrument::Dump().c_str(), stderr);
+//
+// Without EAV_INSTRUMENT nothing reports and Snapshot() is empty.
+
+namespace eav::instrument {
+
+// Replaces the sink (nullptr: drop reports); returns the previous one. CountingSink is the
+// default; a custom sink may call it to keep the counters too.
+inline Sink SetSink(Sink sink) noexcept {
+    return detail::instrument_sink.exchange(sink, std::memory_order_acq_rel);
+}
+
+inline std::string_view EventName(Event event) noexcept {
+    switch (event) {
+        case Event::kMakeErr:
+            return "make::Err";
+        case Event::kFilter:
+            return "Filter";
+        case Event::kAndThen:
+            return "AndThen";
+        case Event::kOrElse:
+            return "OrElse";
+        case Event::kUnwrapMisuse:
+            return "unwrap misuse";
+    }
+    return "?";
+}
+
+// Totals per call site and event, most frequent first. `lost`: reports that found no slot in
+// their thread's table (more distinct sites than it holds).
+inline std::vector<SiteStats> Snapshot(std::uint64_t* lost = nullptr) {
+    std::vector<SiteStats> all = detail::CounterRegistry::Collect(lost);
+
+    // the same site seen by several threads
+    std::map<std::tuple<std::string_view, std::uint32_t, std::uint32_t, Event>, SiteStats> merged;
+    for (const SiteStats& s : all) {
+        auto [it, inserted] = merged.try_emplace({s.file, s.line, s.column, s.event}, s);
+        if (!inserted) {
+            it->second.count += s.count;
+            it->second.first_seen = std::min(it->second.first_seen, s.first_seen);
+        }
+    }
+
+    std::vector<SiteStats> out;
+    out.reserve(merged.size());
+    for (auto& [key, s] : merged) {
+        out.push_back(s);
+    }
+    std::sort(out.begin(), out.end(), [](const SiteStats& a, const SiteStats& b) { return a.count > b.count; });
+    return out;
+}
+
+// Forgets all counts (threads clear their tables at their next report)
+inline void Reset() {
+    detail::CounterRegistry::Reset();
+}
+
+// One line per site: "<count> <event> <type> at <file>:<line>:<column> in <function>, first seen <s> s ago"
+inline std::string Dump() {
+    std::uint64_t lost = 0;
+    const std::vector<SiteStats> stats = Snapshot(&lost);
+    const auto now = std::chrono::system_clock::now();
+
+    std::string out;
+    for (const SiteStats& s : stats) {
+        detail::AppendFormatted(out, s.count);
+        out += ' ';
+        out += EventName(s.event);
+        out += ' ';
+        out += s.type_name;
+        out += " at ";
+        out += s.file;
+        out += ':';
+        detail::AppendFormatted(out, s.line);
+        out += ':';
+        detail::AppendFormatted(out, s.column);
+        out += " in ";
+        out += s.function;
+        out += ", first seen ";
+        detail::AppendFormatted(out, std::chrono::duration<double>(now - s.first_seen).count());
+        out += " s ago\n";
+    }
+    if (lost != 0) {
+        detail::AppendFormatted(out, lost);
+        out += " reports lost (too many sites per thread)\n";
+    }
+    return out;
+}
+
+}  // namespace eav::instrument
@@ -0,0 +1,242 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <source_location>
+#include <string_view>
+#include <vector>
+
+#include "../../Detail/Instrument.hpp"
+
+namespace eav::instrument {
+
+// What a sink is told about one error
+struct Report {
+    Event event;
+    const std::source_location& site;
+    std::string_view type_name;  // the error type (or the Result/Option type for kUnwrapMisuse)
+};
+
+// Called synchronously on the thread where the error happened; must be thread-safe
+using Sink = void (*)(const Report& report);
+
+// Totals for one call site and event, all threads together
+struct SiteStats {
+    Event event;
+    std::string_view type_name;
+    std::string_view file;
+    std::string_view function;
+    std::uint32_t line;
+    std::uint32_t column;
+    std::uint64_t count;
+    std::chrono::system_clock::time_point first_seen;
+};
+
+}  // namespace eav::instrument
+
+namespace eav::detail {
+
+// Counters of one thread: an open-addressing table written only by its thread (plain relaxed
+// stores, no read-modify-write) and read by Snapshot() from any thread. All fields are atomic
+// so that concurrent reads are well-defined; a slot is published by its first non-zero count.
+class CounterTable {
+  public:  // nested types:
+    static constexpr std::size_t kSlots = 512;
+    static constexpr std::size_t kProbes = 32;
+
+    struct Slot {
+        std::atomic<std::uint64_t> count{0};  // 0: free
+        std::atomic<const char*> file{nullptr};
+        std::atomic<const char*> function{nullptr};
+        std::atomic<const char*> type_data{nullptr};
+        std::atomic<std::size_t> type_size{0};
+        std::atomic<std::uint32_t> line{0};
+        std::atomic<std::uint32_t> column{0};
+        std::atomic<instrument::Event> event{};
+        std::atomic<std::int64_t> first_seen_ns{0};
+    };
+
+  private:  // data members:
+    std::array<Slot, kSlots> slots_;
+    std::atomic<std::uint64_t> overflow_{0};  // errors of sites that found no free slot
+    std::atomic<std::uint64_t> epoch_;        // of the last Reset() seen by the owner
+
+  public:  // member functions:
+    explicit CounterTable(std::uint64_t epoch) noexcept : epoch_(epoch) {}
+
+    // Owner thread only
+    void Count(instrument::Event event, const std::source_location& site, std::string_view type,
+               std::uint64_t epoch) noexcept {
+        if (epoch != epoch_.load(std::memory_order_relaxed)) {
+            Clear();
+            epoch_.store(epoch, std::memory_order_release);
+        }
+        const auto file = site.file_name();
+        std::size_t idx = Hash(file, site.line(), site.column(), event) % kSlots;
+        for (std::size_t probe = 0; probe < kProbes; ++probe, idx = (idx + 1) % kSlots) {
+            Slot& slot = slots_[idx];
+            const std::uint64_t count = slot.count.load(std::memory_order_relaxed);
+            if (count == 0) {
+                slot.file.store(file, std::memory_order_relaxed);
+                slot.function.store(site.function_name(), std::memory_order_relaxed);
+                slot.type_data.store(type.data(), std::memory_order_relaxed);
+                slot.type_size.store(type.size(), std::memory_order_relaxed);
+                slot.line.store(site.line(), std::memory_order_relaxed);
+                slot.column.store(site.column(), std::memory_order_relaxed);
+                slot.event.store(event, std::memory_order_relaxed);
+                slot.first_seen_ns.store(NowNs(), std::memory_order_relaxed);
+                slot.count.store(1, std::memory_order_release);
+                return;
+            }
+            if (slot.file.load(std::memory_order_relaxed) == file && slot.line.load(std::memory_order_relaxed) == site.line() &&
+                slot.column.load(std::memory_order_relaxed) == site.column() &&
+                slot.event.load(std::memory_order_relaxed) == event) {
+                slot.count.store(count + 1, std::memory_order_relaxed);
+                return;
+            }
+        }
+        overflow_.store(overflow_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    // Any thread: appends the used slots
+    void CollectInto(std::vector<instrument::SiteStats>& out) const {
+        for (const Slot& slot : slots_) {
+            const std::uint64_t count = slot.count.load(std::memory_order_acquire);
+            if (count == 0) {
+                continue;
+            }
+            out.push_back(instrument::SiteStats{
+                slot.event.load(std::memory_order_relaxed),
+                std::string_view(slot.type_data.load(std::memory_order_relaxed),
+                                 slot.type_size.load(std::memory_order_relaxed)),
+                slot.file.load(std::memory_order_relaxed),
+                slot.function.load(std::memory_order_relaxed),
+                slot.line.load(std::memory_order_relaxed),
+                slot.column.load(std::memory_order_relaxed),
+                count,
+                std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                    std::chrono::nanoseconds(slot.first_seen_ns.load(std::memory_order_relaxed)))),
+            });
+        }
+    }
+
+    // Counts from before this epoch are stale: the owner has not cleared them yet
+    std::uint64_t epoch() const noexcept {
+        return epoch_.load(std::memory_order_acquire);
+    }
+
+    std::uint64_t overflow() const noexcept {
+        return overflow_.load(std::memory_order_relaxed);
+    }
+
+  private:
+    void Clear() noexcept {
+        for (Slot& slot : slots_) {
+            slot.count.store(0, std::memory_order_relaxed);
+        }
+        overflow_.store(0, std::memory_order_relaxed);
+    }
+
+    static std::size_t Hash(const char* file, std::uint32_t line, std::uint32_t column, instrument::Event event) noexcept {
+        std::uint64_t h = reinterpret_cast<std::uintptr_t>(file);
+        h = (h ^ line) * 0x9E3779B97F4A7C15ULL;
+        h = (h ^ column) * 0x9E3779B97F4A7C15ULL;
+        h ^= static_cast<std::uint64_t>(event);
+        return static_cast<std::size_t>(h ^ (h >> 29));
+    }
+
+    static std::int64_t NowNs() noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::system_clock::now().time_since_epoch())
+            .count();
+    }
+};
+
+// All tables: the live ones (one per thread that reported) and the totals of finished threads
+class CounterRegistry {
+  private:  // data members:
+    inline static std::mutex mutex_;
+    inline static std::vector<const CounterTable*> live_;
+    inline static std::vector<instrument::SiteStats> retired_;
+    inline static std::uint64_t retired_overflow_ = 0;
+    inline static std::atomic<std::uint64_t> epoch_{0};
+
+  public:  // member functions:
+    static std::uint64_t Epoch() noexcept {
+        return epoch_.load(std::memory_order_relaxed);
+    }
+
+    static void Register(const CounterTable* table) {
+        std::lock_guard lock(mutex_);
+        live_.push_back(table);
+    }
+
+    // A finishing thread hands its counts over
+    static void Retire(const CounterTable* table) {
+        std::lock_guard lock(mutex_);
+        std::erase(live_, table);
+        if (table->epoch() == Epoch()) {
+            table->CollectInto(retired_);
+            retired_overflow_ += table->overflow();
+        }
+    }
+
+    // Counts of every thread, unmerged
+    static std::vector<instrument::SiteStats> Collect(std::uint64_t* overflow) {
+        std::vector<instrument::SiteStats> out;
+        std::lock_guard lock(mutex_);
+        out = retired_;
+        std::uint64_t lost = retired_overflow_;
+        for (const CounterTable* table : live_) {
+            if (table->epoch() != Epoch()) {
+                continue;
+            }
+            table->CollectInto(out);
+            lost += table->overflow();
+        }
+        if (overflow != nullptr) {
+            *overflow = lost;
+        }
+        return out;
+    }
+
+    // Live tables clear themselves at their next report
+    static void Reset() {
+        std::lock_guard lock(mutex_);
+        retired_.clear();
+        retired_overflow_ = 0;
+        epoch_.fetch_add(1, std::memory_order_relaxed);
+    }
+};
+
+// The calling thread's table, registered on first use and retired at thread exit
+class ThreadCounters {
+  private:  // data members:
+    CounterTable table_;
+
+  public:  // member functions:
+    ThreadCounters() : table_(CounterRegistry::Epoch()) {
+        CounterRegistry::Register(&table_);
+    }
+
+    ThreadCounters(const ThreadCounters&) = delete;
+    ThreadCounters& operator=(const ThreadCounters&) = delete;
+
+    ~ThreadCounters() {
+        CounterRegistry::Retire(&table_);
+    }
+
+    void Count(instrument::Event event, const std::source_location& site, std::string_view type) noexcept {
+        table_.Count(event, site, type, CounterRegistry::Epoch());
+    }
+
+    static ThreadCounters& Get() {
+        thread_local ThreadCounters counters;
+        return counters;
+    }
+};
+
+}  // namespace eav::detail
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <atomic>
+#include <source_location>
+#include <string_view>
+
+#include "../../Detail/Compiler.hpp"
+#include "Counters.hpp"
+#include "TypeName.hpp"
+
+namespace eav::instrument {
+
+// The default sink: per-thread counters, read with Snapshot()/Dump()
+inline void CountingSink(const Report& report) noexcept {
+    detail::ThreadCounters::Get().Count(report.event, report.site, report.type_name);
+}
+
+}  // namespace eav::instrument
+
+namespace eav::detail {
+
+inline std::atomic<instrument::Sink> instrument_sink{&instrument::CountingSink};
+
+// Out of line: the error paths of the instrumented code stay small
+EAV_NOINLINE inline void Record(instrument::Event event, const std::source_location& site,
+                                std::string_view type) noexcept {
+    if (instrument::Sink sink = instrument_sink.load(std::memory_order_acquire)) {
+        sink(instrument::Report{event, site, type});
+    }
+}
+
+}  // namespace eav::detail
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <string_view>
+
+namespace eav::detail {
+
+// The name of T as the compiler spells it, at compile time (no RTTI, nothing to demangle)
+template <typename T>
+constexpr std::string_view TypeName() noexcept {
+#if defined(__clang__) || defined(__GNUC__)
+    // "... TypeName() [with T = Foo; std::string_view = ...]" (GCC), "... [T = Foo]" (Clang)
+    constexpr std::string_view pretty = __PRETTY_FUNCTION__;
+    constexpr std::string_view key = "T = ";
+    constexpr auto begin = pretty.find(key) + key.size();
+    constexpr auto end = pretty.find_first_of(";]", begin);
+    return pretty.substr(begin, end - begin);
+#elif defined(_MSC_VER)
+    // "... TypeName<Foo>(void) noexcept"
+    constexpr std::string_view pretty = __FUNCSIG__;
+    constexpr auto begin = pretty.find("TypeName<") + 9;
+    constexpr auto end = pretty.rfind(">(void)");
+    return pretty.substr(begin, end - begin);
+#else
+    return "?";
+#endif
+}
+
+}  // namespace eav::detail
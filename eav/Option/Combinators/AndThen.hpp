@@ -1,8 +1,10 @@
 #pragma once
 
-#include <functional>  // std::invoke
 
-#include "../../Option.hpp"
+#include "../../Detail/Call.hpp"
+#include "../../Detail/Pipe.hpp"
+#include "../Core.hpp"
+#include "../Detail/Fuse.hpp"
 
 namespace eav::combine::option {
 
@@ -11,30 +13,53 @@ namespace pipe {
 //              (    func_     )
 // Option<T> -> (T -> Option<U>) -> Option<U>
 
-template <typename F>
-struct AndThen {
+template <typename F, BranchHint H = BranchHint::kErrorsRare>
+struct AndThen : detail::OptionStage {
+    static constexpr BranchHint kHint = H;
+
     F func_;
+    [[no_unique_address]] detail::SiteSlot site_;
 
     template <typename T>
     requires std::invocable<F, T> && concepts::IsResult<std::invoke_result_t<F, T>>
-    auto Pipe(Option<T>&& opt) {
+    constexpr auto Pipe(Option<T>&& opt) {
         using NextOpt = std::invoke_result_t<F, T>;
-        if (opt.has_value()) {
-            return std::invoke(std::move(func_), std::move(opt).unwrap());
+        if (detail::ExpectOk<H>(opt.has_value())) {
+            // Naming the result costs a move, so an immovable one is not inspected
+            if constexpr (detail::kInstrumented && std::is_move_constructible_v<NextOpt>) {
+                auto out = detail::Call(std::move(func_), detail::Access<Option<T>>::Take(std::move(opt)));
+                site_.template ReportIfEmpty<instrument::Event::kAndThen>(out);
+                return out;
+            } else {
+                return detail::Call(std::move(func_), detail::Access<Option<T>>::Take(std::move(opt)));
+            }
         }
-        return NextOpt(make::None());
+        return detail::OnErrorPath<H>([] { return detail::Access<NextOpt>::None(); });
     }
 
-    auto Pipe(Option<detail::PendingType>&& opt) {
+    constexpr auto Pipe(Option<detail::PendingType>&& opt) {
         return std::move(opt);
     }
+
+    // Lazy pipeline stage:
+    template <typename T, typename Next>
+    constexpr auto FuseSome(T&& val, const Next& next) const {
+        return Forward<H>(
+            site_.template ReportIfEmpty<instrument::Event::kAndThen>(detail::Call(func_, std::forward<T>(val))),
+            next);
+    }
+
+    template <typename Next>
+    constexpr auto FuseNone(const Next& next) const {
+        return next.None();
+    }
 };
 
 }  // namespace pipe
 
-template <typename F>
-auto AndThen(F&& func) {
-    return pipe::AndThen<F>{std::forward<F>(func)};
+template <BranchHint H = BranchHint::kErrorsRare, typename F>
+constexpr auto AndThen(F&& func EAV_SITE_PARAM) {
+    return pipe::AndThen<std::decay_t<F>, H>{{}, std::forward<F>(func), EAV_SITE_SLOT};
 }
 
 }  // namespace eav::combine::option
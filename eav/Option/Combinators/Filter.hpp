@@ -1,7 +1,9 @@
 #pragma once
 
-#include <functional>  // std::invoke
-#include "../../Option.hpp"
+#include "../../Detail/Call.hpp"
+#include "../../Detail/Pipe.hpp"
+#include "../Core.hpp"
+#include "../Detail/Fuse.hpp"
 
 namespace eav::combine::option {
 
@@ -10,32 +12,51 @@ namespace pipe {
 //              (predicate_ )
 // Option<T> -> ( T -> bool ) -> Option<T>
 
-template <typename P>
-struct Filter {
+template <typename P, BranchHint H = BranchHint::kErrorsRare>
+struct Filter : detail::OptionStage {
+    static constexpr BranchHint kHint = H;
+
     P predicate_;
+    [[no_unique_address]] detail::SiteSlot site_;
 
     template <typename T>
     requires std::invocable<P, T> && std::same_as<std::invoke_result_t<P, T>, bool>
-    auto Pipe(Option<T>&& opt) {
-        if (opt.has_value()) {
-            if (std::invoke(predicate_, opt.unwrap())) {
+    constexpr auto Pipe(Option<T>&& opt) {
+        if (detail::ExpectOk<H>(opt.has_value())) {
+            if (detail::ExpectOk<H>(detail::Call(predicate_, opt.unwrap_unchecked()))) {
                 return std::move(opt);
             }
-            return Option<T>(make::None());
+            site_.template Report<Option<T>>(instrument::Event::kFilter);
+            return detail::OnErrorPath<H>([] { return detail::Access<Option<T>>::None(); });
         }
         return std::move(opt);
     }
 
-    auto Pipe(Option<detail::PendingType>&& opt) {
+    constexpr auto Pipe(Option<detail::PendingType>&& opt) {
         return std::move(opt);
     }
+
+    // Lazy pipeline stage:
+    template <typename T, typename Next>
+    constexpr auto FuseSome(T&& val, const Next& next) const {
+        if (detail::ExpectOk<H>(detail::Call(predicate_, val))) {
+            return next.Some(std::forward<T>(val));
+        }
+        site_.template Report<Option<std::remove_cvref_t<T>>>(instrument::Event::kFilter);
+        return detail::OnErrorPath<H>([&] { return next.None(); });
+    }
+
+    template <typename Next>
+    constexpr auto FuseNone(const Next& next) const {
+        return next.None();
+    }
 };
 
 }  // namespace pipe
 
-template <typename P>
-auto Filter(P&& predicate) {
-    return pipe::Filter<std::decay_t<P>>{std::forward<P>(predicate)};
+template <BranchHint H = BranchHint::kErrorsRare, typename P>
+constexpr auto Filter(P&& predicate EAV_SITE_PARAM) {
+    return pipe::Filter<std::decay_t<P>, H>{{}, std::forward<P>(predicate), EAV_SITE_SLOT};
 }
 
 }  // namespace eav::combine::option
@@ -1,8 +1,8 @@
 #pragma once
 
-#include <functional>  // std::invoke
-
-#include "../../Option.hpp"
+#include "../../Detail/Pipe.hpp"
+#include "../Core.hpp"
+#include "../Detail/Fuse.hpp"
 
 namespace eav::combine::option {
 
@@ -11,28 +11,44 @@ namespace pipe {
 //              (  func_ )
 // Option<T> -> ( T -> U ) -> Option<U>
 
-template <typename F>
-struct Map {
+template <typename F, BranchHint H = BranchHint::kErrorsRare>
+struct Map : detail::OptionStage {
+    static constexpr BranchHint kHint = H;
+
     F func_;
 
     template <typename T> requires std::invocable<F, T>
-    auto Pipe(Option<T>&& opt) {
+    constexpr auto Pipe(Option<T>&& opt) {
         using U = std::invoke_result_t<F, T>;
-        if (opt.has_value()) {
-            return make::Some(std::invoke(std::move(func_), std::move(opt).unwrap()));
+        using Out = detail::Access<Option<U>>;
+
+        // the output is constructed in place from the return value of func_
+        if (detail::ExpectOk<H>(opt.has_value())) {
+            return Out::SomeFrom(std::move(func_), detail::Access<Option<T>>::Take(std::move(opt)));
         }
-        return Option<U>(make::None());
+        return detail::OnErrorPath<H>([] { return Out::None(); });
     }
 
-    auto Pipe(Option<detail::PendingType>&& opt) {
+    constexpr auto Pipe(Option<detail::PendingType>&& opt) {
         return std::move(opt);
     }
+
+    // Lazy pipeline stage:
+    template <typename T, typename Next>
+    constexpr auto FuseSome(T&& val, const Next& next) const {
+        return next.SomeFrom(func_, std::forward<T>(val));
+    }
+
+    template <typename Next>
+    constexpr auto FuseNone(const Next& next) const {
+        return next.None();
+    }
 };
 }  // namespace pipe
 
-template <typename F>
-auto Map(F&& func) {
-    return pipe::Map<F>{std::forward<F>(func)};
+template <BranchHint H = BranchHint::kErrorsRare, typename F>
+constexpr auto Map(F&& func) {
+    return pipe::Map<std::decay_t<F>, H>{{}, std::forward<F>(func)};
 }
 
 }  // namespace eav::combine::option
@@ -1,7 +1,9 @@
 #pragma once
 
-#include <functional>  // std::invoke
-#include "../../Option.hpp"
+#include "../../Detail/Call.hpp"
+#include "../../Detail/Pipe.hpp"
+#include "../Core.hpp"
+#include "../Detail/Fuse.hpp"
 
 namespace eav::combine::option {
 
@@ -10,28 +12,41 @@ namespace pipe {
 //              (      func_     )
 // Option<T> -> (void -> Option<T>) -> Option<T>
 
-template <typename F>
-struct OrElse {
+template <typename F, BranchHint H = BranchHint::kErrorsRare>
+struct OrElse : detail::OptionStage {
+    static constexpr BranchHint kHint = H;
+
     F func_;
 
     template <typename T>
-    auto Pipe(Option<T>&& opt) {
-        if (opt.has_value()) {
+    constexpr auto Pipe(Option<T>&& opt) {
+        if (detail::ExpectOk<H>(opt.has_value())) {
             return std::move(opt);
         }
-        return std::invoke(std::move(func_));
+        return detail::OnErrorPath<H>([&] { return detail::Call(std::move(func_)); });
+    }
+
+    constexpr auto Pipe(Option<detail::PendingType>&&) {
+        return detail::Call(std::move(func_));
+    }
+
+    // Lazy pipeline stage:
+    template <typename T, typename Next>
+    constexpr auto FuseSome(T&& val, const Next& next) const {
+        return next.Some(std::forward<T>(val));
     }
 
-    auto Pipe(Option<detail::PendingType>&&) {
-        return std::invoke(std::move(func_));
+    template <typename Next>
+    constexpr auto FuseNone(const Next& next) const {
+        return Forward<H>(detail::Call(func_), next);
     }
 };
 
 }  // namespace pipe
 
-template <typename F>
-auto OrElse(F&& func) {
-    return pipe::OrElse<std::decay_t<F>>{std::forward<F>(func)};
+template <BranchHint H = BranchHint::kErrorsRare, typename F>
+constexpr auto OrElse(F&& func) {
+    return pipe::OrElse<std::decay_t<F>, H>{{}, std::forward<F>(func)};
 }
 
 }  // namespace eav::combine::option
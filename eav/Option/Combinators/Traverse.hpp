@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>     // std::size_t
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../Detail/Call.hpp"
+#include "../../Detail/Pipe.hpp"
+#include "../../Exec/Detail/Slots.hpp"
+#include "../../Exec/Detail/Traversable.hpp"
+#include "../../Exec/ParallelFor.hpp"
+#include "../../Exec/Policy.hpp"
+#include "../Core.hpp"
+
+namespace eav::combine::option {
+
+//                      (      func      )
+// [x_0, ..., x_{n-1}] -> ( x -> Option<U> ) -> Option<std::vector<U>>
+//
+// Some with all values in input order, or None as soon as an element yields None; no further
+// elements are scheduled after that (see combine::result::Traverse)
+template <exec::ExecutionPolicy P, typename R, typename F>
+requires detail::TraversableWith<P, R> && concepts::IsResult<detail::TraverseResult<R, F>>
+auto Traverse(P policy, R&& range, F&& func) {
+    using NextOpt = detail::TraverseResult<R, F>;
+    using U = typename NextOpt::OkType;
+    using Next = detail::Access<NextOpt>;
+    using Out = detail::Access<Option<std::vector<U>>>;
+
+    if constexpr (std::same_as<P, exec::SequencedPolicy>) {
+        std::vector<U> values;
+        if constexpr (std::ranges::sized_range<R>) {
+            values.reserve(std::ranges::size(range));
+        }
+        for (auto&& elem : range) {
+            NextOpt opt = detail::Call(func, std::forward<decltype(elem)>(elem));
+            if (!opt.has_value()) {
+                return Out::None();
+            }
+            values.push_back(Next::Take(std::move(opt)));
+        }
+        return Out::Some(std::move(values));
+    } else {
+        const std::size_t n = std::ranges::size(range);
+        auto first = std::ranges::begin(range);
+        detail::Slots<U> values(n);
+
+        const std::size_t stopped_at = exec::ParallelFor(policy, n, [&](std::size_t i) {
+            NextOpt opt = detail::Call(func, first[static_cast<std::ranges::range_difference_t<R>>(i)]);
+            if (!opt.has_value()) {
+                return false;
+            }
+            values.Put(i, Next::Take(std::move(opt)));
+            return true;
+        });
+
+        if (stopped_at < n) {
+            return Out::None();
+        }
+        return Out::Some(std::move(values).Take());
+    }
+}
+
+template <typename R, typename F> requires(!exec::ExecutionPolicy<std::remove_cvref_t<R>>)
+auto Traverse(R&& range, F&& func) {
+    return Traverse(exec::seq, std::forward<R>(range), std::forward<F>(func));
+}
+
+// [Option<U>...] -> Option<std::vector<U>>; the elements of an rvalue range are moved from
+template <exec::ExecutionPolicy P, typename R> requires concepts::IsResult<std::ranges::range_value_t<R>>
+auto Collect(P policy, R&& range) {
+    using Elem = std::ranges::range_value_t<R>;
+    return Traverse(policy, range, [](auto& opt) -> Elem {
+        if constexpr (std::is_lvalue_reference_v<R>) {
+            return opt;
+        } else {
+            return std::move(opt);
+        }
+    });
+}
+
+template <typename R> requires concepts::IsResult<std::ranges::range_value_t<R>>
+auto Collect(R&& range) {
+    return Collect(exec::seq, std::forward<R>(range));
+}
+
+}  // namespace eav::combine::option
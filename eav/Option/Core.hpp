@@ -0,0 +1,115 @@
+#pragma once
+
+#include <string_view>
+#include <type_traits>
+
+#include "../Detail/Access.hpp"
+#include "../Detail/Instrument.hpp"
+#include "../Detail/Payload.hpp"
+#include "../Detail/Pending.hpp"
+#include "../Detail/Pipeline.hpp"
+#include "Detail/Storage.hpp"
+#include "Detail/Tags.hpp"
+#include "FwdDecl/None.hpp"
+#include "FwdDecl/Some.hpp"
+
+namespace eav {
+
+template <typename T> requires(!std::is_void_v<T> && !std::is_rvalue_reference_v<T>)
+class [[nodiscard]] Option {
+  public:  // nested types:
+    using OkType = T;
+    using ErrType = void;
+
+  private:  // data members:
+    // sizeof(Option<T>) == sizeof(T) if T has a niche (see eav/Traits/Niche.hpp);
+    // T = U& is held as a pointer with null as the niche (see Detail/Payload.hpp)
+    detail::OptionStorage<detail::PayloadOf<T>> storage_;
+
+  public:  // member functions:
+    // Constructors and destructor:
+    Option() = delete;
+    // Copy/move/destroy are trivial whenever they are for T
+    Option(const Option& oth) = default;
+    Option(Option&& oth) = default;
+
+    // Next constructor for Option without inferenced type (None)
+    template <typename U> requires(std::same_as<U, detail::PendingType>)
+    constexpr Option(Option<U>&& oth);
+
+    // The value of a coroutine returning Option<T> (see Coro/Detail/Return.hpp); a template, so
+    // that explicit instantiations (src/Extern.cpp) do not need the coroutine headers
+    template <typename G> requires std::same_as<G, detail::ReturnObject<Option>>
+    Option(G&& gro);  // NOLINT: implicit on purpose
+
+    ~Option() = default;
+
+    // Operators:
+    Option& operator=(const Option& oth) = default;
+    Option& operator=(Option&& oth) = default;
+
+    // Observers:
+    constexpr bool has_value() const noexcept;
+    constexpr operator bool() const noexcept;
+
+    // Accessors (for T = U& all of them return U&, and ptr() is null for None):
+    constexpr std::add_pointer_t<const T> ptr() const;
+    constexpr std::add_pointer_t<T> ptr();
+
+    constexpr const T& unwrap(std::string_view msg = "called .unwrap() on None" EAV_SITE_PARAM) const&;
+    constexpr T& unwrap(std::string_view msg = "called .unwrap() on None" EAV_SITE_PARAM) &;
+    constexpr T unwrap(std::string_view msg = "called .unwrap() on None" EAV_SITE_PARAM) &&;
+
+    // Precondition: has_value(). No check, only an optimizer hint (UB if violated)
+    constexpr const T& unwrap_unchecked() const& noexcept;
+    constexpr T& unwrap_unchecked() & noexcept;
+    constexpr T unwrap_unchecked() &&;
+
+    constexpr T unwrap_or(T&& else_val) const&;
+    constexpr T unwrap_or(T&& else_val) &&;
+
+    template <typename U> requires std::same_as<T, detail::PendingType>
+    constexpr U unwrap_or(U&& else_val) const&;
+
+    // Modifiers:
+    // Destroy the current value (if any) and construct a new one from `args...` in its place;
+    // if construction throws, the Option is left None
+    // emplace(ref) rebinds an Option<U&>
+    template <typename... Args>
+    constexpr T& emplace(Args&&... args);
+
+    // Conversion: borrowed view, an Option<const T&> referring to the value of *this (nothing
+    // is copied). It must not outlive *this, so there is none of a temporary
+    constexpr Option<const T&> as_ref() const& noexcept;
+    void as_ref() const&& = delete;
+
+  private:  // member functions:
+    // Private constructors that are called by friend functions Some(...), None() and detail::Access;
+    template <typename... Args>
+    constexpr explicit Option(detail::SomeTag, Args&&... args);
+
+    // Some constructed in place from the result of func(args...)
+    template <typename F, typename... Args>
+    constexpr Option(detail::InvokeTag, detail::SomeTag, F&& func, Args&&... args);
+
+    constexpr Option(detail::NoneTag);
+
+  private:  // friends declaration:
+    template <typename U>
+    friend constexpr Option<std::decay_t<U>> make::Some(U&&);
+
+    friend constexpr Option<detail::PendingType> make::None();
+
+    template <typename U> requires(!std::is_void_v<U> && !std::is_rvalue_reference_v<U>)
+    friend class Option;
+
+    template <typename R>
+    friend struct detail::Access;
+};
+
+}  // namespace eav
+
+// The definitions; the combinators are separate (Combinators/*.hpp, or all of them with <eav/Option.hpp>)
+#include "Detail/OptionImpl.hpp"
+#include "Make.hpp"
+#include "../Traits/Relocatable.hpp"
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <utility>
+
+#include "../../Detail/Access.hpp"
+#include "../../Detail/Payload.hpp"
+#include "../FwdDecl/Option.hpp"
+#include "Tags.hpp"
+
+namespace eav::detail {
+
+template <typename T>
+struct Access<Option<T>> {
+    // Some constructed in place from `args...`
+    template <typename... Args>
+    static constexpr Option<T> Some(Args&&... args) {
+        return Option<T>(SomeTag{}, std::forward<Args>(args)...);
+    }
+
+    static constexpr Option<T> None() {
+        return Option<T>(NoneTag{});
+    }
+
+    // Some constructed in place from the prvalue returned by func(args...)
+    template <typename F, typename... Args>
+    static constexpr Option<T> SomeFrom(F&& func, Args&&... args) {
+        return Option<T>(InvokeTag{}, SomeTag{}, std::forward<F>(func), std::forward<Args>(args)...);
+    }
+
+    // The value of an rvalue Option, without moving it out (precondition: has_value()).
+    // T&& for an object type, U& for T = U&
+    static constexpr decltype(auto) Take(Option<T>&& opt) noexcept {
+        return Unwrap(std::move(*opt.storage_.ptr()));
+    }
+
+    // The same for a borrowed Option: const T& (U& for T = U&)
+    static constexpr decltype(auto) Peek(const Option<T>& opt) noexcept {
+        return Unwrap(*opt.storage_.ptr());
+    }
+};
+
+}  // namespace eav::detail
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>     // std::size_t
+#include <tuple>
+#include <utility>
+
+#include "../../Detail/Call.hpp"
+#include "../../Detail/Hint.hpp"
+#include "../../Detail/Pending.hpp"
+#include "../../Detail/Pipeline.hpp"
+#include "../FwdDecl/Option.hpp"
+#include "Access.hpp"
+#include "Tags.hpp"
+
+namespace eav::detail {
+
+// Continuation = "the rest of the pipeline starting at stage I". The last one builds the
+// final Option; `SomeFrom` lets it construct a stage output in place
+template <typename Out, typename Stages, std::size_t I>
+struct OptionCont {
+    const Stages& stages_;
+
+    template <typename T>
+    constexpr Out Some(T&& val) const {
+        if constexpr (I == std::tuple_size_v<Stages>) {
+            return Access<Out>::Some(std::forward<T>(val));
+        } else {
+            return std::get<I>(stages_).FuseSome(std::forward<T>(val), OptionCont<Out, Stages, I + 1>{stages_});
+        }
+    }
+
+    constexpr Out None() const {
+        if constexpr (I == std::tuple_size_v<Stages>) {
+            return Access<Out>::None();
+        } else {
+            return std::get<I>(stages_).FuseNone(OptionCont<Out, Stages, I + 1>{stages_});
+        }
+    }
+
+    // = Some(func(args...))
+    template <typename F, typename... Args>
+    constexpr Out SomeFrom(F&& func, Args&&... args) const {
+        if constexpr (I == std::tuple_size_v<Stages>) {
+            return Access<Out>::SomeFrom(std::forward<F>(func), std::forward<Args>(args)...);
+        } else {
+            return Some(detail::Call(std::forward<F>(func), std::forward<Args>(args)...));
+        }
+    }
+};
+
+// Base of every Option combinator: marks it as a stage of a lazy Option pipeline.
+// A stage provides
+//   FuseSome(T&& val, const Next& next) const  => next.Some(...) or next.None()
+//   FuseNone(const Next& next) const           => next.Some(...) or next.None()
+// (or next.SomeFrom(func, args...) for a value computed by the stage)
+// and `static constexpr BranchHint kHint`, the expected outcome of the branch on its input.
+struct OptionStage {
+    using StageKind = OptionStage;
+
+    template <typename Stages, typename T>
+    static constexpr auto Run(const Stages& stages, Option<T>&& src) {
+        using Out = typename FusedOutput<Option<T>, Stages>::Type;
+        return Forward<FirstHint<Stages>>(std::move(src), OptionCont<Out, Stages, 0>{stages});
+    }
+
+    // A borrowed source (see Borrow in Detail/Pipeline.hpp): the output type is the same, the
+    // stages see const T&
+    template <typename Stages, typename T>
+    static constexpr auto Run(const Stages& stages, const Option<T>& src) {
+        using Out = typename FusedOutput<Option<T>, Stages>::Type;
+        return Forward<FirstHint<Stages>>(src, OptionCont<Out, Stages, 0>{stages});
+    }
+
+    // Hands the value of an Option produced inside a stage (AndThen, OrElse) to `next`
+    template <BranchHint H, typename T, typename Next>
+    static constexpr auto Forward(Option<T>&& opt, const Next& next) {
+        if constexpr (!std::same_as<T, PendingType>) {
+            if (ExpectOk<H>(opt.has_value())) {
+                return next.Some(Access<Option<T>>::Take(std::move(opt)));
+            }
+        }
+        return OnErrorPath<H>([&] { return next.None(); });
+    }
+
+    template <BranchHint H, typename T, typename Next>
+    static constexpr auto Forward(const Option<T>& opt, const Next& next) {
+        if constexpr (!std::same_as<T, PendingType>) {
+            if (ExpectOk<H>(opt.has_value())) {
+                return next.Some(Access<Option<T>>::Peek(opt));
+            }
+        }
+        return OnErrorPath<H>([&] { return next.None(); });
+    }
+};
+
+}  // namespace eav::detail
@@ -1,110 +1,156 @@
 #pragma once
 
-#include <new>  // placement new
-#include <stdexcept>
+#include <memory>  // std::addressof
+#include <type_traits>
 
-#include "../../Option.hpp"
+#include "../../Detail/Compiler.hpp"
+#include "../../Detail/Panic.hpp"
+#include "../Core.hpp"
 
 namespace eav {
 
 // --- Constructors ---
 
-template <typename T> requires(!std::is_void_v<T>)
-template <typename U> requires std::constructible_from<T, U>
-Option<T>::Option(detail::SomeTag, U&& val) : has_value_(true) {
-    new (storage_) T(std::forward<U>(val));
+template <typename T> requires(!std::is_void_v<T> && !std::is_rvalue_reference_v<T>)
+template <typename... Args>
+constexpr Option<T>::Option(detail::SomeTag, Args&&... args) : storage_(detail::SomeTag{}, std::forward<Args>(args)...) {}
+
+template <typename T> requires(!std::is_void_v<T> && !std::is_rvalue_reference_v<T>)
+template <typename F, typename... Args>
+constexpr Option<T>::Option(detail::InvokeTag, detail::SomeTag, F&& func, Args&&... args)
+    : storage_(detail::InvokeTag{}, detail::SomeTag{}, std::forward<F>(func), std::forward<Args>(args)...) {}
+
+template <typename T> requires(!std::is_void_v<T> && !std::is_rvalue_reference_v<T>)
+constexpr Option<T>::Option(detail::NoneTag) : storage_(detail::NoneTag{}) {}
+
+// Option<?> is always None
+template <typename T> requires(!std::is_void_v<T> && !std::is_rvalue_reference_v<T>)
+template <typename U> requires(std::same_as<U, detail::PendingType>)
+constexpr Option<T>::Option(Option<U>&&) : storage_(detail::NoneTag{}) {}
+
+template <typename T> requires(!std::is_void_v<T> && !std::is_rvalue_reference_v<T>)
+template <typename G> requires std::same_as<G, detail::ReturnObject<Option<T>>>
+Option<T>::Option(G&& gro) : Option(std::move(gro.Take(this))) {}
+
+// --- Operators ---
+
+template <typename T> requires(!std::is_void_v<T> && !std::is_rvalue_reference_v<T>)
+constexpr Option<T>::operator bool() const noexcept {
+    return storage_.has_value();
 }
 
-template <typename T> requires(!std::is_void_v<T>)
-Option<T>::Option(detail::NoneTag) : has_value_(false) {}
+// --- Observers ---
 
-template <typename T> requires(!std::is_void_v<T>)
-Option<T>::~Option() {
-    if (has_value_) {
-        ptr()->~T();
-    }
+template <typename T> requires(!std::is_void_v<T> && !std::is_rvalue_reference_v<T>)
+constexpr bool Option<T>::has_value() const noexcept {
+    return storage_.has_value();
 }
 
-template <typename T> requires(!std::is_void_v<T>)
-Option<T>::Option(const Option& oth) : has_value_(oth.has_value_) {
-    if (has_value_) {
-        new (storage_) T(*oth.ptr());
+// --- Accessors: unwrap ---
+
+template <typename T> requires(!std::is_void_v<T> && !std::is_rvalue_reference_v<T>)
+constexpr const T& Option<T>::unwrap(std::string_view msg EAV_SITE_PARAM_NODEFAULT) const& {
+    if (!has_value()) [[unlikely]] {
+        EAV_REPORT(Option, kUnwrapMisuse);
+        detail::Panic(msg);
     }
+    return detail::Unwrap(*storage_.ptr());
 }
 
-template <typename T> requires(!std::is_void_v<T>)
-Option<T>::Option(Option&& oth) noexcept(std::is_nothrow_move_constructible_v<T>)
-    : has_value_(oth.has_value_) {
-    if (has_value_) {
-        new (storage_) T(std::move(*reinterpret_cast<T*>(oth.storage_)));
+template <typename T> requires(!std::is_void_v<T> && !std::is_rvalue_reference_v<T>)
+constexpr T& Option<T>::unwrap(std::string_view msg EAV_SITE_PARAM_NODEFAULT) & {
+    if (!has_value()) [[unlikely]] {
+        EAV_REPORT(Option, kUnwrapMisuse);
+        detail::Panic(msg);
     }
+    return detail::Unwrap(*storage_.ptr());
 }
 
-template <typename T> requires(!std::is_void_v<T>)
-template <typename U> requires(std::same_as<U, detail::PendingType>)
-Option<T>::Option(Option<U>&& oth) : has_value_(oth.has_value()) {
-    if (has_value_) {
-        new (storage_) T(std::move(*reinterpret_cast<T*>(oth.storage_)));
+template <typename T> requires(!std::is_void_v<T> && !std::is_rvalue_reference_v<T>)
+constexpr T Option<T>::unwrap(std::string_view msg EAV_SITE_PARAM_NODEFAULT) && {
+    if (!has_value()) [[unlikely]] {
+        EAV_REPORT(Option, kUnwrapMisuse);
+        detail::Panic(msg);
     }
+    return detail::Unwrap(std::move(*storage_.ptr()));
 }
 
-// --- Operators ---
+// --- Accessors: unwrap_unchecked ---
 
-template <typename T> requires(!std::is_void_v<T>)
-Option<T>::operator bool() const noexcept {
-    return has_value_;
+template <typename T> requires(!std::is_void_v<T> && !std::is_rvalue_reference_v<T>)
+constexpr const T& Option<T>::unwrap_unchecked() const& noexcept {
+    EAV_ASSUME(has_value());
+    return detail::Unwrap(*storage_.ptr());
 }
 
-// --- Observers ---
+template <typename T> requires(!std::is_void_v<T> && !std::is_rvalue_reference_v<T>)
+constexpr T& Option<T>::unwrap_unchecked() & noexcept {
+    EAV_ASSUME(has_value());
+    return detail::Unwrap(*storage_.ptr());
+}
 
-template <typename T> requires(!std::is_void_v<T>)
-bool Option<T>::has_value() const noexcept {
-    return has_value_;
+template <typename T> requires(!std::is_void_v<T> && !std::is_rvalue_reference_v<T>)
+constexpr T Option<T>::unwrap_unchecked() && {
+    EAV_ASSUME(has_value());
+    return detail::Unwrap(std::move(*storage_.ptr()));
 }
 
-// --- Accessors: unwrap ---
+// --- Accessors: unwrap_or ---
 
-template <typename T> requires(!std::is_void_v<T>)
-constexpr const T& Option<T>::unwrap(std::string_view msg) const& {
-    if (!has_value_) throw std::runtime_error(std::string(msg));
-    return *ptr();
+template <typename T> requires(!std::is_void_v<T> && !std::is_rvalue_reference_v<T>)
+constexpr T Option<T>::unwrap_or(T&& else_val) const& {
+    if (has_value()) return detail::Unwrap(*storage_.ptr());
+    return std::forward<T>(else_val);
 }
 
-template <typename T> requires(!std::is_void_v<T>)
-constexpr T& Option<T>::unwrap(std::string_view msg) & {
-    if (!has_value_) throw std::runtime_error(std::string(msg));
-    return *ptr();
+template <typename T> requires(!std::is_void_v<T> && !std::is_rvalue_reference_v<T>)
+constexpr T Option<T>::unwrap_or(T&& else_val) && {
+    if (has_value()) return detail::Unwrap(std::move(*storage_.ptr()));
+    return std::forward<T>(else_val);
 }
 
-template <typename T> requires(!std::is_void_v<T>)
-constexpr T Option<T>::unwrap(std::string_view msg) && {
-    if (!has_value_) throw std::runtime_error(std::string(msg));
-    return *ptr();
+template <typename T> requires(!std::is_void_v<T> && !std::is_rvalue_reference_v<T>)
+template <typename U> requires std::same_as<T, detail::PendingType>
+constexpr U Option<T>::unwrap_or(U&& else_val) const& {
+    return std::forward<U>(else_val);
 }
 
-// --- Accessors: unwrap_or ---
+// --- Accessors: ptr ---
 
-template <typename T> requires(!std::is_void_v<T>)
-constexpr T Option<T>::unwrap_or(T&& else_val) const& {
-    return has_value_ ? *ptr() : else_val;
+template <typename T> requires(!std::is_void_v<T> && !std::is_rvalue_reference_v<T>)
+constexpr std::add_pointer_t<const T> Option<T>::ptr() const {
+    if constexpr (std::is_reference_v<T>) {
+        return has_value() ? std::addressof(storage_.ptr()->get()) : nullptr;
+    } else {
+        return storage_.ptr();
+    }
 }
 
-template <typename T> requires(!std::is_void_v<T>)
-template <typename U> requires std::same_as<T, detail::PendingType>
-constexpr U Option<T>::unwrap_or(U&& else_val) const& {
-    return else_val;
+template <typename T> requires(!std::is_void_v<T> && !std::is_rvalue_reference_v<T>)
+constexpr std::add_pointer_t<T> Option<T>::ptr() {
+    if constexpr (std::is_reference_v<T>) {
+        return has_value() ? std::addressof(storage_.ptr()->get()) : nullptr;
+    } else {
+        return storage_.ptr();
+    }
 }
 
-// --- Accessors: ptr ---
+// --- Modifiers ---
 
-template <typename T> requires(!std::is_void_v<T>)
-const T* Option<T>::ptr() const {
-    return reinterpret_cast<const T*>(storage_);
+template <typename T> requires(!std::is_void_v<T> && !std::is_rvalue_reference_v<T>)
+template <typename... Args>
+constexpr T& Option<T>::emplace(Args&&... args) {
+    return detail::Unwrap(storage_.emplace(std::forward<Args>(args)...));
 }
 
-template <typename T> requires(!std::is_void_v<T>)
-T* Option<T>::ptr() {
-    return reinterpret_cast<T*>(storage_);
+// --- Conversion: borrowed view ---
+
+template <typename T> requires(!std::is_void_v<T> && !std::is_rvalue_reference_v<T>)
+constexpr Option<const T&> Option<T>::as_ref() const& noexcept {
+    if (has_value()) {
+        return detail::Access<Option<const T&>>::Some(detail::Unwrap(*storage_.ptr()));
+    }
+    return detail::Access<Option<const T&>>::None();
 }
 
 }  // namespace eav
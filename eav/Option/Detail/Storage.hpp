@@ -0,0 +1,190 @@
+#pragma once
+
+#include <memory>      // std::addressof, std::construct_at, std::destroy_at
+#include <type_traits>
+#include <utility>
+
+#include "../../Concepts/HasNiche.hpp"
+#include "../../Detail/Access.hpp"
+#include "../../Detail/Payload.hpp"
+#include "../../Detail/SpecialMembers.hpp"
+#include "Tags.hpp"
+
+namespace eav::detail {
+
+// Generic layout: union { T } + separate flag (a union, not a char buffer, so that it can be
+// used in constant expressions)
+
+// Union with trivial destructor if T has one; the value is destroyed by the payload
+template <typename T, bool = std::is_trivially_destructible_v<T>>
+union OptionUnion {
+    char none_;
+    T value_;
+
+    constexpr OptionUnion() noexcept : none_() {}
+
+    template <typename... Args>
+    constexpr explicit OptionUnion(SomeTag, Args&&... args) : value_(std::forward<Args>(args)...) {}
+
+    template <typename F, typename... Args>
+    constexpr OptionUnion(InvokeTag, SomeTag, F&& func, Args&&... args)
+        : value_(Invoke(std::forward<F>(func), std::forward<Args>(args)...)) {}
+};
+
+template <typename T>
+union OptionUnion<T, false> {
+    char none_;
+    T value_;
+
+    constexpr OptionUnion() noexcept : none_() {}
+
+    template <typename... Args>
+    constexpr explicit OptionUnion(SomeTag, Args&&... args) : value_(std::forward<Args>(args)...) {}
+
+    template <typename F, typename... Args>
+    constexpr OptionUnion(InvokeTag, SomeTag, F&& func, Args&&... args)
+        : value_(Invoke(std::forward<F>(func), std::forward<Args>(args)...)) {}
+
+    constexpr ~OptionUnion() {}
+};
+
+template <typename T>
+class OptionPayload {
+  private:  // data members:
+    OptionUnion<T> union_;
+    bool has_value_;
+
+  public:  // member functions:
+    constexpr explicit OptionPayload(NoneTag) noexcept : union_(), has_value_(false) {}
+
+    template <typename... Args>
+    constexpr explicit OptionPayload(SomeTag, Args&&... args)
+        : union_(SomeTag{}, std::forward<Args>(args)...), has_value_(true) {}
+
+    template <typename F, typename... Args>
+    constexpr OptionPayload(InvokeTag, SomeTag, F&& func, Args&&... args)
+        : union_(InvokeTag{}, SomeTag{}, std::forward<F>(func), std::forward<Args>(args)...), has_value_(true) {}
+
+    // Copy/move from another payload (see Detail/SpecialMembers.hpp)
+    template <typename Oth>
+    constexpr OptionPayload(FromStorageTag, Oth&& oth) noexcept(NothrowFrom<Oth>())
+        : union_(), has_value_(oth.has_value_) {
+        if (has_value_) {
+            std::construct_at(&union_.value_, std::forward<Oth>(oth).union_.value_);
+        }
+    }
+
+    constexpr bool has_value() const noexcept {
+        return has_value_;
+    }
+
+    constexpr const T* ptr() const noexcept {
+        return std::addressof(union_.value_);
+    }
+
+    constexpr T* ptr() noexcept {
+        return std::addressof(union_.value_);
+    }
+
+    constexpr void destroy() noexcept {
+        if (has_value_) {
+            std::destroy_at(&union_.value_);
+        }
+    }
+
+    constexpr void reset() noexcept {
+        destroy();
+        has_value_ = false;
+    }
+
+    // If construction throws, the Option is left None
+    template <typename... Args>
+    constexpr T& emplace(Args&&... args) {
+        reset();
+        std::construct_at(&union_.value_, std::forward<Args>(args)...);
+        has_value_ = true;
+        return union_.value_;
+    }
+
+    template <typename Oth>
+    constexpr void assign_from(Oth&& oth) noexcept(NothrowFrom<Oth>() && std::is_nothrow_assignable_v<T&, ValueOf<Oth>>) {
+        if (has_value_ && oth.has_value_) {
+            union_.value_ = std::forward<Oth>(oth).union_.value_;
+        } else if (oth.has_value_) {
+            std::construct_at(&union_.value_, std::forward<Oth>(oth).union_.value_);
+            has_value_ = true;
+        } else {
+            reset();
+        }
+    }
+
+  private:  // member functions:
+    // `const T&` or `T&&`, depending on the value category of the other payload
+    template <typename Oth>
+    using ValueOf = std::conditional_t<std::is_lvalue_reference_v<Oth>, const T&, T&&>;
+
+    template <typename Oth>
+    static constexpr bool NothrowFrom() {
+        return std::is_nothrow_constructible_v<T, ValueOf<Oth>>;
+    }
+};
+
+template <typename T>
+using OptionGenericStorage = WithSpecialMembers<OptionPayload<T>, T>;
+
+// Niche layout: T is always alive, None is encoded as NicheTraits<T>::none(); the special
+// members are the implicit ones of T
+template <typename T>
+class OptionNicheStorage {
+  private:  // data members:
+    T value_;
+
+  public:  // member functions:
+    constexpr explicit OptionNicheStorage(NoneTag) noexcept : value_(NicheTraits<T>::none()) {}
+
+    template <typename... Args>
+    constexpr explicit OptionNicheStorage(SomeTag, Args&&... args) : value_(std::forward<Args>(args)...) {}
+
+    template <typename F, typename... Args>
+    constexpr OptionNicheStorage(InvokeTag, SomeTag, F&& func, Args&&... args)
+        : value_(Invoke(std::forward<F>(func), std::forward<Args>(args)...)) {}
+
+    constexpr bool has_value() const noexcept {
+        return !NicheTraits<T>::is_none(value_);
+    }
+
+    constexpr const T* ptr() const noexcept {
+        return &value_;
+    }
+
+    constexpr T* ptr() noexcept {
+        return &value_;
+    }
+
+    constexpr void reset() noexcept {
+        value_ = NicheTraits<T>::none();
+    }
+
+    template <typename... Args>
+    constexpr T& emplace(Args&&... args) {
+        value_ = T(std::forward<Args>(args)...);
+        return value_;
+    }
+};
+
+// --- Layout selection ---
+
+template <typename T>
+struct SelectOptionStorage {
+    using Type = OptionGenericStorage<T>;
+};
+
+template <typename T> requires concepts::HasNiche<T>
+struct SelectOptionStorage<T> {
+    using Type = OptionNicheStorage<T>;
+};
+
+template <typename T>
+using OptionStorage = typename SelectOptionStorage<T>::Type;
+
+}  // namespace eav::detail
@@ -6,6 +6,6 @@
 namespace eav::make {
 
 // None() => Option<?>
-inline Option<detail::PendingType> None();
+constexpr Option<detail::PendingType> None();
 
 }  // namespace eav::make
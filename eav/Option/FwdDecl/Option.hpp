@@ -1,10 +1,10 @@
 #pragma once
 
-#include <type_traits>  // std::is_void_v
+#include <type_traits>  // std::is_void_v, std::is_rvalue_reference_v
 
 namespace eav {
 
-template <typename T> requires(!std::is_void_v<T>)
+template <typename T> requires(!std::is_void_v<T> && !std::is_rvalue_reference_v<T>)
 class Option;
 
 }  // namespace eav
@@ -1,9 +1,10 @@
 #pragma once
 
 #include <type_traits>  // std::decay_t
-#include <utility>      // std::forward
+#include <utility>      // std::forward, std::in_place_t
 
 #include "../Detail/Pending.hpp"
+#include "Detail/Access.hpp"
 #include "Detail/Tags.hpp"
 #include "FwdDecl/Option.hpp"
 
@@ -11,12 +12,28 @@ namespace eav::make {
 
 // Some(T) => Option<T>
 template <typename T>
-Option<std::decay_t<T>> Some(T&& val) {
+constexpr Option<std::decay_t<T>> Some(T&& val) {
     return Option<std::decay_t<T>>(detail::SomeTag{}, std::forward<T>(val));
 }
 
+// Some<T>(std::in_place, args...) => Option<T>, T constructed from `args...` inside the Option
+// (works for non-movable T)
+template <typename T, typename... Args>
+constexpr Option<T> Some(std::in_place_t, Args&&... args) {
+    return detail::Access<Option<T>>::Some(std::forward<Args>(args)...);
+}
+
+// SomeRef(T&) => Option<T&>, refers to `ref` (no copy)
+template <typename T>
+constexpr Option<T&> SomeRef(T& ref) {
+    return detail::Access<Option<T&>>::Some(ref);
+}
+
+template <typename T>
+void SomeRef(const T&&) = delete;
+
 // None() => Option<?>
-inline Option<detail::PendingType> None() {
+constexpr Option<detail::PendingType> None() {
     return Option<detail::PendingType>(detail::NoneTag{});
 }
 
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <concepts>  // std::default_initializable
+#include <cstddef>   // std::size_t
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "Batch/Detail/Bitmap.hpp"
+#include "Detail/Access.hpp"
+#include "Option.hpp"
+
+namespace eav {
+
+// Columnar batch of Option<T>: a packed validity bitmap (bit i <=> row i is Some) and one
+// contiguous column of T; None rows hold a default-constructed T (see ResultVector.hpp)
+template <typename T>
+requires(!std::is_void_v<T> && std::default_initializable<T>)
+class OptionVector {
+  public:  // nested types:
+    using value_type = Option<T>;
+
+  private:  // data members:
+    detail::Bitmap valid_;
+    std::vector<T> values_;
+
+  public:  // member functions:
+    // Constructors and destructor:
+    OptionVector() = default;
+    OptionVector(const OptionVector&) = default;
+    OptionVector(OptionVector&&) = default;
+
+    // Conversion: std::vector<Option<T>> => OptionVector<T>
+    constexpr explicit OptionVector(std::vector<Option<T>>&& rows);
+
+    ~OptionVector() = default;
+
+    // Operators:
+    OptionVector& operator=(const OptionVector&) = default;
+    OptionVector& operator=(OptionVector&&) = default;
+
+    // Observers:
+    constexpr std::size_t size() const noexcept;
+    constexpr bool empty() const noexcept;
+    constexpr std::size_t some_count() const noexcept;
+    constexpr bool has_value(std::size_t i) const noexcept;
+
+    // Accessors:
+    // Row i as an Option (copies the value)
+    constexpr Option<T> operator[](std::size_t i) const;
+
+    // The whole column; values()[i] is meaningful only if has_value(i)
+    constexpr std::span<T> values() noexcept;
+    constexpr std::span<const T> values() const noexcept;
+    constexpr const detail::Bitmap& validity() const noexcept;
+
+    // Modifiers:
+    template <typename... Args>
+    constexpr void push_some(Args&&... args);
+
+    constexpr void push_none();
+    constexpr void push_back(Option<T>&& opt);
+    constexpr void reserve(std::size_t n);
+    constexpr void clear() noexcept;
+
+    // Conversion: OptionVector<T> => std::vector<Option<T>>
+    constexpr std::vector<Option<T>> to_vector() const&;
+    constexpr std::vector<Option<T>> to_vector() &&;
+
+  private:  // member functions:
+    // Assembled by batch combinators from ready columns (of the same size)
+    constexpr OptionVector(detail::Bitmap&& valid, std::vector<T>&& values);
+
+  private:  // friends declaration:
+    template <typename R>
+    friend struct detail::Access;
+};
+
+}  // namespace eav
+
+// for including 'OptionVector' "module" via '#include <eav/OptionVector.hpp>':
+#include "Batch/OptionCombinators.hpp"
+#include "Batch/Detail/OptionVectorImpl.hpp"
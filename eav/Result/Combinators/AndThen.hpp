@@ -1,43 +1,85 @@
 #pragma once
 
 #include "../../Concepts/IsResult.hpp"
-#include "../../Result.hpp"
-
-#include <functional>
+#include "../../Detail/Pipe.hpp"
+#include "../Core.hpp"
+#include "../Detail/Fuse.hpp"
+#include "../Detail/Merge.hpp"
 
 namespace eav::combine::result {
 
 namespace pipe {
 
-//                 (      func_      )
-// Result<T, E> -> (T -> Result<U, E>) -> Result<U, E>
+//                 (      func_       )
+// Result<T, E> -> (T -> Result<U, E2>) -> Result<U, ErrorUnion<E, E2>>
+
+// The output error is E2 when E is the same type or converts to it, E when func_ cannot fail
+// (E2 = PendingType) and otherwise the union of both (see detail::WidenedError), so steps that
+// fail with different error types chain without converting them to a common one.
+
+template <typename F, BranchHint H = BranchHint::kErrorsRare>
+struct AndThen : detail::ResultStage {
+    static constexpr BranchHint kHint = H;
 
-template <typename F>
-struct AndThen {
     F func_;
+    [[no_unique_address]] detail::SiteSlot site_;
 
     template <typename T, concepts::IsError E>
-    requires std::invocable<F, T> && concepts::IsResult<std::invoke_result_t<F, T>>
-    auto Pipe(Result<T, E>&& res) {
-        using NextResultT = std::invoke_result_t<F, T>;
+    requires detail::InvocableOn<F, T> && concepts::IsResult<detail::InvokeResultOn<F, T>>
+    constexpr auto Pipe(Result<T, E>&& res) {
+        using StageResultT = detail::InvokeResultOn<F, T>;
+        using NextResultT =
+            Result<typename StageResultT::OkType, detail::WidenedError<E, typename StageResultT::ErrType>>;
+        using In = detail::Access<Result<T, E>>;
 
-        if (res.is_ok()) {
-            return std::invoke(std::move(func_), std::move(res).unwrap_ok());
+        if constexpr (!std::same_as<E, detail::PendingType>) {
+            if (!detail::ExpectOk<H>(res.is_ok())) {
+                return detail::OnErrorPath<H>(
+                    [&] { return detail::Access<NextResultT>::Err(In::TakeErr(std::move(res))); });
+            }
+        }
+        // Naming the result costs a move, so an immovable one is not inspected
+        if constexpr (detail::kInstrumented && std::is_move_constructible_v<StageResultT>) {
+            auto out = detail::Invoke(std::move(func_), In::TakeOk(std::move(res)));
+            site_.template ReportIfEmpty<instrument::Event::kAndThen>(out);
+            if constexpr (std::same_as<NextResultT, StageResultT>) {
+                return out;
+            } else {
+                return detail::Rewrap<NextResultT>(std::move(out));
+            }
+        } else if constexpr (std::same_as<NextResultT, StageResultT>) {
+            return detail::Invoke(std::move(func_), In::TakeOk(std::move(res)));
+        } else {
+            // the error type is widened: the payload moves once more, into the wider Result
+            return detail::Rewrap<NextResultT>(detail::Invoke(std::move(func_), In::TakeOk(std::move(res))));
         }
-        return NextResultT(make::Err(std::move(res).unwrap_err()));
     }
 
     template <concepts::IsError E>
-    auto Pipe(Result<detail::PendingType, E>&& res) {
-        return res;
+    constexpr auto Pipe(Result<detail::PendingType, E>&& res) {
+        return std::move(res);
+    }
+
+    // Lazy pipeline stage:
+    template <typename T, typename Next>
+    constexpr auto FuseOk(T&& val, const Next& next) const {
+        return Forward<H>(
+            site_.template ReportIfEmpty<instrument::Event::kAndThen>(detail::Invoke(func_, std::forward<T>(val))),
+            next);
+    }
+
+    template <typename E, typename Next>
+    constexpr auto FuseErr(E&& err, const Next& next) const {
+        return next.Err(std::forward<E>(err));
     }
 };
 
 }  // namespace pipe
 
-template <typename F>
-auto AndThen(F&& func) {
-    return pipe::AndThen<F>{std::forward<F>(func)};
+// AndThen<BranchHint::kErrorsCommon>(func): the layout for a stage that fails often
+template <BranchHint H = BranchHint::kErrorsRare, typename F>
+constexpr auto AndThen(F&& func EAV_SITE_PARAM) {
+    return pipe::AndThen<std::decay_t<F>, H>{{}, std::forward<F>(func), EAV_SITE_SLOT};
 }
 
 }  // namespace eav::combine::result
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>  // std::size_t
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../../Detail/Pipe.hpp"
+#include "../../Error/ContextArena.hpp"
+#include "../../Error/WithContext.hpp"
+#include "../Core.hpp"
+#include "../Detail/Fuse.hpp"
+
+namespace eav::combine::result {
+
+namespace pipe {
+
+//                 (      fmt, args...      )
+// Result<T, E> -> ( E -> WithContext<E>     ) -> Result<T, WithContext<E>>
+//
+// Ok passes through untouched (nothing is formatted, copied or allocated). An Err gets the
+// message recorded in the calling thread's ContextArena; WithContext<E> errors collect the
+// messages of every Context stage they pass.
+
+template <BranchHint H, typename... Args>
+struct Context : detail::ResultStage {
+    static constexpr BranchHint kHint = H;
+
+    std::string_view fmt_;
+    std::tuple<Args...> args_;
+
+    constexpr explicit Context(std::string_view fmt, Args... args) : fmt_(fmt), args_(std::move(args)...) {}
+
+    template <typename T, concepts::IsError E>
+    constexpr auto Pipe(Result<T, E>&& res) {
+        using In = detail::Access<Result<T, E>>;
+        using Out = detail::Access<Result<T, detail::ContextError<E>>>;
+
+        if constexpr (!std::same_as<T, detail::PendingType>) {
+            if (detail::ExpectOk<H>(res.is_ok())) {
+                return Out::Ok(In::TakeOk(std::move(res)));
+            }
+        }
+        return detail::OnErrorPath<H>([&] { return Out::Err(Attached(In::TakeErr(std::move(res)))); });
+    }
+
+    template <typename T>
+    constexpr auto Pipe(Result<T, detail::PendingType>&& res) {
+        return std::move(res);
+    }
+
+    // Lazy pipeline stage:
+    template <typename T, typename Next>
+    constexpr auto FuseOk(T&& val, const Next& next) const {
+        return next.Ok(std::forward<T>(val));
+    }
+
+    template <typename E, typename Next>
+    constexpr auto FuseErr(E&& err, const Next& next) const {
+        return next.Err(Attached(std::forward<E>(err)));
+    }
+
+  private:
+    template <typename E>
+    detail::ContextError<std::remove_cvref_t<E>> Attached(E&& err) const {
+        detail::ContextError<std::remove_cvref_t<E>> out(std::forward<E>(err));
+        std::apply([&](const auto&... args) { out.Attach(ContextArena::ForThread(), fmt_, args...); }, args_);
+        return out;
+    }
+};
+
+}  // namespace pipe
+
+// Context("while parsing header {}", name): `fmt` is a string literal ("{}" stands for the next
+// argument). The stage owns copies of its arguments: strings as std::string (only those longer
+// than the small-string buffer allocate), copied into the arena when an error gets the frame;
+// numbers, enums and trivially copyable types with to_string() by value.
+template <BranchHint H = BranchHint::kErrorsRare, std::size_t N, typename... Args>
+requires(detail::ContextArg<std::remove_cvref_t<Args>> && ...)
+constexpr auto Context(const char (&fmt)[N], Args&&... args) {
+    return pipe::Context<H, detail::StageArg<std::remove_cvref_t<Args>>...>{
+        std::string_view(fmt, N - 1), detail::StageArg<std::remove_cvref_t<Args>>(std::forward<Args>(args))...};
+}
+
+}  // namespace eav::combine::result
@@ -1,8 +1,8 @@
 #pragma once
 
-#include <functional>  // std::invoke
-
-#include "../../Result.hpp"
+#include "../../Detail/Pipe.hpp"
+#include "../Core.hpp"
+#include "../Detail/Fuse.hpp"
 
 namespace eav::combine::result {
 
@@ -10,40 +10,76 @@ namespace pipe {
 
 //                 (predicate_ )
 // Result<T, E> -> ( T -> bool ) -> Result<T, E>
+//
+// A rejected Ok becomes else_err_; an Err keeps its error, eager, fused or batched alike.
+
+template <typename P, concepts::IsError E, BranchHint H = BranchHint::kErrorsRare>
+struct Filter : detail::ResultStage {
+    static constexpr BranchHint kHint = H;
 
-template <typename P, concepts::IsError E>
-struct Filter {
     P predicate_;
     E else_err_;
+    [[no_unique_address]] detail::SiteSlot site_;
 
-    explicit Filter(P&& p, E&& e) : predicate_(std::move(p)), else_err_(std::move(e)) {}
+    constexpr explicit Filter(const P& p, E&& e, detail::SiteSlot site = {})
+        : predicate_(p), else_err_(std::move(e)), site_(site) {}
+    constexpr explicit Filter(P&& p, E&& e, detail::SiteSlot site = {})
+        : predicate_(std::move(p)), else_err_(std::move(e)), site_(site) {}
 
-    auto Pipe(Result<detail::PendingType, E>&& res) {
+    constexpr auto Pipe(Result<detail::PendingType, E>&& res) {
         return std::move(res);
     }
 
-    template <typename T> requires std::invocable<P, T> && std::same_as<std::invoke_result_t<P, T>, bool>
-    auto Pipe(Result<T, detail::PendingType>&& res) {
-        if (std::invoke(predicate_, res.unwrap_ok())) {
-            return Result<T, E>(make::Ok(T{std::move(res.unwrap_ok())}));
+    template <typename T> requires detail::InvocableOn<P, T> && std::same_as<detail::InvokeResultOn<P, T>, bool>
+    constexpr auto Pipe(Result<T, detail::PendingType>&& res) {
+        using Out = detail::Access<Result<T, E>>;
+
+        auto&& val = detail::Access<Result<T, detail::PendingType>>::TakeOk(std::move(res));
+        if (detail::ExpectOk<H>(detail::Invoke(predicate_, val))) {
+            return Out::Ok(std::forward<decltype(val)>(val));
         }
-        return Result<T, E>(make::Err(E{std::move(else_err_)}));
+        site_.template Report<E>(instrument::Event::kFilter);
+        return detail::OnErrorPath<H>([&] { return Out::Err(std::move(else_err_)); });
     }
 
-    template <typename T> requires std::invocable<P, T> && std::same_as<std::invoke_result_t<P, T>, bool>
-    auto Pipe(Result<T, E>&& res) {
-        if (res.is_ok() && std::invoke(predicate_, res.unwrap_ok())) {
-            return Result<T, E>(make::Ok(T{std::move(res.unwrap_ok())}));
+    // An Err passes through with its own error, as in a lazy pipeline (FuseErr)
+    template <typename T> requires detail::InvocableOn<P, T> && std::same_as<detail::InvokeResultOn<P, T>, bool>
+    constexpr auto Pipe(Result<T, E>&& res) {
+        if (!detail::ExpectOk<H>(res.is_ok())) {
+            return std::move(res);
         }
-        return Result<T, E>(make::Err(E{std::move(else_err_)}));
+        // the value is only looked at: `res` is returned as is
+        auto&& val = detail::Access<Result<T, E>>::TakeOk(std::move(res));
+        if (detail::ExpectOk<H>(detail::Invoke(predicate_, val))) {
+            return std::move(res);
+        }
+        site_.template Report<E>(instrument::Event::kFilter);
+        return detail::OnErrorPath<H>([&] { return detail::Access<Result<T, E>>::Err(std::move(else_err_)); });
+    }
+
+    // Lazy pipeline stage (else_err_ is copied: the stage may be reused):
+    template <typename T, typename Next>
+    constexpr auto FuseOk(T&& val, const Next& next) const {
+        if (detail::ExpectOk<H>(detail::Invoke(predicate_, val))) {
+            return next.Ok(std::forward<T>(val));
+        }
+        site_.template Report<E>(instrument::Event::kFilter);
+        return detail::OnErrorPath<H>([&] { return next.ErrFrom([this] { return E(else_err_); }); });
+    }
+
+    template <typename R, typename Next>
+    constexpr auto FuseErr(R&& err, const Next& next) const {
+        return next.Err(std::forward<R>(err));
     }
 };
 
 }  // namespace pipe
 
-template <typename P, concepts::IsError E>
-auto Filter(P&& predicate, E&& else_err) {
-    return pipe::Filter{std::move(predicate), std::move(else_err)};
+// An lvalue `predicate` or `else_err` is copied into the stage
+template <BranchHint H = BranchHint::kErrorsRare, typename P, typename E> requires concepts::IsError<std::decay_t<E>>
+constexpr auto Filter(P&& predicate, E&& else_err EAV_SITE_PARAM) {
+    using Stage = pipe::Filter<std::decay_t<P>, std::decay_t<E>, H>;
+    return Stage{std::forward<P>(predicate), std::decay_t<E>(std::forward<E>(else_err)), EAV_SITE_SLOT};
 }
 
 }  // namespace eav::combine::result
@@ -1,44 +1,61 @@
 #pragma once
 
-#include <functional>  // std::invoke
-
-#include "../../Result.hpp"
+#include "../../Detail/Pipe.hpp"
+#include "../Core.hpp"
+#include "../Detail/Fuse.hpp"
 
 namespace eav::combine::result {
 
-namespace result::pipe {
+namespace pipe {
 
 //                 (  func_  )
 // Result<T, E> -> ( E -> E' ) -> Result<T, E'>
 
-template <typename F>
-struct MapErr {
+template <typename F, BranchHint H = BranchHint::kErrorsRare>
+struct MapErr : detail::ResultStage {
+    static constexpr BranchHint kHint = H;
+
     F func_;
 
-    explicit MapErr(F&& f) : func_(std::move(f)) {}
+    constexpr explicit MapErr(const F& f) : func_(f) {}
+    constexpr explicit MapErr(F&& f) : func_(std::move(f)) {}
 
     template <typename T, concepts::IsError E>
-    auto Pipe(Result<T, E>&& res) {
+    constexpr auto Pipe(Result<T, E>&& res) {
         using Q = std::invoke_result_t<F, E>;
+        using In = detail::Access<Result<T, E>>;
+        using Out = detail::Access<Result<T, Q>>;
 
-        if (res.is_ok()) {
-            return Result<T, Q>(make::Ok(std::move(res).unwrap_ok()));
+        if (detail::ExpectOk<H>(res.is_ok())) {
+            return Out::Ok(In::TakeOk(std::move(res)));
         }
 
-        return Result<T, Q>(make::Err(std::invoke(std::move(func_), std::move(res).unwrap_err())));
+        // the output is constructed in place from the return value of func_
+        return detail::OnErrorPath<H>([&] { return Out::ErrFrom(std::move(func_), In::TakeErr(std::move(res))); });
     }
 
     template <typename T>
-    auto Pipe(Result<T, detail::PendingType>&& res) {
+    constexpr auto Pipe(Result<T, detail::PendingType>&& res) {
         return std::move(res);
     }
+
+    // Lazy pipeline stage:
+    template <typename T, typename Next>
+    constexpr auto FuseOk(T&& val, const Next& next) const {
+        return next.Ok(std::forward<T>(val));
+    }
+
+    template <typename E, typename Next>
+    constexpr auto FuseErr(E&& err, const Next& next) const {
+        return next.ErrFrom(func_, std::forward<E>(err));
+    }
 };
 
-}  // namespace result::pipe
+}  // namespace pipe
 
-template <typename F>
-auto MapErr(F&& func) {
-    return result::pipe::MapErr{std::forward<F>(func)};
+template <BranchHint H = BranchHint::kErrorsRare, typename F>
+constexpr auto MapErr(F&& func) {
+    return result::pipe::MapErr<std::decay_t<F>, H>{std::forward<F>(func)};
 }
 
 }  // namespace eav::combine::result
@@ -1,8 +1,8 @@
 #pragma once
 
-#include <functional>  // std::invoke
-
-#include "../../Result.hpp"
+#include "../../Detail/Pipe.hpp"
+#include "../Core.hpp"
+#include "../Detail/Fuse.hpp"
 
 namespace eav::combine::result {
 
@@ -11,34 +11,51 @@ namespace pipe {
 //                 (  func_ )
 // Result<T, E> -> ( T -> U ) -> Result<U, E>
 
-template <typename F>
-struct MapOk {
+template <typename F, BranchHint H = BranchHint::kErrorsRare>
+struct MapOk : detail::ResultStage {
+    static constexpr BranchHint kHint = H;
+
     F func_;
 
-    explicit MapOk(F&& f) : func_(std::move(f)) {}
+    constexpr explicit MapOk(const F& f) : func_(f) {}
+    constexpr explicit MapOk(F&& f) : func_(std::move(f)) {}
 
-    template <typename T, concepts::IsError E> requires std::invocable<F, T>
-    auto Pipe(Result<T, E>&& res) {
-        using U = std::invoke_result_t<F, T>;
+    template <typename T, concepts::IsError E> requires detail::InvocableOn<F, T>
+    constexpr auto Pipe(Result<T, E>&& res) {
+        using U = detail::InvokeResultOn<F, T>;
+        using In = detail::Access<Result<T, E>>;
+        using Out = detail::Access<Result<U, E>>;
 
-        if (res.is_ok()) {
-            return Result<U, E>(make::Ok(std::invoke(std::move(func_), std::move(res).unwrap_ok())));
+        // the output is constructed in place from the return value of func_
+        if (detail::ExpectOk<H>(res.is_ok())) {
+            return Out::OkFrom(std::move(func_), In::TakeOk(std::move(res)));
         }
 
-        return Result<U, E>(make::Err(std::move(res).unwrap_err()));
+        return detail::OnErrorPath<H>([&] { return Out::Err(In::TakeErr(std::move(res))); });
     }
 
     template <concepts::IsError E>
-    auto Pipe(Result<detail::PendingType, E>&& res) {
+    constexpr auto Pipe(Result<detail::PendingType, E>&& res) {
         return std::move(res);
     }
+
+    // Lazy pipeline stage:
+    template <typename T, typename Next>
+    constexpr auto FuseOk(T&& val, const Next& next) const {
+        return next.OkFrom(func_, std::forward<T>(val));
+    }
+
+    template <typename E, typename Next>
+    constexpr auto FuseErr(E&& err, const Next& next) const {
+        return next.Err(std::forward<E>(err));
+    }
 };
 
 }  // namespace pipe
 
-template <typename F>
-auto MapOk(F&& func) {
-    return pipe::MapOk{std::forward<F>(func)};
+template <BranchHint H = BranchHint::kErrorsRare, typename F>
+constexpr auto MapOk(F&& func) {
+    return pipe::MapOk<std::decay_t<F>, H>{std::forward<F>(func)};
 }
 
 }  // namespace eav::combine::result
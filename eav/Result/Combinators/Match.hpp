@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>  // std::size_t
+#include <tuple>
+#include <type_traits>
+
+#include "../../Detail/Call.hpp"
+#include "../../Detail/Pipe.hpp"
+#include "../Core.hpp"
+#include "../Detail/Fuse.hpp"
+#include "../Detail/Merge.hpp"
+
+namespace eav::combine::result {
+
+namespace pipe {
+
+//                                  (         handlers_         )
+// Result<T, ErrorUnion<A, B, C>> -> ( A -> Result<T, E'>, ... ) -> Result<T, ErrorUnion<B, C, E'>>
+
+// The first handler that takes the alternative held is called, as OrElse would call it; an
+// alternative that no handler takes is passed on as is. The output error is the union of what
+// is left (see detail::MatchOutput): a plain type if only one is, none if every alternative is
+// recovered. A plain (non-union) error is its only alternative.
+template <BranchHint H, typename... Fs>
+struct Match : detail::ResultStage {
+    static constexpr BranchHint kHint = H;
+
+    std::tuple<Fs...> handlers_;
+
+    template <typename T, concepts::IsError E> requires detail::HandlesSomeOf<E, Fs...>
+    constexpr auto Pipe(Result<T, E>&& res) {
+        using Out = typename detail::MatchOutput<T, E, Fs...>::Type;
+        using In = detail::Access<Result<T, E>>;
+
+        if constexpr (!std::same_as<T, detail::PendingType>) {
+            if (detail::ExpectOk<H>(res.is_ok())) {
+                return detail::Access<Out>::Ok(In::TakeOk(std::move(res)));
+            }
+        }
+        return detail::OnErrorPath<H>([&] {
+            return detail::VisitAlternative(In::TakeErr(std::move(res)), [&]<typename A>(A&& alt) -> Out {
+                constexpr std::size_t kHandler = detail::kHandlerFor<A&&, Fs...>;
+                if constexpr (kHandler < sizeof...(Fs)) {
+                    return detail::Rewrap<Out>(detail::Call(std::get<kHandler>(handlers_), std::forward<A>(alt)));
+                } else {
+                    return detail::Access<Out>::Err(std::forward<A>(alt));
+                }
+            });
+        });
+    }
+
+    template <typename T>
+    constexpr auto Pipe(Result<T, detail::PendingType>&& res) {
+        return std::move(res);
+    }
+
+    // Lazy pipeline stage:
+    template <typename T, typename Next>
+    constexpr auto FuseOk(T&& val, const Next& next) const {
+        return next.Ok(std::forward<T>(val));
+    }
+
+    template <typename E, typename Next>
+    constexpr auto FuseErr(E&& err, const Next& next) const {
+        return detail::VisitAlternative(std::forward<E>(err), [&]<typename A>(A&& alt) {
+            constexpr std::size_t kHandler = detail::kHandlerFor<A&&, Fs...>;
+            if constexpr (kHandler < sizeof...(Fs)) {
+                return Forward<H>(detail::Call(std::get<kHandler>(handlers_), std::forward<A>(alt)), next);
+            } else {
+                return next.Err(std::forward<A>(alt));
+            }
+        });
+    }
+};
+
+}  // namespace pipe
+
+// Match(handlers...): a handler per alternative of interest, e.g.
+//     | Match([](NotFound) -> Result<Config, IoError> { return make::Ok(Config::Default()); })
+template <BranchHint H = BranchHint::kErrorsRare, typename... Fs>
+constexpr auto Match(Fs&&... handlers) {
+    return pipe::Match<H, std::decay_t<Fs>...>{{}, std::tuple<std::decay_t<Fs>...>(std::forward<Fs>(handlers)...)};
+}
+
+}  // namespace eav::combine::result
@@ -1,8 +1,10 @@
 #pragma once
 
-#include "../../Result.hpp"
-
-#include <functional>
+#include "../../Detail/Call.hpp"
+#include "../../Detail/Pipe.hpp"
+#include "../Core.hpp"
+#include "../Detail/Fuse.hpp"
+#include "Match.hpp"
 
 namespace eav::combine::result {
 
@@ -11,39 +13,98 @@ namespace pipe {
 //                 (       func_      )
 // Result<T, E> -> (E -> Result<T, E'>) -> Result<T, E'>
 
-template <typename F>
-struct OrElse {
+// On a union error func_ may take only some of the alternatives: those are recovered, the
+// others passed on, and the output error widens to ErrorUnion<others..., E'> (see Match).
+
+template <typename F, BranchHint H = BranchHint::kErrorsRare>
+struct OrElse : detail::ResultStage {
+    static constexpr BranchHint kHint = H;
+
     F func_;
+    [[no_unique_address]] detail::SiteSlot site_;
+
+    // func_ as the one handler of a Match (a union error it takes only some alternatives of)
+    template <typename Fn>
+    struct Recover {
+        Fn& func;
+        const detail::SiteSlot& site;
+
+        template <typename A> requires std::invocable<Fn&, A>
+        constexpr auto operator()(A&& alt) const {
+            // Naming the result costs a move, so an immovable one is not inspected
+            if constexpr (detail::kInstrumented && std::is_move_constructible_v<std::invoke_result_t<Fn&, A>>) {
+                auto out = detail::Call(func, std::forward<A>(alt));
+                site.template ReportIfEmpty<instrument::Event::kOrElse>(out);
+                return out;
+            } else {
+                return detail::Call(func, std::forward<A>(alt));
+            }
+        }
+    };
 
     template <typename T, concepts::IsError E>
     requires std::invocable<F, E> && concepts::IsResult<std::invoke_result_t<F, E>>
-    auto Pipe(Result<T, E>&& res) {
+    constexpr auto Pipe(Result<T, E>&& res) {
         if constexpr (std::same_as<E, detail::PendingType>) {
             return std::move(res);
         }
 
         using NextResultT = std::invoke_result_t<F, E>;
-
-        if (res.is_err()) {
-            return std::invoke(std::move(func_), std::move(res).unwrap_err());
-        }
+        using In = detail::Access<Result<T, E>>;
 
         using NewT = typename NextResultT::OkType;
         using NewE = typename NextResultT::ErrType;
-        return Result<NewT, NewE>(make::Ok(std::move(res).unwrap_ok()));
+
+        if constexpr (!std::same_as<T, detail::PendingType>) {
+            if (detail::ExpectOk<H>(res.is_ok())) {
+                return detail::Access<Result<NewT, NewE>>::Ok(In::TakeOk(std::move(res)));
+            }
+        }
+        // Naming the result costs a move, so an immovable one is not inspected
+        if constexpr (detail::kInstrumented && std::is_move_constructible_v<NextResultT>) {
+            auto out = detail::Call(std::move(func_), In::TakeErr(std::move(res)));
+            site_.template ReportIfEmpty<instrument::Event::kOrElse>(out);
+            return out;
+        } else {
+            return detail::OnErrorPath<H>([&] { return detail::Call(std::move(func_), In::TakeErr(std::move(res))); });
+        }
+    }
+
+    template <typename T, concepts::IsError E>
+    requires(!std::invocable<F, E> && concepts::IsErrorUnion<E> && detail::HandlesSomeOf<E, Recover<F>>)
+    constexpr auto Pipe(Result<T, E>&& res) {
+        return Match<H, Recover<F>>{{}, std::tuple<Recover<F>>(Recover<F>{func_, site_})}.Pipe(std::move(res));
     }
 
     template <typename T>
-    auto Pipe(Result<T, detail::PendingType>&& res) {
+    constexpr auto Pipe(Result<T, detail::PendingType>&& res) {
         return std::move(res);
     }
+
+    // Lazy pipeline stage:
+    template <typename T, typename Next>
+    constexpr auto FuseOk(T&& val, const Next& next) const {
+        return next.Ok(std::forward<T>(val));
+    }
+
+    template <typename E, typename Next>
+    constexpr auto FuseErr(E&& err, const Next& next) const {
+        if constexpr (std::invocable<const F&, E>) {
+            return Forward<H>(
+                site_.template ReportIfEmpty<instrument::Event::kOrElse>(detail::Call(func_, std::forward<E>(err))),
+                next);
+        } else {
+            using Handler = Recover<const std::remove_reference_t<F>>;
+            return Match<H, Handler>{{}, std::tuple<Handler>(Handler{func_, site_})}.FuseErr(std::forward<E>(err), next);
+        }
+    }
 };
 
 }  // namespace pipe
 
-template <typename F>
-auto OrElse(F&& func) {
-    return pipe::OrElse<F>{std::forward<F>(func)};
+template <BranchHint H = BranchHint::kErrorsRare, typename F>
+constexpr auto OrElse(F&& func EAV_SITE_PARAM) {
+    return pipe::OrElse<std::decay_t<F>, H>{{}, std::forward<F>(func), EAV_SITE_SLOT};
 }
 
 }  // namespace eav::combine::result
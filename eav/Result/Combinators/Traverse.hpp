@@ -0,0 +1,185 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>     // std::size_t
+#include <mutex>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../Detail/Call.hpp"
+#include "../../Detail/Pipe.hpp"
+#include "../../Exec/Detail/Slots.hpp"
+#include "../../Exec/Detail/Traversable.hpp"
+#include "../../Exec/ParallelFor.hpp"
+#include "../../Exec/Policy.hpp"
+#include "../../Option/Core.hpp"
+#include "../Core.hpp"
+
+namespace eav::combine::result {
+
+//                      (        func        )
+// [x_0, ..., x_{n-1}] -> ( x -> Result<U, E> ) -> Result<std::vector<U>, E>
+//
+// Ok with all values in input order, or the Err of the first element (in input order) that
+// failed. After a failure no further elements are scheduled; under exec::par elements before it
+// may still be running and are awaited, so the error is always the one the sequential loop
+// would return. `func` is called concurrently under exec::par and must be safe for that.
+template <exec::ExecutionPolicy P, typename R, typename F>
+requires detail::TraversableWith<P, R> && concepts::IsResult<detail::TraverseResult<R, F>>
+auto Traverse(P policy, R&& range, F&& func) {
+    using NextResultT = detail::TraverseResult<R, F>;
+    using U = typename NextResultT::OkType;
+    using E = typename NextResultT::ErrType;
+    using Next = detail::Access<NextResultT>;
+    using Out = detail::Access<Result<std::vector<U>, E>>;
+
+    if constexpr (std::same_as<P, exec::SequencedPolicy>) {
+        std::vector<U> values;
+        if constexpr (std::ranges::sized_range<R>) {
+            values.reserve(std::ranges::size(range));
+        }
+        for (auto&& elem : range) {
+            NextResultT res = detail::Call(func, std::forward<decltype(elem)>(elem));
+            if (res.is_err()) {
+                return Out::Err(Next::TakeErr(std::move(res)));
+            }
+            values.push_back(Next::TakeOk(std::move(res)));
+        }
+        return Out::Ok(std::move(values));
+    } else {
+        const std::size_t n = std::ranges::size(range);
+        auto first = std::ranges::begin(range);
+        detail::Slots<U> values(n);
+
+        std::mutex err_mutex;
+        std::size_t err_at = n;
+        Option<E> err = make::None();
+
+        const std::size_t stopped_at = exec::ParallelFor(policy, n, [&](std::size_t i) {
+            NextResultT res = detail::Call(func, first[static_cast<std::ranges::range_difference_t<R>>(i)]);
+            if (res.is_ok()) {
+                values.Put(i, Next::TakeOk(std::move(res)));
+                return true;
+            }
+            std::lock_guard lock(err_mutex);
+            if (i < err_at) {
+                err_at = i;
+                err.emplace(Next::TakeErr(std::move(res)));
+            }
+            return false;
+        });
+
+        if (stopped_at < n) {
+            return Out::Err(detail::Access<Option<E>>::Take(std::move(err)));
+        }
+        return Out::Ok(std::move(values).Take());
+    }
+}
+
+template <typename R, typename F> requires(!exec::ExecutionPolicy<std::remove_cvref_t<R>>)
+auto Traverse(R&& range, F&& func) {
+    return Traverse(exec::seq, std::forward<R>(range), std::forward<F>(func));
+}
+
+//                      (        func        )
+// [x_0, ..., x_{n-1}] -> ( x -> Result<U, E> ) -> Result<std::vector<U>, std::vector<E>>
+//
+// Runs every element and reports all errors, in input order
+template <exec::ExecutionPolicy P, typename R, typename F>
+requires detail::TraversableWith<P, R> && concepts::IsResult<detail::TraverseResult<R, F>>
+auto TraverseAll(P policy, R&& range, F&& func) {
+    using NextResultT = detail::TraverseResult<R, F>;
+    using U = typename NextResultT::OkType;
+    using E = typename NextResultT::ErrType;
+    using Next = detail::Access<NextResultT>;
+    using Out = detail::Access<Result<std::vector<U>, std::vector<E>>>;
+
+    if constexpr (std::same_as<P, exec::SequencedPolicy>) {
+        std::vector<U> values;
+        std::vector<E> errors;
+        if constexpr (std::ranges::sized_range<R>) {
+            values.reserve(std::ranges::size(range));
+        }
+        for (auto&& elem : range) {
+            NextResultT res = detail::Call(func, std::forward<decltype(elem)>(elem));
+            if (res.is_ok()) {
+                if (errors.empty()) values.push_back(Next::TakeOk(std::move(res)));
+            } else {
+                errors.push_back(Next::TakeErr(std::move(res)));
+            }
+        }
+        if (!errors.empty()) {
+            return Out::Err(std::move(errors));
+        }
+        return Out::Ok(std::move(values));
+    } else {
+        const std::size_t n = std::ranges::size(range);
+        auto first = std::ranges::begin(range);
+        detail::Slots<U> values(n);
+        detail::Slots<E> errors(n);
+        std::vector<char> failed(n, 0);  // char, not bool: written concurrently
+        std::atomic<bool> any_failed{false};
+
+        exec::ParallelFor(policy, n, [&](std::size_t i) {
+            NextResultT res = detail::Call(func, first[static_cast<std::ranges::range_difference_t<R>>(i)]);
+            if (res.is_ok()) {
+                values.Put(i, Next::TakeOk(std::move(res)));
+            } else {
+                errors.Put(i, Next::TakeErr(std::move(res)));
+                failed[i] = 1;
+                any_failed.store(true, std::memory_order_relaxed);
+            }
+            return true;
+        });
+
+        if (any_failed.load(std::memory_order_relaxed)) {
+            return Out::Err(std::move(errors).TakeWhere(failed));
+        }
+        return Out::Ok(std::move(values).Take());
+    }
+}
+
+template <typename R, typename F> requires(!exec::ExecutionPolicy<std::remove_cvref_t<R>>)
+auto TraverseAll(R&& range, F&& func) {
+    return TraverseAll(exec::seq, std::forward<R>(range), std::forward<F>(func));
+}
+
+// [Result<U, E>...] -> Result<std::vector<U>, E>: Traverse with the identity; the elements of an
+// rvalue range are moved from
+template <exec::ExecutionPolicy P, typename R> requires concepts::IsResult<std::ranges::range_value_t<R>>
+auto Collect(P policy, R&& range) {
+    using Elem = std::ranges::range_value_t<R>;
+    return Traverse(policy, range, [](auto& res) -> Elem {
+        if constexpr (std::is_lvalue_reference_v<R>) {
+            return res;
+        } else {
+            return std::move(res);
+        }
+    });
+}
+
+template <typename R> requires concepts::IsResult<std::ranges::range_value_t<R>>
+auto Collect(R&& range) {
+    return Collect(exec::seq, std::forward<R>(range));
+}
+
+template <exec::ExecutionPolicy P, typename R> requires concepts::IsResult<std::ranges::range_value_t<R>>
+auto CollectAll(P policy, R&& range) {
+    using Elem = std::ranges::range_value_t<R>;
+    return TraverseAll(policy, range, [](auto& res) -> Elem {
+        if constexpr (std::is_lvalue_reference_v<R>) {
+            return res;
+        } else {
+            return std::move(res);
+        }
+    });
+}
+
+template <typename R> requires concepts::IsResult<std::ranges::range_value_t<R>>
+auto CollectAll(R&& range) {
+    return CollectAll(exec::seq, std::forward<R>(range));
+}
+
+}  // namespace eav::combine::result
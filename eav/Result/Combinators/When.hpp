@@ -0,0 +1,57 @@
+#pragma once
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../../Exec/Executor.hpp"
+#include "../../Exec/StopToken.hpp"
+#include "../Core.hpp"
+#include "../Detail/When.hpp"
+
+namespace eav::combine::result {
+
+// Fan-out/fan-in over a fixed set of fallible operations, run on `executor`: every function but
+// the last is posted to it, the last runs on the calling thread, and the call returns once all
+// of them have finished or been skipped. Called from a thread of the executor itself (a task
+// of the same ThreadPool) it runs every input in place, in order, rather than wait for workers
+// that may be busy waiting too. Nothing is allocated: the inputs, their jobs and the
+// outputs live in this frame (what the executor does to queue a job is up to it).
+// Cancellation is cooperative: once the outcome is decided, inputs that have not started are
+// skipped, and a function that takes an exec::StopToken can poll it to stop early. The
+// functions run concurrently and must not throw; all of them return Result<Ti, E>, same E.
+
+//                             (                 funcs...                 )
+// Result<std::tuple<T...>, E> <- ( () -> Result<T_0, E>, ..., () -> Result<T_n, E> )
+//
+// Ok with all values in argument order, or the first Err to arrive (the rest are cancelled).
+template <exec::Executor X, typename... F>
+requires(sizeof...(F) > 0 && (detail::WhenInputResult<detail::WhenResultOf<std::decay_t<F>>> && ...) &&
+         (std::same_as<typename detail::WhenResultOf<std::decay_t<F>>::ErrType,
+                       typename detail::WhenResultOf<std::decay_t<std::tuple_element_t<0, std::tuple<F...>>>>::ErrType> &&
+          ...))
+auto WhenAll(X& executor, F&&... funcs) {
+    using E = typename detail::WhenResultOf<std::decay_t<std::tuple_element_t<0, std::tuple<F...>>>>::ErrType;
+    detail::WhenAllGroup<E, std::decay_t<F>...> group(std::decay_t<F>(std::forward<F>(funcs))...);
+    group.RunAll(executor);
+    return std::move(group).Take();
+}
+
+//               (                 funcs...               )
+// Result<T, E> <- ( () -> Result<T, E>, ..., () -> Result<T, E> )
+//
+// The first Ok to arrive (the rest are cancelled); if every input fails, the last Err to arrive.
+template <exec::Executor X, typename... F>
+requires(sizeof...(F) > 0 && (detail::WhenInputResult<detail::WhenResultOf<std::decay_t<F>>> && ...) &&
+         (std::same_as<detail::WhenResultOf<std::decay_t<F>>,
+                       detail::WhenResultOf<std::decay_t<std::tuple_element_t<0, std::tuple<F...>>>>> &&
+          ...))
+auto WhenAny(X& executor, F&&... funcs) {
+    using R = detail::WhenResultOf<std::decay_t<std::tuple_element_t<0, std::tuple<F...>>>>;
+    detail::WhenAnyGroup<typename R::OkType, typename R::ErrType, std::decay_t<F>...> group(
+        std::decay_t<F>(std::forward<F>(funcs))...);
+    group.RunAll(executor);
+    return std::move(group).Take();
+}
+
+}  // namespace eav::combine::result
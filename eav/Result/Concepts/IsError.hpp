@@ -7,9 +7,11 @@
 
 namespace eav::concepts {
 
+// E = U& is held as a pointer (a borrowed error, see Result::as_ref)
 template <typename E>
 concept IsError =
     std::same_as<E, detail::PendingType> ||
+    std::is_lvalue_reference_v<E> ||
     (std::move_constructible<E> &&
      std::destructible<E> &&
      !std::is_void_v<E> &&
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <string_view>
+#include <type_traits>
+
+#include "../Concepts/IsResult.hpp"
+#include "../Detail/Access.hpp"
+#include "../Detail/Payload.hpp"
+#include "../Detail/Pipeline.hpp"
+#include "../Error/Detail/Union.hpp"
+#include "Concepts/IsError.hpp"
+#include "Detail/Storage.hpp"
+#include "Detail/Tags.hpp"
+#include "FwdDecl/Err.hpp"
+#include "FwdDecl/Ok.hpp"
+#include "FwdDecl/Result.hpp"
+
+#include "../Option/FwdDecl/Option.hpp"
+
+namespace eav {
+
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+class [[nodiscard]] Result {
+  public:  // nested types:
+    using OkType = T;
+    using ErrType = E;
+
+  private:  // data members:
+    // union + 1-byte tag; a stateless alternative is packed into the niche of the other one
+    // (e.g. sizeof(Result<T*, NotFound>) == sizeof(T*)), see Result/Detail/Storage.hpp.
+    // T = U& (and E = U&) is held as a pointer, T = void as an empty Unit (see Detail/Payload.hpp)
+    detail::ResultStorage<detail::PayloadOf<T>, detail::PayloadOf<E>> storage_;
+
+  public:  // member functions:
+    // Constructors and destructor:
+    Result() = delete;  // value of the Result object must be explicitly initialized;
+    Result(const Result<T, E>&) = default;
+    Result(Result<T, E>&&) = default;
+
+    // Next constructor
+    // NOT SUPPORT:
+    //      arg: Result<U=T, R=E>&& <- this constraint doesnt overlap default move constructor
+    // SUPPORT:
+    // 1.   arg: Result<U=PendingType, R=E>&&           => Result<T,E>
+    // 2.   arg: Result<U=T,           R=PendingType>&& => Result<T,E>
+    // 3.   arg: Result<U=PendingType, R=PendingType>&& => Result<T,E>
+    // 4.   arg: Result<U=T|PendingType, R>&&           => Result<T,E>, E an ErrorUnion that R is
+    //      an alternative of, or a union of the same or more alternatives in any order
+    template <typename U, typename R>
+    requires(
+        (std::same_as<U, T> || std::same_as<U, detail::PendingType>) &&
+        (std::same_as<R, E> || std::same_as<R, detail::PendingType> ||
+         (detail::kIsErrorUnion<E> && std::is_constructible_v<E, R&&>)) &&
+        !(std::same_as<U, T> && std::same_as<R, E>))
+    constexpr Result(Result<U, R>&& oth);
+
+    // The value of a coroutine returning Result<T, E> (see Coro/Detail/Return.hpp); a template,
+    // so that explicit instantiations (src/Extern.cpp) do not need the coroutine headers
+    template <typename G> requires std::same_as<G, detail::ReturnObject<Result>>
+    Result(G&& gro);  // NOLINT: implicit on purpose
+
+    ~Result() = default;
+
+    // Operators:
+    Result<T, E>& operator=(const Result<T, E>& oth) = default;
+    Result<T, E>& operator=(Result<T, E>&& oth) = default;
+    constexpr operator bool() const noexcept;
+
+    // Observers:
+    constexpr bool is_ok() const noexcept;
+    constexpr bool is_err() const noexcept;
+
+    // Accessors (for T = U& all of them return U&, for T = void they only check):
+    constexpr std::add_lvalue_reference_t<const T> unwrap_ok(
+        std::string_view msg = "called .unwrap_ok() on Err" EAV_SITE_PARAM) const&;
+    constexpr std::add_lvalue_reference_t<T> unwrap_ok(
+        std::string_view msg = "called .unwrap_ok() on Err" EAV_SITE_PARAM) &;
+    constexpr T unwrap_ok(std::string_view msg = "called .unwrap_ok() on Err" EAV_SITE_PARAM) &&;
+
+    // Precondition: is_ok(). No check, only an optimizer hint (UB if violated)
+    constexpr std::add_lvalue_reference_t<const T> unwrap_ok_unchecked() const& noexcept;
+    constexpr std::add_lvalue_reference_t<T> unwrap_ok_unchecked() & noexcept;
+    constexpr T unwrap_ok_unchecked() &&;
+
+    // A Result<U&, E> falls back only to an lvalue: a temporary would dangle
+    template <typename U> requires(!std::is_void_v<T> && (!std::is_reference_v<T> || std::is_lvalue_reference_v<U>))
+    constexpr T unwrap_ok_or(U&& else_val) const&;
+
+    template <typename U> requires(!std::is_void_v<T> && (!std::is_reference_v<T> || std::is_lvalue_reference_v<U>))
+    constexpr T unwrap_ok_or(U&& else_val) &&;
+
+    // (for E = U& all of them return U&)
+    constexpr const E& unwrap_err(std::string_view msg = "called .unwrap_ok() on Ok" EAV_SITE_PARAM) const&;
+    constexpr E& unwrap_err(std::string_view msg = "called .unwrap_ok() on Ok" EAV_SITE_PARAM) &;
+    constexpr E unwrap_err(std::string_view msg = "called .unwrap_ok() on Ok" EAV_SITE_PARAM) &&;
+
+    // Precondition: is_err(). No check, only an optimizer hint (UB if violated)
+    constexpr const E& unwrap_err_unchecked() const& noexcept;
+    constexpr E& unwrap_err_unchecked() & noexcept;
+    constexpr E unwrap_err_unchecked() &&;
+
+    // Modifiers:
+    // Destroy the current value and construct the given alternative from `args...` in its place.
+    // If construction may throw, the old value is restored (see reinit in Result/Detail/Storage.hpp)
+    // emplace_ok(ref) rebinds a Result<U&, E>
+    template <typename... Args>
+    constexpr std::add_lvalue_reference_t<T> emplace_ok(Args&&... args);
+
+    template <typename... Args>
+    constexpr E& emplace_err(Args&&... args);
+
+    // Conversion: Result<T,E> => Option<T> (the type is deduced: there is no Option<void>)
+    constexpr auto erase_err() const& requires(!std::is_void_v<T>);
+    constexpr auto erase_err() && requires(!std::is_void_v<T>);
+
+    // Borrowed view: Result<const T&, const E&> referring to the value of *this, nothing is
+    // copied (Result<void, const E&> for T = void). It must not outlive *this, so there is none
+    // of a temporary
+    constexpr Result<detail::BorrowOf<T>, const E&> as_ref() const& noexcept;
+    void as_ref() const&& = delete;
+
+  private:  // member functions:
+    // Private constructors that are called by friend functions Ok(...), Err(...) and detail::Access;
+    // Argument Tag is used for the compiler to recognize a potentially ambiguous call when E=T (Result<T,T>)
+    template <typename... Args>
+    constexpr explicit Result(detail::OkTag, Args&&... args);
+
+    template <typename... Args>
+    constexpr explicit Result(detail::ErrTag, Args&&... args);
+
+    // Ok/Err (Tag) constructed in place from the result of func(args...)
+    template <typename Tag, typename F, typename... Args>
+    constexpr Result(detail::InvokeTag, Tag, F&& func, Args&&... args);
+
+  private:  // friends declaration:
+    template <typename U>
+    friend constexpr Result<std::decay_t<U>, detail::PendingType> make::Ok(U&&);
+
+    template <typename R> requires concepts::IsError<std::decay_t<R>>
+    friend constexpr Result<detail::PendingType, std::decay_t<R>> make::Err(R&& EAV_SITE_PARAM_NODEFAULT);
+
+    template <typename U, concepts::IsError R> requires(!std::is_rvalue_reference_v<U>)
+    friend class Result;
+
+    template <typename R>
+    friend struct detail::Access;
+};
+
+}  // namespace eav
+
+// The definitions; the combinators are separate (Combinators/*.hpp, or all of them with <eav/Result.hpp>)
+#include "Detail/ResultImpl.hpp"
+#include "Make.hpp"
+#include "../Traits/Relocatable.hpp"
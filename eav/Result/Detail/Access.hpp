@@ -0,0 +1,65 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+#include "../../Detail/Access.hpp"
+#include "../../Detail/Payload.hpp"
+#include "../FwdDecl/Result.hpp"
+#include "Tags.hpp"
+
+namespace eav::detail {
+
+template <typename T, typename E>
+struct Access<Result<T, E>> {
+    // Ok/Err constructed in place from `args...`
+    template <typename... Args>
+    static constexpr Result<T, E> Ok(Args&&... args) {
+        return Result<T, E>(OkTag{}, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    static constexpr Result<T, E> Err(Args&&... args) {
+        return Result<T, E>(ErrTag{}, std::forward<Args>(args)...);
+    }
+
+    // Ok/Err constructed in place from the prvalue returned by func(args...)
+    template <typename F, typename... Args>
+    static constexpr Result<T, E> OkFrom(F&& func, Args&&... args) {
+        return Result<T, E>(InvokeTag{}, OkTag{}, std::forward<F>(func), std::forward<Args>(args)...);
+    }
+
+    template <typename F, typename... Args>
+    static constexpr Result<T, E> ErrFrom(F&& func, Args&&... args) {
+        return Result<T, E>(InvokeTag{}, ErrTag{}, std::forward<F>(func), std::forward<Args>(args)...);
+    }
+
+    // The payload of an rvalue Result, without moving it out (precondition: is_ok() / is_err()).
+    // T&& for an object type, U& for T = U& (E = U&), Unit&& for T = void (see Detail/Payload.hpp)
+    static constexpr decltype(auto) TakeOk(Result<T, E>&& res) noexcept {
+        if constexpr (std::is_void_v<T>) {
+            return std::move(res.storage_).ok();
+        } else {
+            return Unwrap(std::move(res.storage_).ok());
+        }
+    }
+
+    static constexpr decltype(auto) TakeErr(Result<T, E>&& res) noexcept {
+        return Unwrap(std::move(res.storage_).err());
+    }
+
+    // The same for a borrowed Result: const T&/const E& (U& for a reference, const Unit& for void)
+    static constexpr decltype(auto) PeekOk(const Result<T, E>& res) noexcept {
+        if constexpr (std::is_void_v<T>) {
+            return res.storage_.ok();
+        } else {
+            return Unwrap(res.storage_.ok());
+        }
+    }
+
+    static constexpr decltype(auto) PeekErr(const Result<T, E>& res) noexcept {
+        return Unwrap(res.storage_.err());
+    }
+};
+
+}  // namespace eav::detail
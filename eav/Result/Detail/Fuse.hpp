@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstddef>     // std::size_t
+#include <tuple>
+#include <utility>
+
+#include "../../Detail/Hint.hpp"
+#include "../../Detail/Payload.hpp"
+#include "../../Detail/Pending.hpp"
+#include "../../Detail/Pipeline.hpp"
+#include "../../Error/Detail/Union.hpp"
+#include "../FwdDecl/Result.hpp"
+#include "Access.hpp"
+#include "Tags.hpp"
+
+namespace eav::detail {
+
+// Continuation = "the rest of the pipeline starting at stage I", whose input is (the eager
+// equivalent of) `In`. The last one builds the final Result; `OkFrom`/`ErrFrom` let it construct
+// a stage output in place
+template <typename Out, typename Stages, std::size_t I, typename In>
+struct ResultCont;
+
+// The continuation after stage I
+template <typename Out, typename Stages, std::size_t I, typename In>
+using NextResultCont = ResultCont<Out, Stages, I + 1, StageOutput<std::tuple_element_t<I, Stages>, In>>;
+
+template <typename Out, typename Stages, std::size_t I, typename In>
+struct ResultCont {
+    const Stages& stages_;
+
+    template <typename T>
+    constexpr Out Ok(T&& val) const {
+        if constexpr (I == std::tuple_size_v<Stages>) {
+            return Access<Out>::Ok(std::forward<T>(val));
+        } else {
+            return std::get<I>(stages_).FuseOk(std::forward<T>(val), NextResultCont<Out, Stages, I, In>{stages_});
+        }
+    }
+
+    // An error for a stage that takes a union (an AndThen widened into it before) is put into the
+    // union here, so the stage sees the type it would see without fusion
+    template <typename E>
+    constexpr Out Err(E&& err) const {
+        using InErr = typename In::ErrType;
+        if constexpr (I < std::tuple_size_v<Stages> && kIsErrorUnion<InErr> &&
+                      !std::same_as<std::remove_cvref_t<E>, InErr>) {
+            return Err(InErr(std::forward<E>(err)));
+        } else if constexpr (I == std::tuple_size_v<Stages>) {
+            return Access<Out>::Err(std::forward<E>(err));
+        } else {
+            return std::get<I>(stages_).FuseErr(std::forward<E>(err), NextResultCont<Out, Stages, I, In>{stages_});
+        }
+    }
+
+    // = Ok(func(args...))
+    template <typename F, typename... Args>
+    constexpr Out OkFrom(F&& func, Args&&... args) const {
+        if constexpr (I == std::tuple_size_v<Stages>) {
+            return Access<Out>::OkFrom(std::forward<F>(func), std::forward<Args>(args)...);
+        } else {
+            return Ok(Invoke(std::forward<F>(func), std::forward<Args>(args)...));
+        }
+    }
+
+    // = Err(func(args...))
+    template <typename F, typename... Args>
+    constexpr Out ErrFrom(F&& func, Args&&... args) const {
+        if constexpr (I == std::tuple_size_v<Stages>) {
+            return Access<Out>::ErrFrom(std::forward<F>(func), std::forward<Args>(args)...);
+        } else {
+            return Err(Invoke(std::forward<F>(func), std::forward<Args>(args)...));
+        }
+    }
+};
+
+// Base of every Result combinator: marks it as a stage of a lazy Result pipeline.
+// A stage provides
+//   FuseOk(T&& val, const Next& next) const   => next.Ok(...) or next.Err(...)
+//   FuseErr(E&& err, const Next& next) const  => next.Ok(...) or next.Err(...)
+// (or next.OkFrom(func, args...) / next.ErrFrom(...) for a value computed by the stage)
+// and `static constexpr BranchHint kHint`, the expected outcome of the branch on its input.
+struct ResultStage {
+    using StageKind = ResultStage;
+
+    template <typename Stages, typename T, typename E>
+    static constexpr auto Run(const Stages& stages, Result<T, E>&& src) {
+        using Out = typename FusedOutput<Result<T, E>, Stages>::Type;
+        return Forward<FirstHint<Stages>>(std::move(src), ResultCont<Out, Stages, 0, Result<T, E>>{stages});
+    }
+
+    // A borrowed source (see Borrow in Detail/Pipeline.hpp): the output type is the same, the
+    // stages see const T&/const E&
+    template <typename Stages, typename T, typename E>
+    static constexpr auto Run(const Stages& stages, const Result<T, E>& src) {
+        using Out = typename FusedOutput<Result<T, E>, Stages>::Type;
+        return Forward<FirstHint<Stages>>(src, ResultCont<Out, Stages, 0, Result<T, E>>{stages});
+    }
+
+    // Hands the value of a Result produced inside a stage (AndThen, OrElse) to `next`. The
+    // error exit goes through the rest of the pipeline at once: under kErrorsRare it is outlined
+    template <BranchHint H, typename T, typename E, typename Next>
+    static constexpr auto Forward(Result<T, E>&& res, const Next& next) {
+        using Acc = Access<Result<T, E>>;
+        if constexpr (std::same_as<T, PendingType>) {
+            return next.Err(Acc::TakeErr(std::move(res)));
+        } else if constexpr (std::same_as<E, PendingType>) {
+            return next.Ok(Acc::TakeOk(std::move(res)));
+        } else {
+            if (ExpectOk<H>(res.is_ok())) {
+                return next.Ok(Acc::TakeOk(std::move(res)));
+            }
+            return OnErrorPath<H>([&] { return next.Err(Acc::TakeErr(std::move(res))); });
+        }
+    }
+
+    template <BranchHint H, typename T, typename E, typename Next>
+    static constexpr auto Forward(const Result<T, E>& res, const Next& next) {
+        using Acc = Access<Result<T, E>>;
+        if constexpr (std::same_as<T, PendingType>) {
+            return next.Err(Acc::PeekErr(res));
+        } else if constexpr (std::same_as<E, PendingType>) {
+            return next.Ok(Acc::PeekOk(res));
+        } else {
+            if (ExpectOk<H>(res.is_ok())) {
+                return next.Ok(Acc::PeekOk(res));
+            }
+            return OnErrorPath<H>([&] { return next.Err(Acc::PeekErr(res)); });
+        }
+    }
+};
+
+}  // namespace eav::detail
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>      // std::size_t
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../../Detail/Call.hpp"
+#include "../../Detail/Pending.hpp"
+#include "../../Error/Union.hpp"
+#include "../FwdDecl/Result.hpp"
+#include "Access.hpp"
+
+namespace eav::detail {
+
+// Error type of AndThen: the input error E is passed on next to the errors E2 of the stage.
+// E2 if it is the same type or E converts to it (as before unions existed), E if the stage
+// cannot fail (E2 = PendingType), otherwise the union of both (see Error/Union.hpp)
+template <typename E, typename E2>
+using WidenedError = std::conditional_t<std::same_as<E, PendingType> || std::is_constructible_v<E2, E>, E2,
+                                        MergedError<E, E2>>;
+
+// `res` as the Result type Out, whose value and error are constructible from the ones of `res`
+// (the same types, a union that holds E, or anything from PendingType); moves the payload
+template <typename Out, typename U, typename E>
+constexpr Out Rewrap(Result<U, E>&& res) {
+    using In = Access<Result<U, E>>;
+    if constexpr (std::same_as<Out, Result<U, E>>) {
+        return std::move(res);
+    } else if constexpr (std::same_as<U, PendingType>) {
+        return Access<Out>::Err(In::TakeErr(std::move(res)));
+    } else if constexpr (std::same_as<E, PendingType>) {
+        return Access<Out>::Ok(In::TakeOk(std::move(res)));
+    } else {
+        if (res.is_ok()) {
+            return Access<Out>::Ok(In::TakeOk(std::move(res)));
+        }
+        return Access<Out>::Err(In::TakeErr(std::move(res)));
+    }
+}
+
+// --- Match: handlers for some alternatives of an error ---
+
+// The alternatives of an error: those of a union, the error itself otherwise
+template <typename E>
+struct AlternativesOf {
+    using Type = TypeList<std::remove_cvref_t<E>>;
+};
+
+template <typename... Es>
+struct AlternativesOf<FlatErrorUnion<Es...>> {
+    using Type = TypeList<Es...>;
+};
+
+// Position of the first handler that takes `Arg` (sizeof...(Fs) if none does)
+template <typename Arg, typename... Fs>
+inline constexpr std::size_t kHandlerFor = 0;
+
+template <typename Arg, typename F, typename... Fs>
+inline constexpr std::size_t kHandlerFor<Arg, F, Fs...> = std::invocable<F&, Arg> ? 0 : 1 + kHandlerFor<Arg, Fs...>;
+
+// What an alternative A adds to the output: the error (and value) type of its handler, or A
+// itself as the error
+template <typename A, typename... Fs>
+struct MatchContribution {
+    using Err = A;
+    using Ok = PendingType;
+};
+
+template <typename A, typename... Fs> requires(kHandlerFor<A&&, Fs...> < sizeof...(Fs))
+struct MatchContribution<A, Fs...> {
+    using Handled =
+        std::invoke_result_t<std::tuple_element_t<kHandlerFor<A&&, Fs...>, std::tuple<Fs...>>&, A&&>;
+    using Err = typename Handled::ErrType;
+    using Ok = typename Handled::OkType;
+};
+
+// The first type that is not PendingType
+template <typename... Ts>
+struct FirstKnown {
+    using Type = PendingType;
+};
+
+template <typename T, typename... Ts>
+struct FirstKnown<T, Ts...> {
+    using Type = std::conditional_t<std::same_as<T, PendingType>, typename FirstKnown<Ts...>::Type, T>;
+};
+
+template <typename List, typename... Fs>
+struct MatchOf;
+
+template <typename... As, typename... Fs>
+struct MatchOf<TypeList<As...>, Fs...> {
+    using Err = MergedError<typename MatchContribution<As, Fs...>::Err...>;
+    using Ok = typename FirstKnown<typename MatchContribution<As, Fs...>::Ok...>::Type;
+
+    // Some handler takes an alternative
+    static constexpr bool kAnyHandled = ((kHandlerFor<As&&, Fs...> < sizeof...(Fs)) || ...);
+};
+
+// Result<T, E> | Match(Fs...): the value type stays T (the handlers recover into it, it is
+// theirs if T is not known yet); the error is what the handlers fail with plus the alternatives
+// they do not take
+template <typename T, typename E, typename... Fs>
+struct MatchOutput {
+    using Of = MatchOf<typename AlternativesOf<std::remove_cvref_t<E>>::Type, Fs...>;
+    using Type = Result<typename FirstKnown<T, typename Of::Ok>::Type, typename Of::Err>;
+};
+
+// One of Fs... takes an alternative of E
+template <typename E, typename... Fs>
+concept HandlesSomeOf =
+    !std::same_as<E, PendingType> && MatchOf<typename AlternativesOf<std::remove_cvref_t<E>>::Type, Fs...>::kAnyHandled;
+
+// func(alternative) for the alternative held by `err` (a union), func(err) otherwise
+template <typename E, typename F>
+constexpr decltype(auto) VisitAlternative(E&& err, F&& func) {
+    if constexpr (kIsErrorUnion<std::remove_cvref_t<E>>) {
+        return std::forward<E>(err).visit(std::forward<F>(func));
+    } else {
+        return std::forward<F>(func)(std::forward<E>(err));
+    }
+}
+
+}  // namespace eav::detail
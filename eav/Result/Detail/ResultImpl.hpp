@@ -1,136 +1,224 @@
 #pragma once
 
-#include <stdexcept>
 #include <utility>
 
-#include "../../Option.hpp"
-#include "../../Option/Make.hpp"
-#include "../../Result.hpp"
+#include "../../Detail/Compiler.hpp"
+#include "../../Detail/Panic.hpp"
+#include "../../Option/Core.hpp"
+#include "../../Option/Detail/Access.hpp"
+#include "../Core.hpp"
 
 namespace eav {
 
 // --- Constructors ---
 
-template <typename T, concepts::IsError E> requires(!std::is_void_v<T>)
-Result<T, E>::Result(detail::OkTag, T&& val) : value_(std::in_place_index<0>, std::move(val)) {}
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+template <typename... Args>
+constexpr Result<T, E>::Result(detail::OkTag, Args&&... args)
+    : storage_(detail::OkTag{}, std::forward<Args>(args)...) {}
 
-template <typename T, concepts::IsError E> requires(!std::is_void_v<T>)
-Result<T, E>::Result(detail::ErrTag, E&& val) : value_(std::in_place_index<1>, std::move(val)) {}
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+template <typename... Args>
+constexpr Result<T, E>::Result(detail::ErrTag, Args&&... args)
+    : storage_(detail::ErrTag{}, std::forward<Args>(args)...) {}
 
-template <typename T, concepts::IsError E> requires(!std::is_void_v<T>)
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+template <typename Tag, typename F, typename... Args>
+constexpr Result<T, E>::Result(detail::InvokeTag, Tag, F&& func, Args&&... args)
+    : storage_(detail::InvokeTag{}, Tag{}, std::forward<F>(func), std::forward<Args>(args)...) {}
+
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
 template <typename U, typename R>
 requires(
     (std::same_as<U, T> || std::same_as<U, detail::PendingType>) &&
-    (std::same_as<R, E> || std::same_as<R, detail::PendingType>) &&
+    (std::same_as<R, E> || std::same_as<R, detail::PendingType> ||
+     (detail::kIsErrorUnion<E> && std::is_constructible_v<E, R&&>)) &&
     !(std::same_as<U, T> && std::same_as<R, E>))
-Result<T, E>::Result(Result<U, R>&& oth) {
-    if (oth.is_ok()) {
-        if constexpr (!std::same_as<U, detail::PendingType>) {
-            value_.template emplace<0>(std::move(oth).unwrap_ok());
-        } else {
-            throw std::runtime_error("eav::Result: Attempted to move ok-value from PendingType");
-        }
-    } else {
-        if constexpr (!std::same_as<R, detail::PendingType>) {
-            value_.template emplace<1>(std::move(oth).unwrap_err());
-        } else {
-            throw std::runtime_error("eav::Result: Attempted to move err-value from PendingType");
-        }
-    }
-}
+constexpr Result<T, E>::Result(Result<U, R>&& oth) : storage_(detail::FromStorageTag{}, std::move(oth.storage_)) {}
+
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+template <typename G> requires std::same_as<G, detail::ReturnObject<Result<T, E>>>
+Result<T, E>::Result(G&& gro) : Result(std::move(gro.Take(this))) {}
 
 // --- Operators ---
 
-template <typename T, concepts::IsError E> requires(!std::is_void_v<T>)
-Result<T, E>::operator bool() const noexcept {
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+constexpr Result<T, E>::operator bool() const noexcept {
     return is_ok();
 }
 
 // --- Observers ---
 
-template <typename T, concepts::IsError E> requires(!std::is_void_v<T>)
-bool Result<T, E>::is_ok() const noexcept {
-    return value_.index() == 0;
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+constexpr bool Result<T, E>::is_ok() const noexcept {
+    return storage_.is_ok();
 }
 
-template <typename T, concepts::IsError E> requires(!std::is_void_v<T>)
-bool Result<T, E>::is_err() const noexcept {
-    return value_.index() == 1;
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+constexpr bool Result<T, E>::is_err() const noexcept {
+    return !storage_.is_ok();
 }
 
 // --- Accessors: unwrap_ok ---
 
-template <typename T, concepts::IsError E> requires(!std::is_void_v<T>)
-constexpr const T& Result<T, E>::unwrap_ok(std::string_view msg) const& {
-    if (is_err()) throw std::runtime_error(std::string(msg));
-    return std::get<0>(value_);
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+constexpr std::add_lvalue_reference_t<const T> Result<T, E>::unwrap_ok(std::string_view msg EAV_SITE_PARAM_NODEFAULT) const& {
+    if (is_err()) [[unlikely]] {
+        EAV_REPORT(Result, kUnwrapMisuse);
+        detail::Panic(msg);
+    }
+    return detail::Unwrap(storage_.ok());
+}
+
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+constexpr std::add_lvalue_reference_t<T> Result<T, E>::unwrap_ok(std::string_view msg EAV_SITE_PARAM_NODEFAULT) & {
+    if (is_err()) [[unlikely]] {
+        EAV_REPORT(Result, kUnwrapMisuse);
+        detail::Panic(msg);
+    }
+    return detail::Unwrap(storage_.ok());
+}
+
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+constexpr T Result<T, E>::unwrap_ok(std::string_view msg EAV_SITE_PARAM_NODEFAULT) && {
+    if (is_err()) [[unlikely]] {
+        EAV_REPORT(Result, kUnwrapMisuse);
+        detail::Panic(msg);
+    }
+    return detail::Unwrap(std::move(storage_).ok());
+}
+
+// --- Accessors: unwrap_ok_unchecked ---
+
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+constexpr std::add_lvalue_reference_t<const T> Result<T, E>::unwrap_ok_unchecked() const& noexcept {
+    EAV_ASSUME(is_ok());
+    return detail::Unwrap(storage_.ok());
 }
 
-template <typename T, concepts::IsError E> requires(!std::is_void_v<T>)
-constexpr T& Result<T, E>::unwrap_ok(std::string_view msg) & {
-    if (is_err()) throw std::runtime_error(std::string(msg));
-    return std::get<0>(value_);
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+constexpr std::add_lvalue_reference_t<T> Result<T, E>::unwrap_ok_unchecked() & noexcept {
+    EAV_ASSUME(is_ok());
+    return detail::Unwrap(storage_.ok());
 }
 
-template <typename T, concepts::IsError E> requires(!std::is_void_v<T>)
-constexpr T Result<T, E>::unwrap_ok(std::string_view msg) && {
-    if (is_err()) throw std::runtime_error(std::string(msg));
-    return std::get<0>(std::move(value_));
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+constexpr T Result<T, E>::unwrap_ok_unchecked() && {
+    EAV_ASSUME(is_ok());
+    return detail::Unwrap(std::move(storage_).ok());
 }
 
 // --- Accessors: unwrap_ok_or ---
 
-template <typename T, concepts::IsError E> requires(!std::is_void_v<T>)
-template <typename U>
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+template <typename U> requires(!std::is_void_v<T> && (!std::is_reference_v<T> || std::is_lvalue_reference_v<U>))
 constexpr T Result<T, E>::unwrap_ok_or(U&& else_val) const& {
-    if (is_ok()) return std::get<0>(value_);
+    if (is_ok()) return detail::Unwrap(storage_.ok());
     return static_cast<T>(std::forward<U>(else_val));
 }
 
-template <typename T, concepts::IsError E> requires(!std::is_void_v<T>)
-template <typename U>
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+template <typename U> requires(!std::is_void_v<T> && (!std::is_reference_v<T> || std::is_lvalue_reference_v<U>))
 constexpr T Result<T, E>::unwrap_ok_or(U&& else_val) && {
-    if (is_ok()) return std::get<0>(std::move(value_));
+    if (is_ok()) return detail::Unwrap(std::move(storage_).ok());
     return static_cast<T>(std::forward<U>(else_val));
 }
 
 // --- Accessors: unwrap_err ---
 
-template <typename T, concepts::IsError E> requires(!std::is_void_v<T>)
-constexpr const E& Result<T, E>::unwrap_err(std::string_view msg) const& {
-    if (is_ok()) throw std::runtime_error(std::string(msg));
-    return std::get<1>(value_);
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+constexpr const E& Result<T, E>::unwrap_err(std::string_view msg EAV_SITE_PARAM_NODEFAULT) const& {
+    if (is_ok()) [[unlikely]] {
+        EAV_REPORT(Result, kUnwrapMisuse);
+        detail::Panic(msg);
+    }
+    return detail::Unwrap(storage_.err());
+}
+
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+constexpr E& Result<T, E>::unwrap_err(std::string_view msg EAV_SITE_PARAM_NODEFAULT) & {
+    if (is_ok()) [[unlikely]] {
+        EAV_REPORT(Result, kUnwrapMisuse);
+        detail::Panic(msg);
+    }
+    return detail::Unwrap(storage_.err());
+}
+
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+constexpr E Result<T, E>::unwrap_err(std::string_view msg EAV_SITE_PARAM_NODEFAULT) && {
+    if (is_ok()) [[unlikely]] {
+        EAV_REPORT(Result, kUnwrapMisuse);
+        detail::Panic(msg);
+    }
+    return detail::Unwrap(std::move(storage_).err());
+}
+
+// --- Accessors: unwrap_err_unchecked ---
+
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+constexpr const E& Result<T, E>::unwrap_err_unchecked() const& noexcept {
+    EAV_ASSUME(is_err());
+    return detail::Unwrap(storage_.err());
+}
+
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+constexpr E& Result<T, E>::unwrap_err_unchecked() & noexcept {
+    EAV_ASSUME(is_err());
+    return detail::Unwrap(storage_.err());
 }
 
-template <typename T, concepts::IsError E> requires(!std::is_void_v<T>)
-constexpr E& Result<T, E>::unwrap_err(std::string_view msg) & {
-    if (is_ok()) throw std::runtime_error(std::string(msg));
-    return std::get<1>(value_);
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+constexpr E Result<T, E>::unwrap_err_unchecked() && {
+    EAV_ASSUME(is_err());
+    return detail::Unwrap(std::move(storage_).err());
 }
 
-template <typename T, concepts::IsError E> requires(!std::is_void_v<T>)
-constexpr E Result<T, E>::unwrap_err(std::string_view msg) && {
-    if (is_ok()) throw std::runtime_error(std::string(msg));
-    return std::get<1>(std::move(value_));
+// --- Modifiers ---
+
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+template <typename... Args>
+constexpr std::add_lvalue_reference_t<T> Result<T, E>::emplace_ok(Args&&... args) {
+    return detail::Unwrap(storage_.emplace(detail::OkTag{}, std::forward<Args>(args)...));
+}
+
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+template <typename... Args>
+constexpr E& Result<T, E>::emplace_err(Args&&... args) {
+    return detail::Unwrap(storage_.emplace(detail::ErrTag{}, std::forward<Args>(args)...));
 }
 
 // --- Conversion: to Option<T> ---
 template <typename T, concepts::IsError E>
-requires(!std::is_void_v<T>)
-Option<T> Result<T, E>::erase_err() const& {
+requires(!std::is_rvalue_reference_v<T>)
+constexpr auto Result<T, E>::erase_err() const& requires(!std::is_void_v<T>) {
     if (is_ok()) {
-        return make::Some(unwrap_ok());
+        return detail::Access<Option<T>>::Some(unwrap_ok_unchecked());
     }
-    return make::None();
+    return detail::Access<Option<T>>::None();
 }
 
 template <typename T, concepts::IsError E>
-requires(!std::is_void_v<T>)
-Option<T> Result<T, E>::erase_err() && {
+requires(!std::is_rvalue_reference_v<T>)
+constexpr auto Result<T, E>::erase_err() && requires(!std::is_void_v<T>) {
+    if (is_ok()) {
+        return detail::Access<Option<T>>::Some(detail::Unwrap(std::move(storage_).ok()));
+    }
+    return detail::Access<Option<T>>::None();
+}
+
+// --- Conversion: borrowed view ---
+
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
+constexpr Result<detail::BorrowOf<T>, const E&> Result<T, E>::as_ref() const& noexcept {
+    using Ref = detail::Access<Result<detail::BorrowOf<T>, const E&>>;
     if (is_ok()) {
-        return make::Some(std::move(*this).unwrap_ok());
+        if constexpr (std::is_void_v<T>) {
+            return Ref::Ok();
+        } else {
+            return Ref::Ok(detail::Unwrap(storage_.ok()));
+        }
     }
-    return make::None();
+    return Ref::Err(detail::Unwrap(storage_.err()));
 }
 
 }  // namespace eav
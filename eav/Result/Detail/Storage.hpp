@@ -0,0 +1,381 @@
+#pragma once
+
+#include <memory>      // std::construct_at, std::destroy_at
+#include <type_traits>
+#include <utility>
+
+#include "../../Concepts/HasNiche.hpp"
+#include "../../Detail/Access.hpp"
+#include "../../Detail/Panic.hpp"
+#include "../../Detail/Payload.hpp"
+#include "../../Detail/Pending.hpp"
+#include "../../Detail/SpecialMembers.hpp"
+#include "Tags.hpp"
+
+namespace eav::detail {
+
+// Type without state that can be materialized at any moment (e.g. `struct NotFound {};`)
+template <typename T>
+concept Stateless =
+    std::is_empty_v<T> &&
+    std::is_trivially_default_constructible_v<T> &&
+    std::is_trivially_copyable_v<T> &&
+    !std::same_as<T, PendingType>;
+
+// Err is encoded as the niche of T; only a niche that no valid T holds, a plain pointer or a NaN
+// would turn Ok(nullptr) into an Err
+template <typename T, typename E>
+concept ErrInNicheOfOk = concepts::HasInvalidNiche<T> && Stateless<E>;
+
+// Ok is encoded as the niche of E
+template <typename T, typename E>
+concept OkInNicheOfErr = !ErrInNicheOfOk<T, E> && Stateless<T> && concepts::HasInvalidNiche<E>;
+
+// --- Generic layout: union + 1-byte tag ---
+
+// Union with trivial destructor if both alternatives have one; the active member is
+// destroyed by the payload
+template <typename T, typename E, bool = std::is_trivially_destructible_v<T> && std::is_trivially_destructible_v<E>>
+union ResultUnion {
+    char none_;
+    T ok_;
+    E err_;
+
+    constexpr ResultUnion() noexcept : none_() {}
+
+    template <typename... Args>
+    constexpr explicit ResultUnion(OkTag, Args&&... args) : ok_(std::forward<Args>(args)...) {}
+
+    template <typename... Args>
+    constexpr explicit ResultUnion(ErrTag, Args&&... args) : err_(std::forward<Args>(args)...) {}
+
+    template <typename F, typename... Args>
+    constexpr ResultUnion(InvokeTag, OkTag, F&& func, Args&&... args)
+        : ok_(Invoke(std::forward<F>(func), std::forward<Args>(args)...)) {}
+
+    template <typename F, typename... Args>
+    constexpr ResultUnion(InvokeTag, ErrTag, F&& func, Args&&... args)
+        : err_(Invoke(std::forward<F>(func), std::forward<Args>(args)...)) {}
+};
+
+template <typename T, typename E>
+union ResultUnion<T, E, false> {
+    char none_;
+    T ok_;
+    E err_;
+
+    constexpr ResultUnion() noexcept : none_() {}
+
+    template <typename... Args>
+    constexpr explicit ResultUnion(OkTag, Args&&... args) : ok_(std::forward<Args>(args)...) {}
+
+    template <typename... Args>
+    constexpr explicit ResultUnion(ErrTag, Args&&... args) : err_(std::forward<Args>(args)...) {}
+
+    template <typename F, typename... Args>
+    constexpr ResultUnion(InvokeTag, OkTag, F&& func, Args&&... args)
+        : ok_(Invoke(std::forward<F>(func), std::forward<Args>(args)...)) {}
+
+    template <typename F, typename... Args>
+    constexpr ResultUnion(InvokeTag, ErrTag, F&& func, Args&&... args)
+        : err_(Invoke(std::forward<F>(func), std::forward<Args>(args)...)) {}
+
+    constexpr ~ResultUnion() {}
+};
+
+template <typename T, typename E>
+class ResultPayload {
+  private:  // data members:
+    ResultUnion<T, E> union_;
+    bool is_ok_;
+
+  public:  // member functions:
+    template <typename... Args>
+    constexpr explicit ResultPayload(OkTag, Args&&... args)
+        : union_(OkTag{}, std::forward<Args>(args)...), is_ok_(true) {}
+
+    template <typename... Args>
+    constexpr explicit ResultPayload(ErrTag, Args&&... args)
+        : union_(ErrTag{}, std::forward<Args>(args)...), is_ok_(false) {}
+
+    template <typename F, typename... Args>
+    constexpr ResultPayload(InvokeTag, OkTag, F&& func, Args&&... args)
+        : union_(InvokeTag{}, OkTag{}, std::forward<F>(func), std::forward<Args>(args)...), is_ok_(true) {}
+
+    template <typename F, typename... Args>
+    constexpr ResultPayload(InvokeTag, ErrTag, F&& func, Args&&... args)
+        : union_(InvokeTag{}, ErrTag{}, std::forward<F>(func), std::forward<Args>(args)...), is_ok_(false) {}
+
+    // `oth` is any payload whose alternatives are T/PendingType and E/PendingType
+    template <typename Oth>
+    constexpr ResultPayload(FromStorageTag, Oth&& oth) noexcept(NothrowFrom<Oth>()) : is_ok_(oth.is_ok()) {
+        if (is_ok_) {
+            if constexpr (std::is_constructible_v<T, decltype(std::forward<Oth>(oth).ok())>) {
+                std::construct_at(&union_.ok_, std::forward<Oth>(oth).ok());
+            } else {
+                Panic("eav::Result: Attempted to move ok-value from PendingType");
+            }
+        } else {
+            if constexpr (std::is_constructible_v<E, decltype(std::forward<Oth>(oth).err())>) {
+                std::construct_at(&union_.err_, std::forward<Oth>(oth).err());
+            } else {
+                Panic("eav::Result: Attempted to move err-value from PendingType");
+            }
+        }
+    }
+
+    constexpr bool is_ok() const noexcept {
+        return is_ok_;
+    }
+
+    constexpr T& ok() & noexcept { return union_.ok_; }
+    constexpr const T& ok() const& noexcept { return union_.ok_; }
+    constexpr T&& ok() && noexcept { return std::move(union_.ok_); }
+
+    constexpr E& err() & noexcept { return union_.err_; }
+    constexpr const E& err() const& noexcept { return union_.err_; }
+    constexpr E&& err() && noexcept { return std::move(union_.err_); }
+
+    constexpr void destroy() noexcept {
+        if (is_ok_) {
+            std::destroy_at(&union_.ok_);
+        } else {
+            std::destroy_at(&union_.err_);
+        }
+    }
+
+    // Never leaves the payload valueless: if constructing the new alternative may throw,
+    // it is built aside first (or the old one is backed up and restored)
+    template <typename Oth>
+    constexpr void assign_from(Oth&& oth) noexcept(
+        NothrowFrom<Oth>() &&
+        std::is_nothrow_assignable_v<T&, decltype(std::declval<Oth>().ok())> &&
+        std::is_nothrow_assignable_v<E&, decltype(std::declval<Oth>().err())>) {
+        if (is_ok_ && oth.is_ok()) {
+            union_.ok_ = std::forward<Oth>(oth).ok();
+        } else if (!is_ok_ && !oth.is_ok()) {
+            union_.err_ = std::forward<Oth>(oth).err();
+        } else if (oth.is_ok()) {
+            reinit(union_.err_, union_.ok_, std::forward<Oth>(oth).ok());
+            is_ok_ = true;
+        } else {
+            reinit(union_.ok_, union_.err_, std::forward<Oth>(oth).err());
+            is_ok_ = false;
+        }
+    }
+
+    // Replaces the current value (of either alternative) with one constructed from `args...`
+    template <typename... Args>
+    constexpr T& emplace(OkTag, Args&&... args) {
+        if (is_ok_) {
+            reinit(union_.ok_, union_.ok_, std::forward<Args>(args)...);
+        } else {
+            reinit(union_.err_, union_.ok_, std::forward<Args>(args)...);
+            is_ok_ = true;
+        }
+        return union_.ok_;
+    }
+
+    template <typename... Args>
+    constexpr E& emplace(ErrTag, Args&&... args) {
+        if (is_ok_) {
+            reinit(union_.ok_, union_.err_, std::forward<Args>(args)...);
+            is_ok_ = false;
+        } else {
+            reinit(union_.err_, union_.err_, std::forward<Args>(args)...);
+        }
+        return union_.err_;
+    }
+
+  private:  // member functions:
+    template <typename Oth>
+    static constexpr bool NothrowFrom() {
+        return std::is_nothrow_constructible_v<T, decltype(std::declval<Oth>().ok())> &&
+               std::is_nothrow_constructible_v<E, decltype(std::declval<Oth>().err())>;
+    }
+
+    template <typename Old, typename New, typename... Args>
+    static constexpr void reinit(Old& old_val, New& new_val, Args&&... args) {
+        if constexpr (std::is_nothrow_constructible_v<New, Args...>) {
+            std::destroy_at(&old_val);
+            std::construct_at(&new_val, std::forward<Args>(args)...);
+        } else if constexpr (std::is_nothrow_move_constructible_v<New>) {
+            New tmp(std::forward<Args>(args)...);
+            std::destroy_at(&old_val);
+            std::construct_at(&new_val, std::move(tmp));
+        } else {
+            static_assert(std::is_nothrow_move_constructible_v<Old>,
+                          "eav::Result: replacing a value that may throw on construction requires the old "
+                          "one to be nothrow move constructible");
+            Old backup(std::move(old_val));
+            std::destroy_at(&old_val);
+#if defined(__cpp_exceptions)
+            try {
+                std::construct_at(&new_val, std::forward<Args>(args)...);
+            } catch (...) {
+                std::construct_at(&old_val, std::move(backup));
+                throw;
+            }
+#else
+            std::construct_at(&new_val, std::forward<Args>(args)...);
+#endif
+        }
+    }
+};
+
+// --- Niche layouts: the stateless alternative is encoded as the niche of the other one ---
+// --- Both members are always alive, so special members are the implicit ones           ---
+
+template <typename T, typename E>
+class ErrInNichePayload {
+  private:  // data members:
+    T ok_;  // NicheTraits<T>::none() <=> Err
+    [[no_unique_address]] E err_;
+
+  public:  // member functions:
+    template <typename... Args>
+    constexpr explicit ErrInNichePayload(OkTag, Args&&... args)
+        : ok_(std::forward<Args>(args)...), err_() {}
+
+    template <typename... Args>
+    constexpr explicit ErrInNichePayload(ErrTag, Args&&...)
+        : ok_(NicheTraits<T>::none()), err_() {}
+
+    template <typename F, typename... Args>
+    constexpr ErrInNichePayload(InvokeTag, OkTag, F&& func, Args&&... args)
+        : ok_(Invoke(std::forward<F>(func), std::forward<Args>(args)...)), err_() {}
+
+    // The stateless error is not stored, but `func` is still called
+    template <typename F, typename... Args>
+    constexpr ErrInNichePayload(InvokeTag, ErrTag, F&& func, Args&&... args)
+        : ok_(NicheTraits<T>::none()), err_() {
+        Invoke(std::forward<F>(func), std::forward<Args>(args)...);
+    }
+
+    template <typename Oth>
+    constexpr ErrInNichePayload(FromStorageTag, Oth&& oth)
+        : ok_(take_ok(std::forward<Oth>(oth))), err_() {}
+
+    constexpr bool is_ok() const noexcept {
+        return !NicheTraits<T>::is_none(ok_);
+    }
+
+    template <typename... Args>
+    constexpr T& emplace(OkTag, Args&&... args) {
+        ok_ = T(std::forward<Args>(args)...);
+        return ok_;
+    }
+
+    template <typename... Args>
+    constexpr E& emplace(ErrTag, Args&&...) {
+        ok_ = NicheTraits<T>::none();
+        return err_;
+    }
+
+    constexpr T& ok() & noexcept { return ok_; }
+    constexpr const T& ok() const& noexcept { return ok_; }
+    constexpr T&& ok() && noexcept { return std::move(ok_); }
+
+    constexpr E& err() & noexcept { return err_; }
+    constexpr const E& err() const& noexcept { return err_; }
+    constexpr E&& err() && noexcept { return std::move(err_); }
+
+  private:  // member functions:
+    template <typename Oth>
+    static constexpr T take_ok(Oth&& oth) {
+        if constexpr (std::is_constructible_v<T, decltype(std::forward<Oth>(oth).ok())>) {
+            if (oth.is_ok()) {
+                return T(std::forward<Oth>(oth).ok());
+            }
+        }
+        return NicheTraits<T>::none();
+    }
+};
+
+template <typename T, typename E>
+class OkInNichePayload {
+  private:  // data members:
+    [[no_unique_address]] T ok_;
+    E err_;  // NicheTraits<E>::none() <=> Ok
+
+  public:  // member functions:
+    template <typename... Args>
+    constexpr explicit OkInNichePayload(OkTag, Args&&...)
+        : ok_(), err_(NicheTraits<E>::none()) {}
+
+    template <typename... Args>
+    constexpr explicit OkInNichePayload(ErrTag, Args&&... args)
+        : ok_(), err_(std::forward<Args>(args)...) {}
+
+    // The stateless value is not stored, but `func` is still called
+    template <typename F, typename... Args>
+    constexpr OkInNichePayload(InvokeTag, OkTag, F&& func, Args&&... args)
+        : ok_(), err_(NicheTraits<E>::none()) {
+        Invoke(std::forward<F>(func), std::forward<Args>(args)...);
+    }
+
+    template <typename F, typename... Args>
+    constexpr OkInNichePayload(InvokeTag, ErrTag, F&& func, Args&&... args)
+        : ok_(), err_(Invoke(std::forward<F>(func), std::forward<Args>(args)...)) {}
+
+    template <typename Oth>
+    constexpr OkInNichePayload(FromStorageTag, Oth&& oth)
+        : ok_(), err_(take_err(std::forward<Oth>(oth))) {}
+
+    constexpr bool is_ok() const noexcept {
+        return NicheTraits<E>::is_none(err_);
+    }
+
+    template <typename... Args>
+    constexpr T& emplace(OkTag, Args&&...) {
+        err_ = NicheTraits<E>::none();
+        return ok_;
+    }
+
+    template <typename... Args>
+    constexpr E& emplace(ErrTag, Args&&... args) {
+        err_ = E(std::forward<Args>(args)...);
+        return err_;
+    }
+
+    constexpr T& ok() & noexcept { return ok_; }
+    constexpr const T& ok() const& noexcept { return ok_; }
+    constexpr T&& ok() && noexcept { return std::move(ok_); }
+
+    constexpr E& err() & noexcept { return err_; }
+    constexpr const E& err() const& noexcept { return err_; }
+    constexpr E&& err() && noexcept { return std::move(err_); }
+
+  private:  // member functions:
+    template <typename Oth>
+    static constexpr E take_err(Oth&& oth) {
+        if constexpr (std::is_constructible_v<E, decltype(std::forward<Oth>(oth).err())>) {
+            if (!oth.is_ok()) {
+                return E(std::forward<Oth>(oth).err());
+            }
+        }
+        return NicheTraits<E>::none();
+    }
+};
+
+// --- Layout selection ---
+
+template <typename T, typename E>
+struct SelectResultStorage {
+    using Type = WithSpecialMembers<ResultPayload<T, E>, T, E>;
+};
+
+template <typename T, typename E> requires ErrInNicheOfOk<T, E>
+struct SelectResultStorage<T, E> {
+    using Type = ErrInNichePayload<T, E>;
+};
+
+template <typename T, typename E> requires OkInNicheOfErr<T, E>
+struct SelectResultStorage<T, E> {
+    using Type = OkInNichePayload<T, E>;
+};
+
+template <typename T, typename E>
+using ResultStorage = typename SelectResultStorage<T, E>::Type;
+
+}  // namespace eav::detail
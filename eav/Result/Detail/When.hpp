@@ -0,0 +1,195 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>  // std::size_t
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../../Detail/Call.hpp"
+#include "../../Exec/Executor.hpp"
+#include "../../Exec/StopToken.hpp"
+#include "../../Option/Core.hpp"
+#include "../../Option/Detail/Access.hpp"
+#include "../Core.hpp"
+
+namespace eav::detail {
+
+// func(token) if func takes a StopToken, func() otherwise
+template <typename F>
+decltype(auto) CallWithStop(F& func, exec::StopToken token) {
+    if constexpr (std::is_invocable_v<F&, exec::StopToken>) {
+        return Call(func, token);
+    } else {
+        return Call(func);
+    }
+}
+
+template <typename F>
+using WhenResultOf = std::remove_cvref_t<decltype(CallWithStop(std::declval<F&>(), exec::StopToken{}))>;
+
+template <typename R>
+concept WhenInputResult = requires {
+    typename R::OkType;
+    typename R::ErrType;
+} && !std::is_void_v<typename R::ErrType> && std::is_object_v<typename R::OkType> &&
+    !std::same_as<typename R::ErrType, PendingType>;
+
+// Number of inputs still to finish; the caller sleeps on it. The last CountDown notifies under
+// the lock, so the caller cannot see zero, return and destroy the latch (it lives in the
+// caller's frame) before the notifying thread is done with it; std::atomic::wait cannot promise
+// that, the notify comes after the decrement the caller may already have seen
+class WhenLatch {
+  private:  // data members:
+    std::mutex mutex_;
+    std::condition_variable done_;
+    std::size_t pending_;
+
+  public:  // member functions:
+    explicit WhenLatch(std::size_t n) noexcept : pending_(n) {}
+
+    void CountDown() noexcept {
+        std::lock_guard lock(mutex_);
+        if (--pending_ == 0) {
+            done_.notify_all();
+        }
+    }
+
+    void Wait() noexcept {
+        std::unique_lock lock(mutex_);
+        done_.wait(lock, [this] { return pending_ == 0; });
+    }
+};
+
+// Input I of a group, posted to the executor as a Job. Lives in the caller's frame, like the
+// group: WhenAll/WhenAny return only after every input has counted down
+template <typename Group, std::size_t I>
+class WhenJob final : public exec::Job {
+  private:  // data members:
+    Group* group_;
+
+  public:  // member functions:
+    explicit WhenJob(Group& group) noexcept : group_(&group) {}
+
+    void Run() noexcept override {
+        group_->template RunInput<I>();
+    }
+};
+
+// The shared part of WhenAll and WhenAny: the inputs, their jobs, the stop flag and the latch.
+// `Derived::Settle<I>(res)` records the outcome of input I and returns true once the outcome of
+// the whole group is decided, which stops the inputs that have not started.
+template <typename Derived, typename... F>
+class WhenGroup {
+  private:  // data members:
+    std::tuple<F...> funcs_;
+    std::atomic<bool> stop_{false};
+    WhenLatch latch_{sizeof...(F)};
+
+  public:  // member functions:
+    explicit WhenGroup(F&&... funcs) : funcs_(std::move(funcs)...) {}
+
+    // Posts every input but the last, runs the last here, waits for the others. On a thread of
+    // the executor itself every input runs here, in order: the posted ones could wait forever
+    // behind this call (e.g. a pool of one worker), and so could a pool whose workers all wait
+    template <exec::Executor X>
+    void RunAll(X& executor) {
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            if (exec::OwnsThisThread(executor)) {
+                (RunInput<I>(), ...);
+                return;
+            }
+            std::tuple<WhenJob<WhenGroup, I>...> jobs(WhenJob<WhenGroup, I>(*this)...);
+            ((I + 1 < sizeof...(F) ? executor.Post(std::get<I>(jobs)) : RunInput<I>()), ...);
+            latch_.Wait();
+        }(std::index_sequence_for<F...>{});
+    }
+
+    template <std::size_t I>
+    void RunInput() noexcept {
+        if (!stop_.load(std::memory_order_relaxed)) {
+            auto res = CallWithStop(std::get<I>(funcs_), exec::StopToken(stop_));
+            if (static_cast<Derived*>(this)->template Settle<I>(std::move(res))) {
+                stop_.store(true, std::memory_order_relaxed);
+            }
+        }
+        latch_.CountDown();
+    }
+};
+
+// All Ok => the values; otherwise the first Err to arrive
+template <typename E, typename... F>
+class WhenAllGroup : public WhenGroup<WhenAllGroup<E, F...>, F...> {
+  private:  // data members:
+    std::tuple<Option<typename WhenResultOf<F>::OkType>...> values_{
+        Option<typename WhenResultOf<F>::OkType>(make::None())...};
+    Option<E> error_ = make::None();
+    std::atomic<bool> failed_{false};
+
+  public:  // member functions:
+    using WhenGroup<WhenAllGroup, F...>::WhenGroup;
+
+    template <std::size_t I, typename R>
+    bool Settle(R&& res) noexcept {
+        if (res.is_ok()) {
+            std::get<I>(values_).emplace(Access<R>::TakeOk(std::move(res)));
+            return false;
+        }
+        bool expected = false;
+        if (failed_.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+            error_.emplace(Access<R>::TakeErr(std::move(res)));
+        }
+        return true;
+    }
+
+    Result<std::tuple<typename WhenResultOf<F>::OkType...>, E> Take() && {
+        using Out = Access<Result<std::tuple<typename WhenResultOf<F>::OkType...>, E>>;
+        if (failed_.load(std::memory_order_acquire)) {
+            return Out::Err(Access<Option<E>>::Take(std::move(error_)));
+        }
+        return std::apply(
+            [](auto&... slots) {
+                return Out::Ok(Access<std::remove_reference_t<decltype(slots)>>::Take(std::move(slots))...);
+            },
+            values_);
+    }
+};
+
+// The first Ok to arrive; if every input fails, the last Err to arrive
+template <typename T, typename E, typename... F>
+class WhenAnyGroup : public WhenGroup<WhenAnyGroup<T, E, F...>, F...> {
+  private:  // data members:
+    Option<T> value_ = make::None();
+    Option<E> error_ = make::None();
+    std::atomic<bool> won_{false};
+    std::atomic<std::size_t> failures_{0};
+
+  public:  // member functions:
+    using WhenGroup<WhenAnyGroup, F...>::WhenGroup;
+
+    template <std::size_t I, typename R>
+    bool Settle(R&& res) noexcept {
+        if (res.is_ok()) {
+            bool expected = false;
+            if (won_.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                value_.emplace(Access<R>::TakeOk(std::move(res)));
+            }
+            return true;
+        }
+        if (failures_.fetch_add(1, std::memory_order_acq_rel) + 1 == sizeof...(F)) {
+            error_.emplace(Access<R>::TakeErr(std::move(res)));
+        }
+        return false;
+    }
+
+    Result<T, E> Take() && {
+        if (won_.load(std::memory_order_acquire)) {
+            return Access<Result<T, E>>::Ok(Access<Option<T>>::Take(std::move(value_)));
+        }
+        return Access<Result<T, E>>::Err(Access<Option<E>>::Take(std::move(error_)));
+    }
+};
+
+}  // namespace eav::detail
@@ -1,11 +1,15 @@
 #pragma once
 
+#include <type_traits>  // std::decay_t
+
+#include "../../Detail/Instrument.hpp"
 #include "../Concepts/IsError.hpp"
 #include "../FwdDecl/Result.hpp"
 
 namespace eav::make {
 
 // forward declaration: Err()
-template <concepts::IsError E> Result<detail::PendingType, E> Err(E&& val);
+template <typename E> requires concepts::IsError<std::decay_t<E>>
+constexpr Result<detail::PendingType, std::decay_t<E>> Err(E&& val EAV_SITE_PARAM);
 
 }  // namespace eav::make
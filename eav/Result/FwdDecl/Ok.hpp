@@ -1,10 +1,12 @@
 #pragma once
 
+#include <type_traits>  // std::decay_t
+
 #include "../FwdDecl/Result.hpp"
 
 namespace eav::make {
 
 // forward declaration: Ok()
-template <typename T> Result<T, detail::PendingType> Ok(T&& val);
+template <typename T> constexpr Result<std::decay_t<T>, detail::PendingType> Ok(T&& val);
 
 }  // namespace eav::make
@@ -1,13 +1,13 @@
 #pragma once
 
-#include <type_traits>  // std::is_void_v
+#include <type_traits>  // std::is_rvalue_reference_v
 
 #include "../Concepts/IsError.hpp"
 
 namespace eav {
 
 // forward declaration: Result<T,E>
-template <typename T, concepts::IsError E> requires(!std::is_void_v<T>)
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
 class Result;
 
 }  // namespace eav
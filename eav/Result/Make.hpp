@@ -1,28 +1,59 @@
 #pragma once
 
-#include <utility>  // std::forward
+#include <type_traits>  // std::decay_t
+#include <utility>      // std::forward, std::in_place_t
 
 #include "../Detail/Pending.hpp"
 #include "Concepts/IsError.hpp"
+#include "Detail/Access.hpp"
 #include "Detail/Tags.hpp"
 
 namespace eav {
 
-template <typename T, concepts::IsError E> requires(!std::is_void_v<T>)
+template <typename T, concepts::IsError E> requires(!std::is_rvalue_reference_v<T>)
 class Result;
 
 namespace make {
 
-// Ok(T) => Result<T, PendingType>
+// Ok(T) => Result<T, PendingType> (the value is copied/moved: Ok(lvalue) does not make a reference)
 template <typename T>
-Result<T, detail::PendingType> Ok(T&& val) {
-    return Result<T, detail::PendingType>(detail::OkTag{}, std::forward<T>(val));
+constexpr Result<std::decay_t<T>, detail::PendingType> Ok(T&& val) {
+    return Result<std::decay_t<T>, detail::PendingType>(detail::OkTag{}, std::forward<T>(val));
 }
 
-// Err(E) => Result<PendingType, E>
-template <concepts::IsError E>
-Result<detail::PendingType, E> Err(E&& val) {
-    return Result<detail::PendingType, E>(detail::ErrTag{}, std::forward<E>(val));
+// Ok() => Result<void, PendingType>
+constexpr Result<void, detail::PendingType> Ok() {
+    return detail::Access<Result<void, detail::PendingType>>::Ok();
+}
+
+// OkRef(T&) => Result<T&, PendingType>, refers to `ref` (no copy)
+template <typename T>
+constexpr Result<T&, detail::PendingType> OkRef(T& ref) {
+    return detail::Access<Result<T&, detail::PendingType>>::Ok(ref);
+}
+
+template <typename T>
+void OkRef(const T&&) = delete;
+
+// Err(E) => Result<PendingType, E> (like Ok, Err(lvalue) copies: it does not make a reference)
+template <typename E> requires concepts::IsError<std::decay_t<E>>
+constexpr Result<detail::PendingType, std::decay_t<E>> Err(E&& val EAV_SITE_PARAM_NODEFAULT) {
+    EAV_REPORT(std::decay_t<E>, kMakeErr);
+    return Result<detail::PendingType, std::decay_t<E>>(detail::ErrTag{}, std::forward<E>(val));
+}
+
+// Ok<T, E>(std::in_place, args...) => Result<T, E>, T constructed from `args...` inside the Result.
+// With E given the result has its final type and is never moved, so this is the way to make
+// Results of non-movable T (the PendingType upgrade of Ok<T>(...) has to move the value)
+template <typename T, concepts::IsError E = detail::PendingType, typename... Args>
+constexpr Result<T, E> Ok(std::in_place_t, Args&&... args) {
+    return detail::Access<Result<T, E>>::Ok(std::forward<Args>(args)...);
+}
+
+// Err<E, T>(std::in_place, args...) => Result<T, E>
+template <concepts::IsError E, typename T = detail::PendingType, typename... Args>
+constexpr Result<T, E> Err(std::in_place_t, Args&&... args) {
+    return detail::Access<Result<T, E>>::Err(std::forward<Args>(args)...);
 }
 
 }  // namespace make
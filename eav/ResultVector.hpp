@@ -0,0 +1,93 @@
+#pragma once
+
+#include <concepts>  // std::default_initializable
+#include <cstddef>   // std::size_t
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "Batch/Detail/Bitmap.hpp"
+#include "Detail/Access.hpp"
+#include "Result.hpp"
+
+namespace eav {
+
+// Columnar batch of Result<T, E>: a packed validity bitmap (bit i <=> row i is Ok) and two
+// contiguous columns, T for Ok rows and E for Err rows. Unlike std::vector<Result<T, E>> the
+// values are not interleaved with tags, so a combinator applied to the whole batch walks a
+// dense array of T (see Batch/ResultCombinators.hpp).
+// Every row has a slot in both columns (the unused one holds a default-constructed value),
+// which keeps row i at index i and lets a combinator replace one column without touching the other.
+template <typename T, concepts::IsError E>
+requires(std::default_initializable<T> && std::default_initializable<E>)
+class ResultVector {
+  public:  // nested types:
+    using value_type = Result<T, E>;
+
+  private:  // data members:
+    detail::Bitmap valid_;
+    std::vector<T> ok_;
+    std::vector<E> err_;
+
+  public:  // member functions:
+    // Constructors and destructor:
+    ResultVector() = default;
+    ResultVector(const ResultVector&) = default;
+    ResultVector(ResultVector&&) = default;
+
+    // Conversion: std::vector<Result<T,E>> => ResultVector<T,E>
+    constexpr explicit ResultVector(std::vector<Result<T, E>>&& rows);
+
+    ~ResultVector() = default;
+
+    // Operators:
+    ResultVector& operator=(const ResultVector&) = default;
+    ResultVector& operator=(ResultVector&&) = default;
+
+    // Observers:
+    constexpr std::size_t size() const noexcept;
+    constexpr bool empty() const noexcept;
+    constexpr std::size_t ok_count() const noexcept;
+    constexpr bool is_ok(std::size_t i) const noexcept;
+    constexpr bool is_err(std::size_t i) const noexcept;
+
+    // Accessors:
+    // Row i as a Result (copies the payload)
+    constexpr Result<T, E> operator[](std::size_t i) const;
+
+    // Whole columns; ok_column()[i] is meaningful only if is_ok(i), err_column()[i] only if is_err(i)
+    constexpr std::span<T> ok_column() noexcept;
+    constexpr std::span<const T> ok_column() const noexcept;
+    constexpr std::span<E> err_column() noexcept;
+    constexpr std::span<const E> err_column() const noexcept;
+    constexpr const detail::Bitmap& validity() const noexcept;
+
+    // Modifiers:
+    template <typename... Args>
+    constexpr void push_ok(Args&&... args);
+
+    template <typename... Args>
+    constexpr void push_err(Args&&... args);
+
+    constexpr void push_back(Result<T, E>&& res);
+    constexpr void reserve(std::size_t n);
+    constexpr void clear() noexcept;
+
+    // Conversion: ResultVector<T,E> => std::vector<Result<T,E>>
+    constexpr std::vector<Result<T, E>> to_vector() const&;
+    constexpr std::vector<Result<T, E>> to_vector() &&;
+
+  private:  // member functions:
+    // Assembled by batch combinators from ready columns (all three of the same size)
+    constexpr ResultVector(detail::Bitmap&& valid, std::vector<T>&& ok, std::vector<E>&& err);
+
+  private:  // friends declaration:
+    template <typename R>
+    friend struct detail::Access;
+};
+
+}  // namespace eav
+
+// for including 'ResultVector' "module" via '#include <eav/ResultVector.hpp>':
+#include "Batch/ResultCombinators.hpp"
+#include "Batch/Detail/ResultVectorImpl.hpp"
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <source_location>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>  // std::move
+
+#include "Error/Detail/Backtrace.hpp"
+#include "Error/Detail/Format.hpp"
+#include "Error/Detail/Symbolize.hpp"
+#include "Result/Concepts/IsError.hpp"
+
+namespace eav {
+
+// An error that remembers where it was created: the source location, always, and the raw
+// return addresses of the calls leading there, when sampled (SetTraceSampling; Linux with
+// GCC/Clang). Capture is a frame-pointer walk into a fixed buffer, with no allocation and no
+// symbol lookup. Symbols are resolved with dladdr only when the trace is printed. Build with
+// -fno-omit-frame-pointer for complete traces, and link with -rdynamic to name functions of
+// the executable.
+//
+//     return make::Err(Traced(ParseError::kBadHeader));
+//     ...
+//     std::fputs(res.unwrap_err().to_string().c_str(), stderr);
+template <concepts::IsError E>
+class Traced {
+  private:  // data members:
+    E error_;
+    std::source_location origin_;
+    detail::RawBacktrace trace_;
+
+  public:  // member functions:
+    explicit Traced(E error, std::source_location origin = std::source_location::current()) noexcept(
+        std::is_nothrow_move_constructible_v<E>)
+        : error_(std::move(error)), origin_(origin) {
+        detail::MaybeCapture(trace_, SiteKey(origin));
+    }
+
+    const E& error() const& noexcept {
+        return error_;
+    }
+
+    E& error() & noexcept {
+        return error_;
+    }
+
+    E error() && noexcept(std::is_nothrow_move_constructible_v<E>) {
+        return std::move(error_);
+    }
+
+    const std::source_location& origin() const noexcept {
+        return origin_;
+    }
+
+    // Return addresses, innermost first; empty if this error was not sampled
+    std::span<void* const> frames() const noexcept {
+        return {trace_.frames.data(), trace_.size};
+    }
+
+    // One symbolized line per frame: "  #0 0x... in Function+0x1c (module)"
+    std::string backtrace() const {
+        std::string out;
+        for (std::size_t i = 0; i < trace_.size; ++i) {
+            out += "  #";
+            detail::AppendFormatted(out, i);
+            out += ' ';
+            detail::AppendSymbolized(out, trace_.frames[i]);
+            out += '\n';
+        }
+        return out;
+    }
+
+    // "error (at file:line)" followed by the backtrace
+    std::string to_string() const {
+        std::string out;
+        detail::AppendFormatted(out, error_);
+        out += " (at ";
+        out += origin_.file_name();
+        out += ':';
+        detail::AppendFormatted(out, origin_.line());
+        out += ")\n";
+        out += backtrace();
+        return out;
+    }
+
+  private:
+    static std::uintptr_t SiteKey(const std::source_location& loc) noexcept {
+        return reinterpret_cast<std::uintptr_t>(loc.file_name()) * 31 + loc.line() * 131 + loc.column() + 1;
+    }
+};
+
+}  // namespace eav
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <concepts>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+namespace eav {
+
+// A family of error codes: a name and a message per code (messages[code]; codes outside the
+// table have no message). Built at compile time, never copied: ErrorCode refers to it by id.
+struct ErrorCategory {
+    std::string_view name;
+    std::span<const std::string_view> messages;
+
+    constexpr std::string_view message(int code) const noexcept {
+        if (code < 0 || static_cast<std::size_t>(code) >= messages.size()) {
+            return "unknown error";
+        }
+        return messages[static_cast<std::size_t>(code)];
+    }
+};
+
+// ErrorCategoryTraits<Enum> makes an enum a source of ErrorCode values:
+//     enum class HttpError { kOk, kRateLimited, kBadRequest };
+//
+//     template <>
+//     struct eav::ErrorCategoryTraits<HttpError> {
+//         static constexpr std::string_view messages[] = {"ok", "rate limited", "bad request"};
+//         static constexpr ErrorCategory category{"http", messages};
+//     };
+//
+// The enumerators are the codes, so they should be small and dense to index `messages`.
+template <typename Enum>
+struct ErrorCategoryTraits;
+
+namespace concepts {
+
+template <typename Enum>
+concept IsErrorEnum = std::is_enum_v<Enum> && requires {
+    { ErrorCategoryTraits<Enum>::category } -> std::convertible_to<const ErrorCategory&>;
+};
+
+}  // namespace concepts
+
+}  // namespace eav
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <bit>          // std::bit_cast
+#include <cstdint>      // std::uint32_t, std::uint64_t
+#include <memory>       // std::unique_ptr, std::shared_ptr
+#include <type_traits>
+
+namespace eav {
+
+// NicheTraits<T> describes a "niche" of T: a value that a valid T never holds and that
+// Option<T> reuses as its None marker instead of storing a separate flag.
+// With a niche sizeof(Option<T>) == sizeof(T).
+//
+// A specialization that enables the niche must provide:
+//   static constexpr bool has_niche = true;
+//   static T none() noexcept;                 // builds the reserved value
+//   static bool is_none(const T&) noexcept;   // recognizes the reserved value
+//
+// The reserved value itself can't be held as Some: make::Some(static_cast<int*>(nullptr))
+// yields an Option<int*> with has_value() == false.
+//
+// Result<T, E> packs a stateless alternative into the niche of the other one only if that value
+// can never be a valid payload, which a specialization states with
+//   static constexpr bool none_is_invalid = true;
+// It is left out where the reserved value is an ordinary one (nullptr for pointers, the NaN for
+// floats): Ok(nullptr) must stay Ok.
+template <typename T>
+struct NicheTraits {
+    static constexpr bool has_niche = false;
+};
+
+// Helper for types with a reserved constant (typically enums):
+//     template <>
+//     struct eav::NicheTraits<Color> : eav::ReservedValueNiche<Color, Color::Invalid> {};
+template <typename T, T Reserved>
+struct ReservedValueNiche {
+    static constexpr bool has_niche = true;
+
+    static constexpr T none() noexcept {
+        return Reserved;
+    }
+
+    static constexpr bool is_none(const T& val) noexcept {
+        return val == Reserved;
+    }
+};
+
+// --- Pointers: nullptr ---
+
+template <typename T>
+struct NicheTraits<T*> {
+    static constexpr bool has_niche = true;
+
+    static constexpr T* none() noexcept {
+        return nullptr;
+    }
+
+    static constexpr bool is_none(T* const& val) noexcept {
+        return val == nullptr;
+    }
+};
+
+template <typename T, typename D> requires std::is_nothrow_default_constructible_v<D>
+struct NicheTraits<std::unique_ptr<T, D>> {
+    static constexpr bool has_niche = true;
+
+    static std::unique_ptr<T, D> none() noexcept {
+        return std::unique_ptr<T, D>();
+    }
+
+    static bool is_none(const std::unique_ptr<T, D>& val) noexcept {
+        return !val;
+    }
+};
+
+template <typename T>
+struct NicheTraits<std::shared_ptr<T>> {
+    static constexpr bool has_niche = true;
+
+    static std::shared_ptr<T> none() noexcept {
+        return std::shared_ptr<T>();
+    }
+
+    static bool is_none(const std::shared_ptr<T>& val) noexcept {
+        return !val;
+    }
+};
+
+// --- References: a reference_wrapper can't be null, so it is bound to a dedicated ---
+// --- static object that no user code can refer to                                  ---
+
+// std::reference_wrapper<T> is recognized through std::unwrap_reference (<type_traits>), so
+// this header does not need <functional>
+template <typename W>
+requires(!std::is_same_v<std::unwrap_reference_t<W>, W> &&
+         std::is_object_v<std::remove_reference_t<std::unwrap_reference_t<W>>>)
+struct NicheTraits<W> {
+  private:
+    using T = std::remove_reference_t<std::unwrap_reference_t<W>>;
+
+  public:
+    static constexpr bool has_niche = true;
+    static constexpr bool none_is_invalid = true;
+
+    static W none() noexcept {
+        return W(*reinterpret_cast<T*>(sentinel_));
+    }
+
+    static bool is_none(const W& val) noexcept {
+        return static_cast<const void*>(&val.get()) == static_cast<const void*>(sentinel_);
+    }
+
+  private:
+    alignas(T) static inline unsigned char sentinel_[sizeof(T)];
+};
+
+// --- Floating point: one quiet NaN with a payload that arithmetic never produces ---
+
+template <>
+struct NicheTraits<float> {
+    static constexpr bool has_niche = true;
+    static constexpr std::uint32_t bits = 0x7FC0'EA5Fu;
+
+    static constexpr float none() noexcept {
+        return std::bit_cast<float>(bits);
+    }
+
+    static constexpr bool is_none(const float& val) noexcept {
+        return std::bit_cast<std::uint32_t>(val) == bits;
+    }
+};
+
+template <>
+struct NicheTraits<double> {
+    static constexpr bool has_niche = true;
+    static constexpr std::uint64_t bits = 0x7FF8'0000'0000'EA5Full;
+
+    static constexpr double none() noexcept {
+        return std::bit_cast<double>(bits);
+    }
+
+    static constexpr bool is_none(const double& val) noexcept {
+        return std::bit_cast<std::uint64_t>(val) == bits;
+    }
+};
+
+}  // namespace eav
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>      // std::size_t
+#include <cstring>      // std::memcpy
+#include <memory>       // std::unique_ptr, std::shared_ptr, std::construct_at, std::destroy_at
+#include <type_traits>
+#include <utility>      // std::move
+
+#include "../Option/FwdDecl/Option.hpp"
+#include "../Result/FwdDecl/Result.hpp"
+
+namespace eav {
+
+// RelocationTraits<T> tells whether T is trivially relocatable: moving an object to new
+// storage and destroying the source is equivalent to copying its bytes and forgetting the
+// source. Containers and arenas can then grow with a single memcpy (see RelocateN below).
+//
+// Every trivially copyable type is; other types opt in with a specialization:
+//     template <>
+//     struct eav::RelocationTraits<MyHandle> {
+//         static constexpr bool trivially_relocatable = true;
+//     };
+// Only do so for types that do not store pointers into themselves (e.g. libstdc++'s
+// std::string with its small buffer does).
+template <typename T>
+struct RelocationTraits {
+    static constexpr bool trivially_relocatable = std::is_trivially_copyable_v<T>;
+};
+
+// --- Owning smart pointers: the owner is the pointer value, not its address ---
+
+template <typename T>
+struct RelocationTraits<std::unique_ptr<T>> {
+    static constexpr bool trivially_relocatable = true;
+};
+
+template <typename T>
+struct RelocationTraits<std::shared_ptr<T>> {
+    static constexpr bool trivially_relocatable = true;
+};
+
+// --- Option / Result: as relocatable as their payloads (union + tag, no self-references) ---
+
+template <typename T>
+struct RelocationTraits<Option<T>> {
+    static constexpr bool trivially_relocatable = RelocationTraits<T>::trivially_relocatable;
+};
+
+template <typename T, typename E>
+struct RelocationTraits<Result<T, E>> {
+    static constexpr bool trivially_relocatable =
+        RelocationTraits<T>::trivially_relocatable && RelocationTraits<E>::trivially_relocatable;
+};
+
+// Moves `n` objects from `src` into the uninitialized storage at `dst` and ends the lifetime
+// of the sources. Returns the end of the destination range.
+template <typename T>
+T* RelocateN(T* src, std::size_t n, T* dst) noexcept(RelocationTraits<T>::trivially_relocatable ||
+                                                      std::is_nothrow_move_constructible_v<T>) {
+    if constexpr (RelocationTraits<T>::trivially_relocatable) {
+        if (n != 0) {
+            std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+        }
+        return dst + n;
+    } else {
+        for (std::size_t i = 0; i < n; ++i) {
+            std::construct_at(dst + i, std::move(src[i]));
+            std::destroy_at(src + i);
+        }
+        return dst + n;
+    }
+}
+
+}  // namespace eav
@@ -0,0 +1,9 @@
+#pragma once
+
+// Traverse/Collect over ranges (sequential or on a thread pool); kept out of Result.hpp and
+// Option.hpp because it pulls in <thread> and <mutex>
+#include "Exec/ParallelFor.hpp"
+#include "Exec/Policy.hpp"
+#include "Exec/ThreadPool.hpp"
+#include "Option/Combinators/Traverse.hpp"
+#include "Result/Combinators/Traverse.hpp"
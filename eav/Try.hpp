@@ -0,0 +1,105 @@
+#pragma once
+
+#include <concepts>
+#include <utility>  // std::move
+
+#include "Detail/Compiler.hpp"
+#include "Option.hpp"
+#include "Result.hpp"
+
+// Early return of an error from the middle of a function (Rust's `?`):
+//
+//     Result<Config, ParseError> Load(std::string_view path) {
+//         auto text = EAV_TRY(ReadFile(path));  // Err => `return make::Err(err);` from Load
+//         auto json = EAV_TRY(Parse(text));
+//         return make::Ok(Config(std::move(json)));
+//     }
+//
+// EAV_TRY(res) evaluates `res` (a Result; an lvalue is copied) once, tests its tag once and
+// either returns its error from the enclosing function - moved into that function's
+// Result<U, R>, R constructible from E - or evaluates to its Ok value, moved out (a void
+// expression for a Result<void, E>). Nothing is checked twice and no panic path is left behind.
+// EAV_TRY_OPT(opt) does the same for Option, returning `make::None()`.
+//
+// These are GNU statement expressions (GCC, Clang). Elsewhere only the statement forms exist,
+// which work everywhere and declare the variable themselves:
+//
+//     EAV_TRY_ASSIGN(auto text, ReadFile(path));
+//     EAV_TRY_OPT_ASSIGN(const int port, FindPort(cfg));
+//
+// The enclosing function needs a declared (not deduced) return type. Neither form can be used
+// inside a coroutine (co_await the Result instead, see eav/Coro.hpp).
+
+namespace eav::detail {
+
+// The payload of a Result/Option local to the expansion; precondition: the tag was tested
+template <typename T, typename E>
+constexpr T&& TryTake(Result<T, E>& res) noexcept {
+    return Access<Result<T, E>>::TakeOk(std::move(res));
+}
+
+// Nothing to take: EAV_TRY(validate()) on a Result<void, E> is a void expression
+template <typename E>
+constexpr void TryTake(Result<void, E>&) noexcept {}
+
+template <typename T>
+constexpr T&& TryTake(Option<T>& opt) noexcept {
+    return Access<Option<T>>::Take(std::move(opt));
+}
+
+// The error of a failed Result, moved straight into the enclosing function's Result<U, R>
+// (R constructible from E) when the return statement converts it
+template <typename E>
+class TryError {
+  private:  // data members:
+    E& err_;  // in the Result local to the expansion, alive until the return completes
+
+  public:  // member functions:
+    explicit constexpr TryError(E& err) noexcept : err_(err) {}
+
+    template <typename U, typename R> requires(std::constructible_from<R, E &&>)
+    constexpr operator Result<U, R>() && {
+        return Access<Result<U, R>>::Err(std::move(err_));
+    }
+};
+
+template <typename T, typename E>
+constexpr TryError<E> TryErr(Result<T, E>& res) noexcept {
+    return TryError<E>(res.unwrap_err_unchecked());
+}
+
+}  // namespace eav::detail
+
+#define EAV_TRY_ASSIGN(lhs, ...)                                        \
+    auto EAV_CONCAT(eav_try_res_, __LINE__) = (__VA_ARGS__);            \
+    if (EAV_CONCAT(eav_try_res_, __LINE__).is_err()) [[unlikely]] {     \
+        return ::eav::detail::TryErr(EAV_CONCAT(eav_try_res_, __LINE__)); \
+    }                                                                   \
+    lhs = ::eav::detail::TryTake(EAV_CONCAT(eav_try_res_, __LINE__))
+
+#define EAV_TRY_OPT_ASSIGN(lhs, ...)                                     \
+    auto EAV_CONCAT(eav_try_opt_, __LINE__) = (__VA_ARGS__);             \
+    if (!EAV_CONCAT(eav_try_opt_, __LINE__).has_value()) [[unlikely]] {  \
+        return ::eav::make::None();                                      \
+    }                                                                    \
+    lhs = ::eav::detail::TryTake(EAV_CONCAT(eav_try_opt_, __LINE__))
+
+#if EAV_HAS_STATEMENT_EXPRESSIONS
+#    define EAV_TRY(...)                                         \
+        __extension__({                                          \
+            auto eav_try_res_ = (__VA_ARGS__);                   \
+            if (eav_try_res_.is_err()) [[unlikely]] {            \
+                return ::eav::detail::TryErr(eav_try_res_);      \
+            }                                                    \
+            ::eav::detail::TryTake(eav_try_res_);                \
+        })
+
+#    define EAV_TRY_OPT(...)                                     \
+        __extension__({                                          \
+            auto eav_try_opt_ = (__VA_ARGS__);                   \
+            if (!eav_try_opt_.has_value()) [[unlikely]] {        \
+                return ::eav::make::None();                      \
+            }                                                    \
+            ::eav::detail::TryTake(eav_try_opt_);                \
+        })
+#endif
@@ -0,0 +1,95 @@
+// `import eav;`: Result, Option, their combinators, ErrorCode, ErrorUnion and the adapters,
+// parsed once when the module is built instead of in every translation unit (CMake option
+// EAV_BUILD_MODULE).
+// The configuration macros (EAV_PANIC_POLICY, EAV_INSTRUMENT) are fixed when the module is built,
+// and macros are not exported: EAV_TRY and the other headers (Traverse, Context, Coro, Batch,
+// Instrument, Traced) are still used with #include.
+module;
+
+#include <eav/Adapters.hpp>
+#include <eav/Concepts/TriviallyRelocatable.hpp>
+#include <eav/ErrorCode.hpp>
+#include <eav/Option.hpp>
+#include <eav/Result.hpp>
+
+export module eav;
+
+export namespace eav {
+
+using eav::Option;
+using eav::Result;
+
+using eav::operator|;
+
+using eav::BranchHint;
+using eav::PanicHandler;
+using eav::SetPanicHandler;
+
+using eav::ErrorCategory;
+using eav::ErrorCategoryTraits;
+using eav::ErrorCode;
+using eav::ErrorUnion;
+using eav::FlatErrorUnion;
+using eav::ContextualError;
+using eav::IntoErrorCode;
+
+using eav::NicheTraits;
+using eav::RelocationTraits;
+using eav::ReservedValueNiche;
+
+}  // namespace eav
+
+export namespace eav::concepts {
+
+using eav::concepts::HasInvalidNiche;
+using eav::concepts::HasNiche;
+using eav::concepts::IsError;
+using eav::concepts::IsErrorEnum;
+using eav::concepts::IsErrorUnion;
+using eav::concepts::IsResult;
+using eav::concepts::PipeableWith;
+using eav::concepts::TriviallyRelocatable;
+
+}  // namespace eav::concepts
+
+export namespace eav::make {
+
+using eav::make::Err;
+using eav::make::None;
+using eav::make::Ok;
+using eav::make::OkRef;
+using eav::make::Some;
+using eav::make::SomeRef;
+
+}  // namespace eav::make
+
+export namespace eav::combine::result {
+
+using eav::combine::result::AndThen;
+using eav::combine::result::Filter;
+using eav::combine::result::MapErr;
+using eav::combine::result::MapOk;
+using eav::combine::result::Match;
+using eav::combine::result::OrElse;
+
+}  // namespace eav::combine::result
+
+export namespace eav::combine::option {
+
+using eav::combine::option::AndThen;
+using eav::combine::option::Filter;
+using eav::combine::option::Map;
+using eav::combine::option::OrElse;
+
+}  // namespace eav::combine::option
+
+export namespace eav::adapt {
+
+using eav::adapt::At;
+using eav::adapt::FindIf;
+using eav::adapt::Get;
+using eav::adapt::Parse;
+using eav::adapt::ParseError;
+using eav::adapt::RefRange;
+
+}  // namespace eav::adapt
@@ -0,0 +1,8 @@
+// The common specializations declared `extern template` by eav/Extern.hpp (EAV_EXTERN_TEMPLATES=1)
+#include <eav/Extern.hpp>
+
+#define EAV_DETAIL_INSTANTIATE_RESULT(T, E) EAV_INSTANTIATE_RESULT(T, E);
+#define EAV_DETAIL_INSTANTIATE_OPTION(T) EAV_INSTANTIATE_OPTION(T);
+
+EAV_COMMON_RESULTS(EAV_DETAIL_INSTANTIATE_RESULT)
+EAV_COMMON_OPTIONS(EAV_DETAIL_INSTANTIATE_OPTION)
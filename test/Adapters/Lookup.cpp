@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <eav/Adapters.hpp>
+
+using namespace eav;
+
+// Lookups hand out the element they find, by reference
+
+namespace {
+
+struct Heavy {
+    static inline int copies = 0;
+
+    std::string name;
+
+    explicit Heavy(std::string n) : name(std::move(n)) {}
+
+    Heavy(const Heavy& oth) : name(oth.name) {
+        ++copies;
+    }
+
+    Heavy(Heavy&&) noexcept = default;
+};
+
+template <typename R>
+concept CanAt = requires(R&& range) { adapt::At(std::forward<R>(range), 0); };
+
+}  // namespace
+
+// temporaries would dangle:
+static_assert(CanAt<std::vector<int>&>);
+static_assert(CanAt<std::span<int>>);
+static_assert(!CanAt<std::vector<int>>);
+static_assert(!CanAt<std::vector<bool>&>);  // no references to the elements
+
+// clang-format off
+TEST(AdaptersLookupTest, GetFromMaps) {
+    std::unordered_map<int, Heavy> table;
+    table.emplace(1, Heavy("one"));
+    Heavy::copies = 0;
+
+    auto found = adapt::Get(table, 1);
+    static_assert(std::same_as<decltype(found), Option<Heavy&>>);
+    EXPECT_EQ(found.ptr(), &table.at(1));
+    EXPECT_FALSE(adapt::Get(table, 2).has_value());
+
+    adapt::Get(table, 1).unwrap().name = "uno";
+    EXPECT_EQ(table.at(1).name, "uno");
+
+    const auto& view = table;
+    static_assert(std::same_as<decltype(adapt::Get(view, 1)), Option<const Heavy&>>);
+    EXPECT_EQ(Heavy::copies, 0);
+
+    // heterogeneous lookup: no std::string is built for the key
+    std::map<std::string, int, std::less<>> ordered{{"a", 1}};
+    EXPECT_EQ(adapt::Get(ordered, std::string_view("a")).unwrap(), 1);
+}
+
+TEST(AdaptersLookupTest, GetInPipeline) {
+    std::unordered_map<std::string, Heavy> users;
+    users.emplace("root", Heavy("Root"));
+    Heavy::copies = 0;
+
+    auto len = adapt::Get(users, std::string("root"))
+        | combine::option::Map([](const Heavy& user) { return user.name.size(); });
+    EXPECT_EQ(len.unwrap(), 4u);
+    EXPECT_EQ(Heavy::copies, 0);
+}
+
+TEST(AdaptersLookupTest, At) {
+    std::vector<int> values{1, 2, 3};
+    EXPECT_EQ(adapt::At(values, 0).ptr(), &values[0]);
+    EXPECT_EQ(adapt::At(std::span<const int>(values), 2).unwrap(), 3);
+    EXPECT_FALSE(adapt::At(values, 3).has_value());
+
+    adapt::At(values, 1).unwrap() = 20;
+    EXPECT_EQ(values[1], 20);
+
+    int raw[] = {4, 5};
+    EXPECT_EQ(adapt::At(raw, 1).unwrap(), 5);
+}
+
+TEST(AdaptersLookupTest, FindIf) {
+    std::vector<Heavy> items;
+    items.emplace_back("a");
+    items.emplace_back("bb");
+    Heavy::copies = 0;
+
+    auto long_name = adapt::FindIf(items, [](const std::string& n) { return n.size() > 1; }, &Heavy::name);
+    EXPECT_EQ(long_name.ptr(), &items[1]);
+    EXPECT_FALSE(adapt::FindIf(items, [](const Heavy& h) { return h.name.empty(); }).has_value());
+    EXPECT_EQ(Heavy::copies, 0);
+}
+// clang-format on
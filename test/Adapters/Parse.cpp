@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#include <eav/Adapters.hpp>
+#include <eav/ErrorCode.hpp>
+
+using namespace eav;
+
+static_assert(sizeof(adapt::ParseError) == 1);
+static_assert(sizeof(Result<int, adapt::ParseError>) == 2 * sizeof(int));
+
+TEST(AdaptersParseTest, Integers) {
+    EXPECT_EQ(adapt::Parse<int>("42").unwrap_ok(), 42);
+    EXPECT_EQ(adapt::Parse<int>("-7").unwrap_ok(), -7);
+    EXPECT_EQ(adapt::Parse<std::uint64_t>("18446744073709551615").unwrap_ok(),
+              std::numeric_limits<std::uint64_t>::max());
+    EXPECT_EQ(adapt::Parse<int>("ff", 16).unwrap_ok(), 255);
+}
+
+TEST(AdaptersParseTest, Errors) {
+    EXPECT_EQ(adapt::Parse<int>("").unwrap_err(), adapt::ParseError::kInvalidArgument);
+    EXPECT_EQ(adapt::Parse<int>(" 1").unwrap_err(), adapt::ParseError::kInvalidArgument);
+    EXPECT_EQ(adapt::Parse<unsigned>("-1").unwrap_err(), adapt::ParseError::kInvalidArgument);
+    EXPECT_EQ(adapt::Parse<std::uint8_t>("256").unwrap_err(), adapt::ParseError::kOutOfRange);
+    EXPECT_EQ(adapt::Parse<int>("12ab").unwrap_err(), adapt::ParseError::kTrailingCharacters);
+    EXPECT_EQ(adapt::Parse<int>("1.5").unwrap_err(), adapt::ParseError::kTrailingCharacters);
+}
+
+TEST(AdaptersParseTest, FloatingPoint) {
+    EXPECT_EQ(adapt::Parse<double>("2.5").unwrap_ok(), 2.5);
+    EXPECT_EQ(adapt::Parse<float>("1e3").unwrap_ok(), 1000.0f);
+    EXPECT_EQ(adapt::Parse<double>("1e3", std::chars_format::fixed).unwrap_err(),
+              adapt::ParseError::kTrailingCharacters);
+    EXPECT_EQ(adapt::Parse<double>("1e999").unwrap_err(), adapt::ParseError::kOutOfRange);
+}
+
+TEST(AdaptersParseTest, IntoErrorCode) {
+    auto res = adapt::Parse<int>("x") | combine::result::MapErr(IntoErrorCode{});
+    EXPECT_EQ(res.unwrap_err(), adapt::ParseError::kInvalidArgument);
+    EXPECT_EQ(res.unwrap_err().to_string(), "parse: invalid argument");
+}
+
+TEST(AdaptersParseTest, InPipeline) {
+    const auto port = combine::result::Filter([](int p) { return p > 0 && p < 65536; },
+                                              adapt::ParseError::kOutOfRange)
+        | combine::result::MapOk([](int p) { return static_cast<std::uint16_t>(p); });
+
+    EXPECT_EQ((adapt::Parse<int>("8080") | port).unwrap_ok(), 8080);
+    EXPECT_EQ((adapt::Parse<int>("70000") | port).unwrap_err(), adapt::ParseError::kOutOfRange);
+    EXPECT_EQ((adapt::Parse<int>("http") | port).unwrap_err(), adapt::ParseError::kInvalidArgument);
+}
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <eav/Async.hpp>
+
+using namespace eav;
+
+namespace {
+
+enum class Errc : unsigned char { kNotFound, kBad };
+
+Result<int, Errc> Parse(const std::string& s) {
+    if (s.empty()) {
+        return make::Err(Errc::kBad);
+    }
+    return make::Ok(static_cast<int>(s.size()));
+}
+
+}  // namespace
+
+TEST(AsyncResultTest, LazyUntilStarted) {
+    exec::ThreadPool pool(2);
+    std::atomic<int> calls{0};
+
+    auto chain = async::Spawn(pool, [&]() -> Result<int, Errc> {
+        calls.fetch_add(1);
+        return make::Ok(20);
+    }) | combine::result::MapOk([](int v) { return v + 1; });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(calls.load(), 0);  // nothing is scheduled before start()
+
+    auto pending = std::move(chain).start();
+    EXPECT_EQ(std::move(pending).get().unwrap_ok(), 21);
+    EXPECT_EQ(calls.load(), 1);
+}
+
+TEST(AsyncResultTest, Combinators) {
+    exec::ThreadPool pool(2);
+
+    auto res = async::Spawn(pool, [] { return Parse("abc"); })
+        | combine::result::AndThen([](int v) -> Result<int, Errc> {
+              if (v > 5) {
+                  return make::Err(Errc::kBad);
+              }
+              return make::Ok(v * 10);
+          })
+        | combine::result::MapOk([](int v) { return std::to_string(v); });
+    static_assert(std::is_same_v<decltype(res)::ResultType, Result<std::string, Errc>>);
+    EXPECT_EQ(std::move(res).get().unwrap_ok(), "30");
+
+    auto recovered = async::Spawn(pool, [] { return Parse(""); })
+        | combine::result::OrElse([](Errc) -> Result<int, Errc> { return make::Ok(-1); });
+    EXPECT_EQ(std::move(recovered).get().unwrap_ok(), -1);
+
+    auto failed = async::Spawn(pool, [] { return Parse(""); }) | combine::result::MapOk([](int v) { return v; });
+    EXPECT_EQ(std::move(failed).get().unwrap_err(), Errc::kBad);
+}
+
+TEST(AsyncResultTest, ReusesLazyPipelines) {
+    const auto pipeline = combine::result::MapOk([](int v) { return v * 2; })
+        | combine::result::Filter([](int v) { return v < 100; }, Errc::kBad);
+
+    exec::ThreadPool pool(2);
+    EXPECT_EQ((async::Spawn(pool, [] { return Parse("xx"); }) | pipeline).get().unwrap_ok(), 4);
+    EXPECT_EQ((async::Ready(Parse(std::string(60, 'x'))) | pipeline).get().unwrap_err(), Errc::kBad);
+}
+
+TEST(AsyncResultTest, ContinuesAStartedResult) {
+    exec::ThreadPool pool(2);
+    std::atomic<bool> release{false};
+
+    auto first = async::Spawn(pool, [&]() -> Result<int, Errc> {
+        while (!release.load()) {
+            std::this_thread::yield();
+        }
+        return make::Ok(1);
+    }).start();
+    EXPECT_FALSE(first.is_ready());
+
+    // Subscribed before the value is there: the continuation runs on the producing thread
+    auto second = (std::move(first) | combine::result::MapOk([](int v) { return v + 1; })).start();
+    release = true;
+    EXPECT_EQ(std::move(second).get().unwrap_ok(), 2);
+
+    // Subscribed after: it runs inside start()
+    auto done = async::Ready(Parse("abcd")).start();
+    EXPECT_TRUE(done.is_ready());
+    auto next = (std::move(done) | combine::result::MapOk([](int v) { return v * 3; })).start();
+    EXPECT_TRUE(next.is_ready());
+    EXPECT_EQ(std::move(next).get().unwrap_ok(), 12);
+}
+
+TEST(AsyncResultTest, InlineExecutor) {
+    auto pending = async::Spawn(exec::inline_executor, [] { return Parse("a"); }).start();
+    EXPECT_TRUE(pending.is_ready());
+    EXPECT_EQ(std::move(pending).get().unwrap_ok(), 1);
+}
+
+TEST(AsyncResultTest, MoveOnlyValues) {
+    exec::ThreadPool pool(1);
+    auto res = async::Spawn(pool, []() -> Result<std::unique_ptr<int>, Errc> { return make::Ok(std::make_unique<int>(7)); })
+        | combine::result::MapOk([](std::unique_ptr<int>&& p) { return *p; });
+    EXPECT_EQ(std::move(res).get().unwrap_ok(), 7);
+}
+
+TEST(AsyncResultTest, DetachedChainsComplete) {
+    std::atomic<int> done{0};
+    {
+        exec::ThreadPool pool(4);
+        for (int i = 0; i < 100; ++i) {
+            // The handle is dropped at once: the chain still runs, and frees itself
+            static_cast<void>((async::Spawn(pool, [&]() -> Result<int, Errc> { return make::Ok(1); })
+                | combine::result::MapOk([&](int v) {
+                      done.fetch_add(v);
+                      return v;
+                  })).start());
+        }
+    }
+    EXPECT_EQ(done.load(), 100);
+}
+
+TEST(AsyncResultTest, ManyConcurrentChains) {
+    exec::ThreadPool pool(4);
+    std::vector<AsyncResult<int, Errc>> pending;
+    for (int i = 0; i < 1000; ++i) {
+        pending.push_back((async::Spawn(pool, [i]() -> Result<int, Errc> { return make::Ok(i); })
+            | combine::result::MapOk([](int v) { return v * 2; })).start());
+    }
+    long sum = 0;
+    for (auto& p : pending) {
+        sum += std::move(p).get().unwrap_ok();
+    }
+    EXPECT_EQ(sum, 999L * 1000L);
+}
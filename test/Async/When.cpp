@@ -0,0 +1,220 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <tuple>
+
+#include <eav/Async.hpp>
+
+using namespace eav;
+
+namespace {
+
+enum class Errc : unsigned char { kTimeout, kMiss };
+
+}  // namespace
+
+TEST(WhenAllTest, AllOk) {
+    exec::ThreadPool pool(2);
+    auto res = combine::result::WhenAll(
+        pool,
+        []() -> Result<int, Errc> { return make::Ok(1); },
+        []() -> Result<std::string, Errc> { return make::Ok(std::string("two")); },
+        []() -> Result<double, Errc> { return make::Ok(3.0); });
+    static_assert(std::is_same_v<decltype(res), Result<std::tuple<int, std::string, double>, Errc>>);
+    EXPECT_EQ(res.unwrap_ok(), std::make_tuple(1, std::string("two"), 3.0));
+}
+
+TEST(WhenAllTest, FirstErrorCancelsTheRest) {
+    exec::ThreadPool pool(1);
+    std::atomic<bool> release{false};
+    std::atomic<int> started{0};
+    std::atomic<bool> saw_stop{false};
+
+    // The pool's only thread is kept busy, so inputs 1 and 2 are still queued when input 3
+    // (run by the caller) fails: they are skipped
+    pool.Submit([&] {
+        while (!release.load()) {
+            std::this_thread::yield();
+        }
+    });
+    auto slow = [&](exec::StopToken token) -> Result<int, Errc> {
+        started.fetch_add(1);
+        saw_stop = saw_stop || token.stop_requested();
+        return make::Ok(1);
+    };
+    std::thread unblock([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        release = true;
+    });
+    auto res = combine::result::WhenAll(pool, slow, slow, []() -> Result<int, Errc> { return make::Err(Errc::kMiss); });
+    unblock.join();
+
+    EXPECT_EQ(res.unwrap_err(), Errc::kMiss);
+    EXPECT_EQ(started.load(), 0);
+    EXPECT_FALSE(saw_stop.load());
+}
+
+TEST(WhenAllTest, RunningInputsSeeTheStopRequest) {
+    exec::ThreadPool pool(1);
+    std::atomic<bool> running{false};
+    std::atomic<bool> stopped_early{false};
+
+    auto res = combine::result::WhenAll(
+        pool,
+        [&](exec::StopToken token) -> Result<int, Errc> {
+            running = true;
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (std::chrono::steady_clock::now() < deadline) {
+                if (token.stop_requested()) {
+                    stopped_early = true;
+                    return make::Err(Errc::kTimeout);
+                }
+                std::this_thread::yield();
+            }
+            return make::Ok(0);
+        },
+        [&]() -> Result<int, Errc> {
+            while (!running.load()) {
+                std::this_thread::yield();
+            }
+            return make::Err(Errc::kMiss);
+        });
+    EXPECT_EQ(res.unwrap_err(), Errc::kMiss);
+    EXPECT_TRUE(stopped_early.load());
+}
+
+TEST(WhenAnyTest, FirstOkWins) {
+    exec::ThreadPool pool(2);
+    auto res = combine::result::WhenAny(
+        pool,
+        [](exec::StopToken token) -> Result<int, Errc> {
+            while (!token.stop_requested()) {
+                std::this_thread::yield();
+            }
+            return make::Err(Errc::kTimeout);
+        },
+        []() -> Result<int, Errc> { return make::Err(Errc::kMiss); },
+        []() -> Result<int, Errc> { return make::Ok(42); });
+    EXPECT_EQ(res.unwrap_ok(), 42);
+}
+
+TEST(WhenAnyTest, AllFail) {
+    exec::ThreadPool pool(2);
+    auto res = combine::result::WhenAny(
+        pool,
+        []() -> Result<int, Errc> { return make::Err(Errc::kMiss); },
+        []() -> Result<int, Errc> { return make::Err(Errc::kMiss); });
+    EXPECT_EQ(res.unwrap_err(), Errc::kMiss);
+}
+
+TEST(WhenAnyTest, InlineExecutorRunsInOrder) {
+    int calls = 0;
+    auto res = combine::result::WhenAny(
+        exec::inline_executor,
+        [&]() -> Result<int, Errc> { ++calls; return make::Ok(1); },
+        [&]() -> Result<int, Errc> { ++calls; return make::Ok(2); });
+    EXPECT_EQ(res.unwrap_ok(), 1);
+    EXPECT_EQ(calls, 1);  // decided by the first one: the second is skipped
+}
+
+TEST(WhenAllTest, Repeated) {
+    exec::ThreadPool pool(4);
+    for (int i = 0; i < 2000; ++i) {
+        auto res = combine::result::WhenAll(
+            pool,
+            [i]() -> Result<int, Errc> { return make::Ok(i); },
+            [i]() -> Result<int, Errc> { return make::Ok(i + 1); },
+            [i]() -> Result<int, Errc> {
+                if (i % 3 == 0) {
+                    return make::Err(Errc::kMiss);
+                }
+                return make::Ok(i + 2);
+            });
+        if (i % 3 == 0) {
+            EXPECT_EQ(res.unwrap_err(), Errc::kMiss);
+        } else {
+            EXPECT_EQ(std::get<2>(res.unwrap_ok()), i + 2);
+        }
+    }
+}
+
+TEST(WhenAllTest, NestedInAWorkerOfTheSamePool) {
+    // The only worker runs the outer task: the inner inputs cannot be posted behind it, they run
+    // in place (a pool of one thread would otherwise never finish)
+    exec::ThreadPool pool(1);
+    std::atomic<bool> done{false};
+    Result<std::tuple<int, int>, Errc> all = make::Err(Errc::kTimeout);
+    Result<int, Errc> any = make::Err(Errc::kTimeout);
+    std::thread::id outer;
+    std::atomic<int> elsewhere{0};
+    pool.Submit([&] {
+        outer = std::this_thread::get_id();
+        auto on_this_thread = [&](int v) {
+            return [&, v]() -> Result<int, Errc> {
+                if (std::this_thread::get_id() != outer) {
+                    elsewhere.fetch_add(1);
+                }
+                return make::Ok(int{v});
+            };
+        };
+        all = combine::result::WhenAll(pool, on_this_thread(1), on_this_thread(2));
+        any = combine::result::WhenAny(pool, []() -> Result<int, Errc> { return make::Err(Errc::kMiss); },
+                                       on_this_thread(3));
+        done = true;
+    });
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!done.load() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_TRUE(done.load());
+    EXPECT_EQ(all.unwrap_ok(), std::make_tuple(1, 2));
+    EXPECT_EQ(any.unwrap_ok(), 3);
+    EXPECT_EQ(elsewhere.load(), 0);
+}
+
+TEST(WhenAllTest, WorkerOfAnotherPoolStillPosts) {
+    exec::ThreadPool outer(1);
+    exec::ThreadPool inner(1);
+    std::atomic<bool> done{false};
+    std::atomic<bool> posted{false};
+    outer.Submit([&] {
+        const auto caller = std::this_thread::get_id();
+        auto res = combine::result::WhenAll(
+            inner,
+            [&]() -> Result<int, Errc> {
+                posted = std::this_thread::get_id() != caller;
+                return make::Ok(1);
+            },
+            []() -> Result<int, Errc> { return make::Ok(2); });
+        EXPECT_TRUE(res.is_ok());
+        done = true;
+    });
+    while (!done.load()) {
+        std::this_thread::yield();
+    }
+    EXPECT_TRUE(posted.load());
+}
+
+TEST(WhenAllTest, ManyTinyGroups) {
+    // Each group lives in the frame of one call and the inputs do next to nothing, so the last
+    // input often counts down just as the caller is about to return: under TSan/ASan this checks
+    // that nothing touches the latch once the caller may have left
+    exec::ThreadPool pool(4);
+    long sum = 0;
+    for (int i = 0; i < 20000; ++i) {
+        auto all = combine::result::WhenAll(
+            pool,
+            [i]() -> Result<int, Errc> { return make::Ok(int{i}); },
+            []() -> Result<int, Errc> { return make::Ok(1); });
+        auto any = combine::result::WhenAny(
+            pool,
+            []() -> Result<int, Errc> { return make::Err(Errc::kMiss); },
+            [i]() -> Result<int, Errc> { return make::Ok(int{i}); });
+        sum += std::get<0>(all.unwrap_ok()) - any.unwrap_ok() + std::get<1>(all.unwrap_ok());
+    }
+    EXPECT_EQ(sum, 20000);
+}
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+#include <eav/Batch/Detail/Bitmap.hpp>
+
+using eav::detail::Bitmap;
+
+namespace {
+
+std::vector<std::size_t> SetBits(const Bitmap& bits) {
+    std::vector<std::size_t> out;
+    bits.ForEachSet([&](std::size_t i) { out.push_back(i); });
+    return out;
+}
+
+std::vector<std::size_t> ClearBits(const Bitmap& bits) {
+    std::vector<std::size_t> out;
+    bits.ForEachClear([&](std::size_t i) { out.push_back(i); });
+    return out;
+}
+
+}  // namespace
+
+TEST(BitmapTest, PushAndTest) {
+    Bitmap bits;
+    for (std::size_t i = 0; i < 130; ++i) {
+        bits.push_back(i % 3 == 0);
+    }
+    EXPECT_EQ(bits.size(), 130u);
+    EXPECT_EQ(bits.count(), 44u);
+    EXPECT_TRUE(bits.test(129));
+    EXPECT_FALSE(bits.test(128));
+
+    bits.reset(129);
+    bits.set(128);
+    EXPECT_FALSE(bits.test(129));
+    EXPECT_TRUE(bits.test(128));
+}
+
+TEST(BitmapTest, FullWordsAndTail) {
+    // Two full words (dense loop) and a 6-bit tail: no row past size() is visited
+    const Bitmap all(134, true);
+    EXPECT_EQ(all.count(), 134u);
+    EXPECT_EQ(SetBits(all).size(), 134u);
+    EXPECT_EQ(SetBits(all).back(), 133u);
+    EXPECT_TRUE(ClearBits(all).empty());
+
+    const Bitmap none(134, false);
+    EXPECT_TRUE(SetBits(none).empty());
+    EXPECT_EQ(ClearBits(none).size(), 134u);
+    EXPECT_EQ(ClearBits(none).back(), 133u);
+}
+
+TEST(BitmapTest, MixedWord) {
+    Bitmap bits(70);
+    bits.set(1);
+    bits.set(63);
+    bits.set(64);
+    bits.set(69);
+    EXPECT_EQ(SetBits(bits), (std::vector<std::size_t>{1, 63, 64, 69}));
+    EXPECT_EQ(ClearBits(bits).size(), 66u);
+}
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <eav/OptionVector.hpp>
+
+using namespace eav;
+
+namespace {
+
+// Row i: Some(i) unless i is a multiple of 3
+OptionVector<int> Rows(int n) {
+    OptionVector<int> vec;
+    for (int i = 0; i < n; ++i) {
+        if (i % 3 == 0) {
+            vec.push_none();
+        } else {
+            vec.push_some(i);
+        }
+    }
+    return vec;
+}
+
+}  // namespace
+
+TEST(OptionVectorTest, RoundTrip) {
+    std::vector<Option<std::string>> rows;
+    rows.push_back(make::Some(std::string("a")));
+    rows.push_back(make::None());
+
+    OptionVector<std::string> vec(std::move(rows));
+    EXPECT_EQ(vec.size(), 2u);
+    EXPECT_EQ(vec.some_count(), 1u);
+    EXPECT_EQ(vec.values()[0], "a");
+
+    auto back = std::move(vec).to_vector();
+    EXPECT_EQ(back[0].unwrap(), "a");
+    EXPECT_FALSE(back[1].has_value());
+}
+
+// clang-format off
+TEST(OptionVectorTest, MapFilterAndThen) {
+    auto out = Rows(200)
+        | combine::option::Map([](int x) { return x * 2; })
+        | combine::option::Filter([](int x) { return x % 4 != 0; })
+        | combine::option::AndThen([](int x) -> Option<std::string> {
+              if (x > 300) return make::None();
+              return make::Some(std::to_string(x));
+          });
+
+    // odd i, not a multiple of 3, i <= 150
+    EXPECT_EQ(out.some_count(), 50u);
+    EXPECT_EQ(out[1].unwrap(), "2");
+    EXPECT_FALSE(out[2].has_value());
+    EXPECT_FALSE(out[151].has_value());
+}
+
+TEST(OptionVectorTest, Pipeline) {
+    const auto pipeline = combine::option::Map([](int x) { return x + 1; })
+        | combine::option::Filter([](int x) { return x % 2 == 0; });
+
+    auto out = Rows(100) | pipeline;
+    const auto in = Rows(100);
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        auto expected = in[i] | pipeline;
+        ASSERT_EQ(out.has_value(i), expected.has_value()) << i;
+        if (expected.has_value()) {
+            EXPECT_EQ(out[i].unwrap(), expected.unwrap());
+        }
+    }
+}
+// clang-format on
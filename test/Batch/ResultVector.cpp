@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <eav/ResultVector.hpp>
+
+using namespace eav;
+
+namespace {
+
+// Row i: Ok(i) unless i is a multiple of 3, then Err("e<i>")
+ResultVector<int, std::string> Rows(int n) {
+    ResultVector<int, std::string> vec;
+    vec.reserve(static_cast<std::size_t>(n));
+    for (int i = 0; i < n; ++i) {
+        if (i % 3 == 0) {
+            vec.push_err("e" + std::to_string(i));
+        } else {
+            vec.push_ok(i);
+        }
+    }
+    return vec;
+}
+
+}  // namespace
+
+TEST(ResultVectorTest, Layout) {
+    auto vec = Rows(10);
+    EXPECT_EQ(vec.size(), 10u);
+    EXPECT_EQ(vec.ok_count(), 6u);
+    EXPECT_TRUE(vec.is_err(0));
+    EXPECT_TRUE(vec.is_ok(1));
+    EXPECT_EQ(vec.ok_column()[4], 4);
+    EXPECT_EQ(vec.err_column()[9], "e9");
+    EXPECT_EQ(vec[2].unwrap_ok(), 2);
+    EXPECT_EQ(vec[3].unwrap_err(), "e3");
+}
+
+TEST(ResultVectorTest, RoundTrip) {
+    std::vector<Result<int, std::string>> rows;
+    rows.push_back(make::Ok<int, std::string>(std::in_place, 1));
+    rows.push_back(make::Err<std::string, int>(std::in_place, "bad"));
+    rows.push_back(make::Ok<int, std::string>(std::in_place, 3));
+
+    ResultVector<int, std::string> vec(std::move(rows));
+    EXPECT_EQ(vec.ok_count(), 2u);
+
+    const auto copy = vec.to_vector();
+    auto moved = std::move(vec).to_vector();
+    ASSERT_EQ(moved.size(), 3u);
+    EXPECT_EQ(copy[0].unwrap_ok(), 1);
+    EXPECT_EQ(moved[1].unwrap_err(), "bad");
+    EXPECT_EQ(moved[2].unwrap_ok(), 3);
+}
+
+// clang-format off
+TEST(ResultVectorTest, MapOk) {
+    auto out = Rows(200)
+        | combine::result::MapOk([](int x) { return x * 0.5; });
+
+    static_assert(std::same_as<decltype(out), ResultVector<double, std::string>>);
+    EXPECT_EQ(out.ok_count(), 133u);
+    EXPECT_DOUBLE_EQ(out[199].unwrap_ok(), 99.5);
+    EXPECT_EQ(out[198].unwrap_err(), "e198");
+}
+
+TEST(ResultVectorTest, MapErr) {
+    auto out = Rows(10)
+        | combine::result::MapErr([](std::string e) { return e.size(); });
+
+    EXPECT_EQ(out[0].unwrap_err(), 2u);
+    EXPECT_EQ(out[1].unwrap_ok(), 1);
+}
+
+TEST(ResultVectorTest, Filter) {
+    auto out = Rows(10)
+        | combine::result::Filter([](int x) { return x % 2 == 0; }, std::string("odd"));
+
+    EXPECT_EQ(out.ok_count(), 3u);  // 2, 4, 8
+    EXPECT_EQ(out[1].unwrap_err(), "odd");
+    EXPECT_EQ(out[3].unwrap_err(), "e3");
+    EXPECT_EQ(out[8].unwrap_ok(), 8);
+}
+
+TEST(ResultVectorTest, FilterSameAsPerRow) {
+    auto rows = Rows(100).to_vector();
+    auto out = Rows(100) | combine::result::Filter([](int x) { return x % 2 == 0; }, std::string("odd"));
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        auto expected = std::move(rows[i])
+            | combine::result::Filter([](int x) { return x % 2 == 0; }, std::string("odd"));
+        ASSERT_EQ(out.is_ok(i), expected.is_ok()) << i;
+        if (expected.is_ok()) {
+            EXPECT_EQ(out[i].unwrap_ok(), expected.unwrap_ok());
+        } else {
+            EXPECT_EQ(out[i].unwrap_err(), expected.unwrap_err()) << i;  // "e<i>" rows keep their error
+        }
+    }
+}
+
+TEST(ResultVectorTest, AndThen) {
+    auto out = Rows(10)
+        | combine::result::AndThen([](int x) -> Result<std::string, std::string> {
+              if (x > 5) return make::Err(std::string("big"));
+              return make::Ok(std::to_string(x));
+          });
+
+    EXPECT_EQ(out.ok_count(), 4u);  // 1, 2, 4, 5
+    EXPECT_EQ(out[4].unwrap_ok(), "4");
+    EXPECT_EQ(out[7].unwrap_err(), "big");
+    EXPECT_EQ(out[6].unwrap_err(), "e6");
+}
+
+TEST(ResultVectorTest, Pipeline) {
+    const auto pipeline = combine::result::MapOk([](int x) { return x + 1; })
+        | combine::result::Filter([](int x) { return x % 2 == 0; }, std::string("odd"));
+
+    // Same outcome as the pipeline applied to every row
+    auto rows = Rows(100).to_vector();
+    auto out = Rows(100) | pipeline;
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        auto expected = std::move(rows[i]) | pipeline;
+        ASSERT_EQ(out.is_ok(i), expected.is_ok()) << i;
+        if (expected.is_ok()) {
+            EXPECT_EQ(out[i].unwrap_ok(), expected.unwrap_ok());
+        } else {
+            EXPECT_EQ(out[i].unwrap_err(), expected.unwrap_err());
+        }
+    }
+}
+// clang-format on
+
+TEST(ResultVectorTest, Constexpr) {
+    static_assert([] {
+        ResultVector<int, int> vec;
+        for (int i = 0; i < 100; ++i) {
+            if (i % 2 == 0) vec.push_ok(i);
+            else vec.push_err(i);
+        }
+        auto out = std::move(vec) | combine::result::MapOk([](int x) { return x * 2; });
+        return out.ok_count() == 50 && out[98].unwrap_ok() == 196 && out[99].unwrap_err() == 99;
+    }());
+}
@@ -0,0 +1,37 @@
+// Included first: the core must not depend on what the test framework brings in
+#include <eav/Option/Core.hpp>
+#include <eav/Result/Core.hpp>
+
+#if defined(_GLIBCXX_FUNCTIONAL) || defined(_LIBCPP_FUNCTIONAL)
+#    error "eav/Result/Core.hpp pulls in <functional>"
+#endif
+
+#include <gtest/gtest.h>
+
+#include <functional>
+
+using namespace eav;
+
+// Without the combinators: construction, observers, accessors, conversions
+TEST(BuildCoreTest, WithoutCombinators) {
+    Result<int, char> ok = make::Ok(4);
+    Result<int, char> err = make::Err('x');
+    EXPECT_EQ(ok.unwrap_ok(), 4);
+    EXPECT_EQ(err.unwrap_err(), 'x');
+    EXPECT_EQ(std::move(err).erase_err().unwrap_or(7), 7);
+
+    Option<int> some = make::Some(1);
+    EXPECT_TRUE(some.has_value());
+}
+
+// The reference_wrapper niche does not name std::reference_wrapper (no <functional> in the core)
+TEST(BuildCoreTest, ReferenceWrapperNiche) {
+    static_assert(sizeof(Option<std::reference_wrapper<int>>) == sizeof(int*));
+
+    int value = 3;
+    Option<std::reference_wrapper<int>> ref = make::Some(std::ref(value));
+    EXPECT_EQ(&ref.unwrap().get(), &value);
+
+    Option<std::reference_wrapper<int>> none = make::None();
+    EXPECT_FALSE(none.has_value());
+}
@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <string_view>
+
+#include <eav/Extern.hpp>
+#include <eav/Result.hpp>
+
+using namespace eav;
+
+// The common specializations are declared `extern template` here (EAV_EXTERN_TEMPLATES=1) and
+// instantiated in src/Extern.cpp, linked into this suite
+
+namespace {
+
+enum class IoError { kOk, kClosed };
+
+struct Point {
+    int x;
+    int y;
+};
+
+}  // namespace
+
+template <>
+struct eav::ErrorCategoryTraits<IoError> {
+    static constexpr std::string_view messages[] = {"ok", "closed"};
+    static constexpr ErrorCategory category{"io", messages};
+};
+
+// A project's own specialization, instantiated in this file
+EAV_EXTERN_RESULT(Point, IoError);
+EAV_INSTANTIATE_RESULT(Point, IoError);
+
+Result<int, ErrorCode> Read(bool open) {
+    if (!open) {
+        return make::Err(ErrorCode(IoError::kClosed));
+    }
+    return make::Ok(42);
+}
+
+TEST(BuildExternTest, CommonSpecializations) {
+    EXPECT_EQ(Read(true).unwrap_ok(), 42);
+    EXPECT_EQ(Read(false).unwrap_err(), IoError::kClosed);
+
+    Result<void, ErrorCode> done = make::Ok();
+    EXPECT_TRUE(done.is_ok());
+
+    Result<std::size_t, ErrorCode> size = Read(true) | combine::result::MapOk([](int n) { return std::size_t(n); });
+    Option<std::size_t> some = std::move(size).erase_err();
+    EXPECT_EQ(some.unwrap(), 42u);
+}
+
+TEST(BuildExternTest, ProjectSpecialization) {
+    Result<Point, IoError> res = make::Ok(Point{1, 2});
+    EXPECT_EQ(res.unwrap_ok().y, 2);
+}
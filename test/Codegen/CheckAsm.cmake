@@ -0,0 +1,14 @@
+# cmake -DASM=<file> [-DFORBID=<regex;...>] [-DREQUIRE=<regex;...>] -P CheckAsm.cmake
+file(READ "${ASM}" asm)
+
+foreach (pattern IN LISTS FORBID)
+    if (asm MATCHES "${pattern}")
+        message(FATAL_ERROR "${ASM}: unexpected '${CMAKE_MATCH_0}' (matches '${pattern}')")
+    endif()
+endforeach()
+
+foreach (pattern IN LISTS REQUIRE)
+    if (NOT asm MATCHES "${pattern}")
+        message(FATAL_ERROR "${ASM}: nothing matches '${pattern}'")
+    endif()
+endforeach()
@@ -0,0 +1,21 @@
+// Compiled to assembly only (see CMakeLists.txt): the error path is outlined (a ColdCall
+// instantiation) under BranchHint::kErrorsRare and stays inline under kErrorsCommon
+#include <string>
+
+#include <eav/Result.hpp>
+
+#ifndef EAV_CODEGEN_HINT
+#    define EAV_CODEGEN_HINT kErrorsRare
+#endif
+
+using namespace eav;
+
+constexpr BranchHint kHint = BranchHint::EAV_CODEGEN_HINT;
+
+Result<int, std::string> Source(int x);
+
+Result<int, std::string> Stage(int x) {
+    return Source(x)
+        | combine::result::MapOk<kHint>([](int v) { return v + 1; })
+        | combine::result::MapErr<kHint>([](std::string s) { return s + "!"; });
+}
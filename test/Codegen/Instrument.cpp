@@ -0,0 +1,24 @@
+// Compiled to assembly only (see CMakeLists.txt): instrumentation hooks exist only with EAV_INSTRUMENT
+#include <eav/Result.hpp>
+
+using namespace eav;
+
+struct Error {
+    int code;
+};
+
+Result<int, Error> Source(int x);
+Result<int, Error> Check(int x);
+
+Result<int, Error> FilterThenAndThen(int a) {
+    return Source(a)
+        | combine::result::Filter([](int x) { return x > 0; }, Error{1})
+        | combine::result::AndThen(Check);
+}
+
+Result<int, Error> Recover(int a) {
+    if (a < 0) {
+        return make::Err(Error{a});
+    }
+    return Source(a) | combine::result::OrElse([](Error e) { return Check(e.code); });
+}
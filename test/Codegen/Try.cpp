@@ -0,0 +1,29 @@
+// Compiled to assembly only (see CMakeLists.txt): EAV_TRY must leave no panic path behind
+#include <eav/Try.hpp>
+
+using namespace eav;
+
+struct Error {
+    int code;
+};
+
+Result<int, Error> Source(int x);
+Option<int> SourceOpt(int x);
+
+Result<int, Error> TrySum(int a, int b) {
+    const int x = EAV_TRY(Source(a));
+    const int y = EAV_TRY(Source(b));
+    return make::Ok(x + y);
+}
+
+Result<int, Error> TryAssignSum(int a, int b) {
+    EAV_TRY_ASSIGN(const int x, Source(a));
+    EAV_TRY_ASSIGN(const int y, Source(b));
+    return make::Ok(x + y);
+}
+
+Option<int> TryOptSum(int a, int b) {
+    const int x = EAV_TRY_OPT(SourceOpt(a));
+    const int y = EAV_TRY_OPT(SourceOpt(b));
+    return make::Some(x + y);
+}
@@ -0,0 +1,14 @@
+// Control for Try.cpp: the check-then-unwrap form keeps a panic path the optimizer cannot drop
+#include <eav/Result.hpp>
+
+using namespace eav;
+
+struct Error {
+    int code;
+};
+
+Result<int, Error> Source(int x);
+
+int UnwrapSum(int a, int b) {
+    return Source(a).unwrap_ok() + Source(b).unwrap_ok();
+}
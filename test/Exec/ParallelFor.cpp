@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <eav/Exec/ParallelFor.hpp>
+
+using namespace eav::exec;
+
+TEST(ParallelForTest, VisitsEveryIndexOnce) {
+    ThreadPool pool(4);
+    std::vector<std::atomic<int>> hits(10'000);
+    const auto stopped = ParallelFor(par.on(pool).with_chunk(16), hits.size(), [&](std::size_t i) {
+        hits[i].fetch_add(1, std::memory_order_relaxed);
+        return true;
+    });
+    EXPECT_EQ(stopped, hits.size());
+    for (const auto& h : hits) {
+        ASSERT_EQ(h.load(), 1);
+    }
+}
+
+TEST(ParallelForTest, CancelKeepsEverythingBefore) {
+    ThreadPool pool(4);
+    constexpr std::size_t kN = 10'000;
+    std::vector<std::atomic<int>> hits(kN);
+    const auto stopped = ParallelFor(par.on(pool).with_chunk(8), kN, [&](std::size_t i) {
+        hits[i].fetch_add(1, std::memory_order_relaxed);
+        return i % 1000 != 999 || i < 3000;  // 3999 is the first failure
+    });
+    EXPECT_EQ(stopped, 3999u);
+    for (std::size_t i = 0; i <= 3999; ++i) {
+        ASSERT_EQ(hits[i].load(), 1) << i;
+    }
+
+    // Later work is not scheduled: at most the chunks already claimed by other threads ran
+    std::size_t after = 0;
+    for (std::size_t i = 4000; i < kN; ++i) after += static_cast<std::size_t>(hits[i].load());
+    EXPECT_LT(after, kN - 4000);
+}
+
+TEST(ParallelForTest, Sequential) {
+    std::vector<std::size_t> order;
+    const auto stopped = ParallelFor(seq, 10, [&](std::size_t i) {
+        order.push_back(i);
+        return i != 4;
+    });
+    EXPECT_EQ(stopped, 4u);
+    EXPECT_EQ(order, (std::vector<std::size_t>{0, 1, 2, 3, 4}));
+}
+
+TEST(ParallelForTest, RethrowsOnCaller) {
+    ThreadPool pool(4);
+    EXPECT_THROW(ParallelFor(par.on(pool).with_chunk(1), 1000,
+                             [](std::size_t i) {
+                                 if (i == 500) throw std::runtime_error("boom");
+                                 return true;
+                             }),
+                 std::runtime_error);
+}
+
+TEST(ParallelForTest, NestedDoesNotDeadlock) {
+    // Inner loops run on busy workers: their helpers may start only after the inner caller
+    // finished the range alone, and must not block it
+    ThreadPool pool(2);
+    std::atomic<int> total{0};
+    ParallelFor(par.on(pool).with_chunk(1), 8, [&](std::size_t) {
+        ParallelFor(par.on(pool).with_chunk(1), 8, [&](std::size_t) {
+            total.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        });
+        return true;
+    });
+    EXPECT_EQ(total.load(), 64);
+}
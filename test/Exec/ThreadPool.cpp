@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include <eav/Exec/ThreadPool.hpp>
+
+using eav::exec::ThreadPool;
+
+TEST(ThreadPoolTest, RunsEveryTaskBeforeDestruction) {
+    std::atomic<int> done{0};
+    {
+        ThreadPool pool(4);
+        EXPECT_EQ(pool.size(), 4u);
+        for (int i = 0; i < 1000; ++i) {
+            pool.Submit([&done] { done.fetch_add(1, std::memory_order_relaxed); });
+        }
+    }
+    EXPECT_EQ(done.load(), 1000);
+}
+
+TEST(ThreadPoolTest, MoveOnlyTask) {
+    std::atomic<int> seen{0};
+    {
+        ThreadPool pool(1);
+        auto payload = std::make_unique<int>(42);
+        pool.Submit([p = std::move(payload), &seen] { seen = *p; });
+    }
+    EXPECT_EQ(seen.load(), 42);
+}
+
+TEST(ThreadPoolTest, RunsOnWorkerThreads) {
+    std::atomic<bool> other_thread{false};
+    {
+        ThreadPool pool(2);
+        const auto caller = std::this_thread::get_id();
+        pool.Submit([&] { other_thread = std::this_thread::get_id() != caller; });
+    }
+    EXPECT_TRUE(other_thread.load());
+}
+
+TEST(ThreadPoolTest, DefaultPool) {
+    EXPECT_GE(ThreadPool::Default().size(), 1u);
+    EXPECT_EQ(&ThreadPool::Default(), &ThreadPool::Default());
+}
+
+TEST(ThreadPoolTest, PostsJobsItDoesNotOwn) {
+    struct Counter final : eav::exec::Job {
+        std::atomic<int> runs{0};
+
+        void Run() noexcept override {
+            runs.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    Counter counter;
+    {
+        ThreadPool pool(2);
+        for (int i = 0; i < 100; ++i) {
+            pool.Post(counter);
+        }
+    }
+    EXPECT_EQ(counter.runs.load(), 100);
+}
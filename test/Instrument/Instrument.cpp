@@ -0,0 +1,212 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <eav/Instrument.hpp>
+#include <eav/Option.hpp>
+#include <eav/Result.hpp>
+
+using namespace eav;
+using instrument::Event;
+
+namespace {
+
+class InstrumentTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        instrument::Reset();
+    }
+
+    void TearDown() override {
+        instrument::SetSink(&instrument::CountingSink);
+        instrument::Reset();
+    }
+};
+
+// Total for `event` at `line` of this file
+std::uint64_t CountAt(Event event, std::uint32_t line) {
+    std::uint64_t count = 0;
+    for (const auto& s : instrument::Snapshot()) {
+        if (s.event == event && s.line == line && std::string_view(s.file).ends_with("Instrument.cpp")) {
+            count += s.count;
+        }
+    }
+    return count;
+}
+
+Result<int, std::string> Parse(int x) {
+    if (x < 0) {
+        return make::Err(std::string("negative"));  // kErrLine
+    }
+    return make::Ok(int{x});
+}
+constexpr std::uint32_t kErrLine = __LINE__ - 4;
+
+}  // namespace
+
+TEST_F(InstrumentTest, MakeErrCountsPerSite) {
+    for (int i = -5; i < 5; ++i) {
+        (void)Parse(i);
+    }
+    EXPECT_EQ(CountAt(Event::kMakeErr, kErrLine), 5u);
+
+    const auto stats = instrument::Snapshot();
+    ASSERT_FALSE(stats.empty());
+    EXPECT_EQ(stats.front().type_name.find("basic_string") != std::string_view::npos, true) << stats.front().type_name;
+    EXPECT_NE(std::string_view(stats.front().function).find("Parse"), std::string_view::npos);
+}
+
+TEST_F(InstrumentTest, ResultCombinators) {
+    auto is_even = [](int x) { return x % 2 == 0; };
+    auto check = [](int x) -> Result<int, std::string> {
+        if (x > 4) {
+            return make::Err(std::string("big"));
+        }
+        return make::Ok(int{x});
+    };
+
+    // Reported at the line that creates the stage
+    const auto pipeline = combine::result::Filter(is_even, std::string("odd"))
+        | combine::result::AndThen(check);
+    const std::uint32_t lazy_line = __LINE__ - 2;
+
+    for (int i = 0; i < 10; ++i) {
+        (void)(make::Ok(int{i}) | pipeline);
+        (void)(make::Ok(int{i}) | combine::result::Filter(is_even, std::string("odd")));
+        (void)(Result<int, std::string>(make::Ok(int{i})) | combine::result::AndThen(check));
+    }
+    const std::uint32_t eager_line = __LINE__ - 3;
+
+    EXPECT_EQ(CountAt(Event::kFilter, lazy_line), 5u);       // odd
+    EXPECT_EQ(CountAt(Event::kAndThen, lazy_line + 1), 2u);  // even and big: 6, 8
+    EXPECT_EQ(CountAt(Event::kFilter, eager_line), 5u);
+    EXPECT_EQ(CountAt(Event::kAndThen, eager_line + 1), 5u);
+
+    // A propagated error is not reported again by the stages it passes through
+    Result<int, std::string> in = make::Err(std::string("input"));
+    const std::uint32_t in_line = __LINE__ - 1;
+    (void)(std::move(in) | pipeline);
+    EXPECT_EQ(CountAt(Event::kMakeErr, in_line), 1u);
+    EXPECT_EQ(CountAt(Event::kFilter, lazy_line), 5u);
+    EXPECT_EQ(CountAt(Event::kAndThen, lazy_line + 1), 2u);
+}
+
+TEST_F(InstrumentTest, OrElseReportsFailedRecovery) {
+    auto recover = [](std::string s) -> Result<int, std::string> {
+        if (s == "fatal") {
+            return make::Err(std::move(s));
+        }
+        return make::Ok(0);
+    };
+
+    Result<int, std::string> soft = make::Err(std::string("soft"));
+    Result<int, std::string> fatal = make::Err(std::string("fatal"));
+    EXPECT_TRUE((std::move(soft) | combine::result::OrElse(recover)).is_ok());
+    EXPECT_TRUE((std::move(fatal) | combine::result::OrElse(recover)).is_err());
+    const std::uint32_t line = __LINE__ - 1;
+
+    EXPECT_EQ(CountAt(Event::kOrElse, line - 1), 0u);
+    EXPECT_EQ(CountAt(Event::kOrElse, line), 1u);
+}
+
+TEST_F(InstrumentTest, OptionCombinators) {
+    auto check = [](int x) -> Option<int> {
+        if (x > 5) {
+            return make::None();
+        }
+        return make::Some(int{x});
+    };
+
+    const auto pipeline = combine::option::Filter([](int x) { return x > 0; })
+        | combine::option::AndThen(check);
+    const std::uint32_t line = __LINE__ - 2;
+
+    for (int i = -2; i < 8; ++i) {
+        (void)(make::Some(int{i}) | pipeline);
+    }
+    EXPECT_EQ(CountAt(Event::kFilter, line), 3u);       // -2, -1, 0
+    EXPECT_EQ(CountAt(Event::kAndThen, line + 1), 2u);  // 6, 7
+
+    (void)(make::Some(0) | combine::option::Filter([](int x) { return x > 0; }));
+    EXPECT_EQ(CountAt(Event::kFilter, __LINE__ - 1), 1u);
+}
+
+TEST_F(InstrumentTest, UnwrapMisuse) {
+    Result<int, std::string> err = make::Err(std::string("e"));
+    Option<int> none = make::None();
+
+    EXPECT_ANY_THROW((void)err.unwrap_ok());
+    const std::uint32_t result_line = __LINE__ - 1;
+    EXPECT_ANY_THROW((void)none.unwrap());
+    const std::uint32_t option_line = __LINE__ - 1;
+    EXPECT_NO_THROW((void)err.unwrap_err());
+
+    EXPECT_EQ(CountAt(Event::kUnwrapMisuse, result_line), 1u);
+    EXPECT_EQ(CountAt(Event::kUnwrapMisuse, option_line), 1u);
+}
+
+TEST_F(InstrumentTest, CustomSink) {
+    static std::vector<std::string> seen;
+    seen.clear();
+    instrument::SetSink([](const instrument::Report& report) {
+        seen.emplace_back(instrument::EventName(report.event));
+        instrument::CountingSink(report);
+    });
+
+    (void)Parse(-1);
+    ASSERT_EQ(seen.size(), 1u);
+    EXPECT_EQ(seen.front(), "make::Err");
+    EXPECT_EQ(CountAt(Event::kMakeErr, kErrLine), 1u);
+
+    instrument::SetSink(nullptr);
+    (void)Parse(-1);
+    EXPECT_EQ(seen.size(), 1u);
+    EXPECT_EQ(CountAt(Event::kMakeErr, kErrLine), 1u);
+}
+
+TEST_F(InstrumentTest, ThreadsAddUp) {
+    constexpr int kThreads = 4;
+    constexpr int kErrors = 1000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([] {
+            for (int i = 0; i < kErrors; ++i) {
+                (void)Parse(-1);
+            }
+        });
+    }
+    // Counted while the threads are still running or after they exit: both are kept
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    (void)Parse(-1);
+
+    std::uint64_t lost = 0;
+    (void)instrument::Snapshot(&lost);
+    EXPECT_EQ(lost, 0u);
+    EXPECT_EQ(CountAt(Event::kMakeErr, kErrLine), kThreads * kErrors + 1u);
+}
+
+TEST_F(InstrumentTest, Reset) {
+    (void)Parse(-1);
+    EXPECT_EQ(CountAt(Event::kMakeErr, kErrLine), 1u);
+
+    instrument::Reset();
+    EXPECT_TRUE(instrument::Snapshot().empty());
+
+    (void)Parse(-1);
+    EXPECT_EQ(CountAt(Event::kMakeErr, kErrLine), 1u);
+}
+
+TEST_F(InstrumentTest, Dump) {
+    (void)Parse(-1);
+    (void)Parse(-1);
+
+    const std::string dump = instrument::Dump();
+    EXPECT_EQ(dump.rfind("2 make::Err ", 0), 0u) << dump;
+    EXPECT_NE(dump.find("Instrument.cpp:" + std::to_string(kErrLine) + ":"), std::string::npos) << dump;
+    EXPECT_NE(dump.find("first seen "), std::string::npos) << dump;
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <type_traits>
+#include <utility>
+
+#include <eav/Option.hpp>
+
+#include "../Result/TestUtils.hpp"  // Tracked
+
+// A named or const Option piped into combinators is borrowed (see test/Result/Borrow.cpp)
+
+namespace {
+
+Option<Tracked> SomeSrc(int v) {
+    return make::Some(Tracked(v));
+}
+
+const auto kPositive = [](const Tracked& t) { return t.val > 0; };
+
+}  // namespace
+
+// clang-format off
+TEST(OptionBorrowTest, Map) {
+    const auto some = SomeSrc(1);
+    Tracked::Reset();
+    auto r = some | combine::option::Map([](const Tracked& t) { return t.val + 1; });
+    EXPECT_EQ(r.unwrap(), 2);
+    EXPECT_EQ(some.unwrap().val, 1);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);
+}
+
+TEST(OptionBorrowTest, AndThen) {
+    auto some = SomeSrc(1);
+    Tracked::Reset();
+    auto r = some | combine::option::AndThen([](const Tracked& t) { return make::Some(int{t.val}); });
+    EXPECT_EQ(r.unwrap(), 1);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);
+}
+
+TEST(OptionBorrowTest, FilterAndOrElse) {
+    const auto some = SomeSrc(1);
+    Tracked::Reset();
+    auto r1 = some | combine::option::Filter(kPositive);
+    EXPECT_EQ(r1.unwrap().val, 1);
+    EXPECT_EQ(Tracked::copies, 1);  // let through: the output owns a copy
+    EXPECT_EQ(Tracked::moves, 0);
+
+    Tracked::Reset();
+    auto r2 = some | combine::option::OrElse([] { return SomeSrc(2); });
+    EXPECT_EQ(r2.unwrap().val, 1);
+    EXPECT_EQ(Tracked::copies, 1);
+    EXPECT_EQ(some.unwrap().val, 1);
+}
+
+TEST(OptionBorrowTest, Pipeline) {
+    const auto pipeline = combine::option::Filter(kPositive)
+        | combine::option::Map([](const Tracked& t) { return t.val * 10; });
+
+    const auto some = SomeSrc(2);
+    Tracked::Reset();
+    EXPECT_EQ((some | pipeline).unwrap(), 20);
+    EXPECT_EQ((some | pipeline).unwrap(), 20);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);
+}
+
+TEST(OptionBorrowTest, AsRef) {
+    const auto some = SomeSrc(1);
+    Tracked::Reset();
+    auto ref = some.as_ref();
+    static_assert(std::is_same_v<decltype(ref), Option<const Tracked&>>);
+    static_assert(sizeof(ref) == sizeof(const Tracked*));
+    EXPECT_EQ(&ref.unwrap(), &some.unwrap());
+
+    auto r = some.as_ref() | combine::option::Filter(kPositive);
+    EXPECT_EQ(&r.unwrap(), &some.unwrap());
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);
+
+    const Option<Tracked> none = make::None();
+    EXPECT_FALSE(none.as_ref().has_value());
+}
+// clang-format on
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <array>
+
+#include <eav/Option.hpp>
+
+using namespace eav;
+
+// Every combinator, eager and fused, evaluated at compile time
+
+namespace {
+
+struct Point {
+    int x;
+    int y;
+};
+
+constexpr auto kDouble = [](int x) { return x * 2; };
+constexpr auto kIsEven = [](int x) { return x % 2 == 0; };
+constexpr auto kHalf = [](int x) -> Option<int> {
+    if (x % 2 != 0) return make::None();
+    return make::Some(x / 2);
+};
+constexpr auto kDefault = [] { return make::Some(-1); };
+
+constexpr Option<int> Find(int key) {
+    if (key < 0) return make::None();
+    return make::Some(key * 10);
+}
+
+}  // namespace
+
+// --- Construction and observers ---
+
+static_assert(make::Some(1).has_value());
+static_assert(!Option<int>(make::None()).has_value());
+static_assert(make::Some(Point{1, 2}).unwrap().y == 2);
+static_assert(make::Some(3).unwrap_unchecked() == 3);
+static_assert(Option<int>(make::None()).unwrap_or(9) == 9);
+static_assert(make::None().unwrap_or(4) == 4);
+
+// Niche layout (pointer)
+namespace {
+constexpr int kValue = 5;
+}  // namespace
+static_assert(*make::Some(&kValue).unwrap() == 5);
+static_assert(!Option<const int*>(make::None()).has_value());
+
+static_assert([] {
+    Option<Point> o = make::None();
+    o = make::Some(Point{3, 4});
+    Option<Point> copy = o;
+    o = Option<Point>(make::None());
+    return copy.unwrap().x == 3 && !o.has_value();
+}());
+
+// --- Eager combinators ---
+
+static_assert((Find(2) | combine::option::Map(kDouble)).unwrap() == 40);
+static_assert(!(make::None() | combine::option::Map(kDouble)).has_value());
+
+static_assert((Find(2) | combine::option::AndThen(kHalf)).unwrap() == 10);
+static_assert(!(Find(-1) | combine::option::AndThen(kHalf)).has_value());
+
+static_assert((Find(4) | combine::option::Filter(kIsEven)).unwrap() == 40);
+static_assert(!(make::Some(3) | combine::option::Filter(kIsEven)).has_value());
+
+static_assert((Find(-1) | combine::option::OrElse(kDefault)).unwrap() == -1);
+static_assert((Find(1) | combine::option::OrElse(kDefault)).unwrap() == 10);
+
+// --- Fused pipelines ---
+
+namespace {
+
+constexpr auto kPipeline = combine::option::Map(kDouble)
+    | combine::option::Filter(kIsEven)
+    | combine::option::AndThen(kHalf)
+    | combine::option::OrElse(kDefault);
+
+constexpr auto kTable = [] {
+    std::array<int, 3> out{};
+    for (int key = -1; key < 2; ++key) {
+        out[static_cast<std::size_t>(key + 1)] = kPipeline.Pipe(Find(key)).unwrap();
+    }
+    return out;
+}();
+
+}  // namespace
+
+static_assert(kPipeline.Pipe(Find(3)).unwrap() == 30);
+static_assert(kTable == std::array<int, 3>{-1, 0, 10});
+
+TEST(OptionConstexprTest, TableIsPrecomputed) {
+    constexpr auto table = kTable;
+    EXPECT_EQ(table[0], -1);
+    EXPECT_EQ(table[2], 10);
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include <coroutine>
+#include <string>
+#include <utility>
+
+#include <eav/Coro.hpp>
+
+using namespace eav;
+
+namespace {
+
+Option<int> Half(int x) {
+    if (x % 2 != 0) {
+        return make::None();
+    }
+    return make::Some(x / 2);
+}
+
+int g_steps = 0;
+
+Option<std::string> Quarter(int x) {
+    ++g_steps;
+    const int h = co_await Half(x);
+    ++g_steps;
+    const int q = co_await Half(h);
+    ++g_steps;
+    co_return std::to_string(q);
+}
+
+Option<int> Explicit(bool none) {
+    if (none) co_return make::None();
+    co_return 1;
+}
+
+}  // namespace
+
+TEST(OptionCoroTest, Some) {
+    EXPECT_EQ(Quarter(8).unwrap(), "2");
+}
+
+TEST(OptionCoroTest, ShortCircuit) {
+    g_steps = 0;
+    EXPECT_FALSE(Quarter(6).has_value());
+    EXPECT_EQ(g_steps, 2);
+}
+
+TEST(OptionCoroTest, CoReturn) {
+    EXPECT_FALSE(Explicit(true).has_value());
+    EXPECT_EQ(Explicit(false).unwrap(), 1);
+}
+
+// The return value built before the body runs (Clang 15/16) or after it (GCC, Clang 17+)
+TEST(OptionCoroTest, ReturnObjectConvertedEarlyOrLate) {
+    using Promise = std::coroutine_traits<Option<std::string>>::promise_type;
+    Promise early_promise;
+    Option<std::string> early = early_promise.get_return_object();
+    EXPECT_FALSE(early.has_value());
+    early_promise.return_value(std::string(40, 'x'));
+    EXPECT_EQ(early.unwrap(), std::string(40, 'x'));
+
+    Promise late_promise;
+    auto gro = late_promise.get_return_object();
+    late_promise.return_value(std::string(40, 'y'));
+    Option<std::string> late = std::move(gro);
+    EXPECT_EQ(late.unwrap(), std::string(40, 'y'));
+}
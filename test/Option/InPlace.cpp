@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <eav/Option.hpp>
+
+#include "../Result/TestUtils.hpp"  // Tracked
+
+// make::Some<T>(std::in_place, ...) and emplace (see test/Result/InPlace.cpp)
+
+namespace {
+
+struct Frame {
+    std::array<char, 4096> bytes;
+    int id;
+
+    constexpr Frame(int i, char fill) noexcept : bytes(), id(i) {
+        bytes.fill(fill);
+    }
+
+    Frame(const Frame&) = delete;
+    Frame(Frame&&) = delete;
+    Frame& operator=(const Frame&) = delete;
+    Frame& operator=(Frame&&) = delete;
+};
+
+struct ThrowsOnNegative {
+    int val;
+
+    explicit ThrowsOnNegative(int v) : val(v) {
+        if (v < 0) throw std::runtime_error("negative");
+    }
+};
+
+}  // namespace
+
+TEST(OptionInPlaceTest, NonMovable) {
+    auto opt = make::Some<Frame>(std::in_place, 4, 'f');
+    ASSERT_TRUE(opt.has_value());
+    EXPECT_EQ(opt.unwrap().id, 4);
+    EXPECT_EQ(opt.unwrap().bytes[100], 'f');
+
+    opt.emplace(5, 'g');
+    EXPECT_EQ(opt.unwrap().id, 5);
+}
+
+TEST(OptionInPlaceTest, NonMovableFromMap) {
+    auto opt = make::Some(5) | combine::option::Map([](int v) { return Frame(v, 'm'); });
+    EXPECT_EQ(opt.unwrap().id, 5);
+}
+
+TEST(OptionInPlaceTest, Moves) {
+    Tracked::Reset();
+    auto opt = make::Some<Tracked>(std::in_place, 1);
+    EXPECT_EQ(opt.unwrap().val, 1);
+
+    Tracked& ref = opt.emplace(2);
+    EXPECT_EQ(&ref, opt.ptr());
+    EXPECT_EQ(ref.val, 2);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);
+}
+
+TEST(OptionInPlaceTest, EmplaceIntoNone) {
+    Option<std::string> opt = make::None();
+    opt.emplace(3, 'a');
+    EXPECT_EQ(opt.unwrap(), "aaa");
+
+    Option<int*> niche = make::None();
+    int x = 0;
+    niche.emplace(&x);
+    EXPECT_EQ(niche.unwrap(), &x);
+}
+
+TEST(OptionInPlaceTest, EmplaceThrowLeavesNone) {
+    auto opt = make::Some<ThrowsOnNegative>(std::in_place, 1);
+    EXPECT_THROW(opt.emplace(-1), std::runtime_error);
+    EXPECT_FALSE(opt.has_value());
+}
+
+TEST(OptionInPlaceTest, Constexpr) {
+    constexpr auto kOpt = [] {
+        Option<int> opt = make::None();
+        opt.emplace(41);
+        ++opt.unwrap();
+        return opt;
+    }();
+    static_assert(kOpt.unwrap() == 42);
+
+    static_assert([] {
+        auto opt = make::Some<Frame>(std::in_place, 9, 'z');
+        return opt.unwrap().id;
+    }() == 9);
+}
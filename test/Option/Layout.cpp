@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <eav/Concepts/TriviallyRelocatable.hpp>
+#include <eav/Option.hpp>
+
+using namespace eav;
+
+struct Point {
+    int x;
+    int y;
+};
+
+// Trivially relocatable by opt-in, but not trivially copyable
+struct Handle {
+    int* fd;
+
+    explicit Handle(int* f) : fd(f) {}
+    Handle(Handle&& oth) noexcept : fd(oth.fd) { oth.fd = nullptr; }
+    ~Handle() { delete fd; }
+};
+
+template <>
+struct eav::RelocationTraits<Handle> {
+    static constexpr bool trivially_relocatable = true;
+};
+
+// --- triviality follows the payload ---
+static_assert(std::is_trivially_copyable_v<Option<int>>);
+static_assert(std::is_trivially_copyable_v<Option<Point>>);
+static_assert(std::is_trivially_copyable_v<Option<int*>>);
+static_assert(std::is_trivially_copyable_v<Option<Option<int>>>);
+static_assert(std::is_trivially_destructible_v<Option<double>>);
+static_assert(std::is_trivially_copy_assignable_v<Option<int>>);
+static_assert(std::is_trivially_move_assignable_v<Option<int>>);
+
+static_assert(!std::is_trivially_destructible_v<Option<std::string>>);
+static_assert(std::is_nothrow_move_constructible_v<Option<std::string>>);
+static_assert(std::is_nothrow_move_assignable_v<Option<std::string>>);
+static_assert(!std::is_copy_constructible_v<Option<Handle>>);
+static_assert(std::is_move_constructible_v<Option<Handle>>);
+
+// --- trivially relocatable: trivially copyable or opted in ---
+static_assert(concepts::TriviallyRelocatable<Option<int>>);
+static_assert(concepts::TriviallyRelocatable<Option<std::unique_ptr<int>>>);
+static_assert(concepts::TriviallyRelocatable<Option<Handle>>);
+static_assert(concepts::TriviallyRelocatable<Option<Option<Handle>>>);
+static_assert(!concepts::TriviallyRelocatable<Option<std::string>>);
+
+// clang-format off
+TEST(OptionLayoutTest, RelocateOptedInPayload) {
+    std::allocator<Option<Handle>> alloc;
+    Option<Handle>* src = alloc.allocate(3);
+    Option<Handle>* dst = alloc.allocate(3);
+
+    std::construct_at(src + 0, make::Some(Handle(new int(1))));
+    std::construct_at(src + 1, make::None());
+    std::construct_at(src + 2, make::Some(Handle(new int(3))));
+
+    EXPECT_EQ(RelocateN(src, 3, dst), dst + 3);
+    alloc.deallocate(src, 3);  // sources are gone: no destructor runs on them
+
+    EXPECT_EQ(*dst[0].unwrap().fd, 1);
+    EXPECT_FALSE(dst[1].has_value());
+    EXPECT_EQ(*dst[2].unwrap().fd, 3);
+
+    std::destroy_n(dst, 3);
+    alloc.deallocate(dst, 3);
+}
+
+TEST(OptionLayoutTest, RelocateNonRelocatablePayload) {
+    std::allocator<Option<std::string>> alloc;
+    Option<std::string>* src = alloc.allocate(2);
+    Option<std::string>* dst = alloc.allocate(2);
+
+    std::construct_at(src + 0, make::Some(std::string("a string longer than the small buffer")));
+    std::construct_at(src + 1, make::Some(std::string("sso")));
+
+    RelocateN(src, 2, dst);
+    alloc.deallocate(src, 2);
+
+    EXPECT_EQ(dst[0].unwrap(), "a string longer than the small buffer");
+    EXPECT_EQ(dst[1].unwrap(), "sso");
+
+    std::destroy_n(dst, 2);
+    alloc.deallocate(dst, 2);
+}
+
+TEST(OptionLayoutTest, VectorGrowthKeepsValues) {
+    std::vector<Option<int>> v;
+    for (int i = 0; i < 100; ++i) {
+        if (i % 3 == 0) {
+            v.push_back(make::None());
+        } else {
+            v.push_back(make::Some(i));
+        }
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(v[static_cast<std::size_t>(i)].has_value(), i % 3 != 0);
+    }
+    EXPECT_EQ(v[2].unwrap(), 2);
+}
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <utility>
+
+#include <eav/Option.hpp>
+
+#include "../Result/TestUtils.hpp"  // Tracked
+
+// Exact copy/move counts of the payload for every combinator (see test/Result/Moves.cpp)
+
+namespace {
+
+Option<Tracked> SomeSrc(int v) {
+    return make::Some(Tracked(v));
+}
+
+const auto kPositive = [](const Tracked& t) { return t.val > 0; };
+
+}  // namespace
+
+// clang-format off
+TEST(OptionMovesTest, Map) {
+    auto some = SomeSrc(1);
+    Tracked::Reset();
+    auto r = std::move(some) | combine::option::Map([](Tracked&& t) { return Tracked(t.val + 1); });
+    EXPECT_EQ(r.unwrap().val, 2);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);  // in place
+}
+
+TEST(OptionMovesTest, AndThen) {
+    auto some = SomeSrc(1);
+    Tracked::Reset();
+    auto r = std::move(some) | combine::option::AndThen([](Tracked&& t) { return make::Some(int{t.val}); });
+    EXPECT_EQ(r.unwrap(), 1);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);
+}
+
+TEST(OptionMovesTest, Filter) {
+    auto pass = SomeSrc(1);
+    Tracked::Reset();
+    auto r1 = std::move(pass) | combine::option::Filter(kPositive);
+    EXPECT_TRUE(r1.has_value());
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 1);  // the Option itself is moved
+
+    auto fail = SomeSrc(-1);
+    Tracked::Reset();
+    auto r2 = std::move(fail) | combine::option::Filter(kPositive);
+    EXPECT_FALSE(r2.has_value());
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);
+}
+
+TEST(OptionMovesTest, OrElse) {
+    const auto fallback = [] { return make::Some(Tracked(0)); };
+
+    auto some = SomeSrc(1);
+    Tracked::Reset();
+    auto r = std::move(some) | combine::option::OrElse(fallback);
+    EXPECT_EQ(r.unwrap().val, 1);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 1);  // the Option itself is moved
+}
+
+TEST(OptionMovesTest, Accessors) {
+    auto some = SomeSrc(1);
+    Tracked::Reset();
+    Tracked val = std::move(some).unwrap();
+    EXPECT_EQ(val.val, 1);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 1);
+
+    Option<Tracked> none = make::None();
+    Tracked::Reset();
+    Tracked other = std::move(none).unwrap_or(Tracked(5));
+    EXPECT_EQ(other.val, 5);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 1);
+
+    auto lvalue = SomeSrc(2);
+    Tracked::Reset();
+    Tracked copy = lvalue.unwrap_or(Tracked(5));
+    EXPECT_EQ(copy.val, 2);
+    EXPECT_EQ(Tracked::copies, 1);
+    EXPECT_EQ(Tracked::moves, 0);
+}
+
+TEST(OptionMovesTest, FusedPipeline) {
+    const auto pipeline = combine::option::Filter(kPositive)
+        | combine::option::Map([](Tracked&& t) { return Tracked(t.val + 1); })
+        | combine::option::Filter(kPositive)
+        | combine::option::Map([](Tracked&& t) { return Tracked(t.val * 10); });
+
+    auto some = SomeSrc(1);
+    Tracked::Reset();
+    auto r = std::move(some) | pipeline;
+    EXPECT_EQ(r.unwrap().val, 20);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);  // intermediates by reference, last value in place
+}
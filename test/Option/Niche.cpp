@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include <eav/Option.hpp>
+
+using namespace eav;
+
+enum class Color : unsigned char { Red,
+                                   Green,
+                                   Invalid };
+
+template <>
+struct eav::NicheTraits<Color> : eav::ReservedValueNiche<Color, Color::Invalid> {};
+
+// niche => no separate flag:
+static_assert(sizeof(Option<int*>) == sizeof(int*));
+static_assert(sizeof(Option<const char*>) == sizeof(const char*));
+static_assert(sizeof(Option<std::unique_ptr<int>>) == sizeof(std::unique_ptr<int>));
+static_assert(sizeof(Option<std::shared_ptr<int>>) == sizeof(std::shared_ptr<int>));
+static_assert(sizeof(Option<std::reference_wrapper<std::string>>) == sizeof(std::string*));
+static_assert(sizeof(Option<Color>) == sizeof(Color));
+static_assert(sizeof(Option<float>) == sizeof(float));
+static_assert(sizeof(Option<double>) == sizeof(double));
+
+// no niche => value + flag:
+static_assert(sizeof(Option<int>) == 2 * sizeof(int));
+static_assert(sizeof(Option<char>) == 2);
+
+// clang-format off
+TEST(OptionNicheTest, RawPointer) {
+    int x = 7;
+    Option<int*> some = make::Some(&x);
+    Option<int*> none = make::None();
+
+    EXPECT_TRUE(some.has_value());
+    EXPECT_EQ(*some.unwrap(), 7);
+    EXPECT_FALSE(none.has_value());
+    EXPECT_THROW(none.unwrap(), std::runtime_error);
+}
+
+TEST(OptionNicheTest, NicheValueIsNone) {
+    Option<int*> o = make::Some(static_cast<int*>(nullptr));
+    EXPECT_FALSE(o.has_value());
+}
+
+TEST(OptionNicheTest, UniquePtrMoveLeavesNone) {
+    Option<std::unique_ptr<int>> o = make::Some(std::make_unique<int>(100));
+    Option<std::unique_ptr<int>> moved = std::move(o);
+
+    EXPECT_TRUE(moved.has_value());
+    EXPECT_EQ(*moved.unwrap(), 100);
+    EXPECT_FALSE(o.has_value());
+}
+
+TEST(OptionNicheTest, ReferenceWrapper) {
+    std::string s = "abc";
+    Option<std::reference_wrapper<std::string>> some = make::Some(std::ref(s));
+    Option<std::reference_wrapper<std::string>> none = make::None();
+
+    EXPECT_TRUE(some.has_value());
+    some.unwrap().get() += "d";
+    EXPECT_EQ(s, "abcd");
+    EXPECT_FALSE(none.has_value());
+}
+
+TEST(OptionNicheTest, ReservedEnumValue) {
+    Option<Color> some = make::Some(Color::Green);
+    Option<Color> none = make::None();
+
+    EXPECT_EQ(some.unwrap(), Color::Green);
+    EXPECT_FALSE(none.has_value());
+    EXPECT_EQ(none.unwrap_or(Color::Red), Color::Red);
+}
+
+TEST(OptionNicheTest, FloatingPoint) {
+    Option<double> nan = make::Some(std::numeric_limits<double>::quiet_NaN());
+    Option<double> none = make::None();
+
+    EXPECT_TRUE(nan.has_value());
+    EXPECT_FALSE(none.has_value());
+}
+
+TEST(OptionNicheTest, Assignment) {
+    int x = 1;
+    Option<int*> a = make::Some(&x);
+    Option<int*> b = make::None();
+
+    a = b;
+    EXPECT_FALSE(a.has_value());
+    b = make::Some(&x);
+    EXPECT_TRUE(b.has_value());
+}
+
+TEST(OptionNicheTest, CombinatorsChain) {
+    int x = 21;
+    auto res = make::Some(&x)
+        | combine::option::Filter([](int* p) { return *p > 0; })
+        | combine::option::Map([](int* p) { return *p * 2; })
+        | combine::option::AndThen([](int v) { return make::Some(std::make_unique<int>(v)); });
+
+    EXPECT_TRUE(res.has_value());
+    EXPECT_EQ(*res.unwrap(), 42);
+
+    auto none = make::Some(static_cast<int*>(nullptr))
+        | combine::option::Map([](int* p) { return *p; })
+        | combine::option::OrElse([]() { return make::Some(-1); });
+
+    EXPECT_EQ(none.unwrap(), -1);
+}
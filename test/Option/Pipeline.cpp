@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include <eav/Option.hpp>
+
+using namespace eav;
+
+// clang-format off
+TEST(OptionPipelineTest, ComposeThenApply) {
+    const auto pipeline = combine::option::Map([](int x) { return x + 9; })
+        | combine::option::Filter([](int x) { return x > 5; })
+        | combine::option::AndThen([](int x) { return make::Some(std::to_string(x)); });
+
+    EXPECT_EQ((make::Some(1) | pipeline).unwrap(), "10");
+    EXPECT_FALSE((make::Some(-10) | pipeline).has_value());
+
+    Option<int> none = make::None();
+    EXPECT_FALSE((std::move(none) | pipeline).has_value());
+}
+
+TEST(OptionPipelineTest, SameResultAsEagerChain) {
+    auto eager = make::Some(1)
+        | combine::option::Map([](int x) { return x + 9; })
+        | combine::option::AndThen([](int) { return make::None(); })
+        | combine::option::Map([](int x) { return x + 100; })
+        | combine::option::OrElse([]() { return make::Some(42); });
+
+    const auto pipeline = combine::option::Map([](int x) { return x + 9; })
+        | combine::option::AndThen([](int) { return make::None(); })
+        | combine::option::Map([](int x) { return x + 100; })
+        | combine::option::OrElse([]() { return make::Some(42); });
+    auto lazy = make::Some(1) | pipeline;
+
+    static_assert(std::same_as<decltype(eager), decltype(lazy)>);
+    EXPECT_EQ(eager.unwrap(), lazy.unwrap());
+}
+
+TEST(OptionPipelineTest, NoneSkipsToEnd) {
+    int calls = 0;
+    const auto count = [&calls](int x) { ++calls; return x; };
+    const auto pipeline = combine::option::Map(count)
+        | combine::option::Map(count)
+        | combine::option::OrElse([]() { return make::Some(-1); });
+
+    EXPECT_EQ((make::None() | pipeline).unwrap(), -1);
+    EXPECT_EQ(calls, 0);
+    EXPECT_EQ((make::Some(3) | pipeline).unwrap(), 3);
+    EXPECT_EQ(calls, 2);
+}
+
+namespace {
+
+// Every stage is built from a local lvalue callable that owns heap memory: the returned
+// pipeline must hold copies, not references to the locals
+auto MakeStoredPipeline() {
+    auto add = [s = std::string(40, 'x')](int x) { return x + static_cast<int>(s.size()); };
+    auto half = [s = std::string(40, 'y')](int x) -> Option<int> {
+        if (x % 2 != 0) {
+            return make::None();
+        }
+        return make::Some(x / 2 + static_cast<int>(s.size()) - 40);
+    };
+    auto positive = [s = std::string(40, 'z')](int x) { return x > 0 && !s.empty(); };
+    auto fallback = [s = std::string(40, 'w')]() -> Option<int> { return make::Some(static_cast<int>(s.size())); };
+    return combine::option::Map(add)
+        | combine::option::AndThen(half)
+        | combine::option::Filter(positive)
+        | combine::option::OrElse(fallback);
+}
+
+}  // namespace
+
+TEST(OptionPipelineTest, StoredPipelineOwnsItsFunctions) {
+    const auto pipeline = MakeStoredPipeline();
+    EXPECT_EQ((make::Some(2) | pipeline).unwrap(), 21);
+    EXPECT_EQ((make::Some(1) | pipeline).unwrap(), 40);    // odd: None -> fallback
+    EXPECT_EQ((make::Some(-40) | pipeline).unwrap(), 40);  // 0 is rejected -> fallback
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <utility>
+
+#include <eav/Option.hpp>
+
+using namespace eav;
+
+// Option<T&>: refers to an existing object, stored as a pointer with null as None
+
+namespace {
+
+std::map<std::string, std::string>& Cache() {
+    static std::map<std::string, std::string> cache{{"a", "alpha"}, {"b", "beta"}};
+    return cache;
+}
+
+Option<std::string&> Find(const std::string& key) {
+    auto it = Cache().find(key);
+    if (it == Cache().end()) {
+        return make::None();
+    }
+    return make::SomeRef(it->second);
+}
+
+}  // namespace
+
+static_assert(sizeof(Option<int&>) == sizeof(int*));
+static_assert(sizeof(Option<const std::string&>) == sizeof(std::string*));
+static_assert(std::is_trivially_copyable_v<Option<int&>>);
+
+// clang-format off
+TEST(OptionRefTest, AccessorsReferToTheObject) {
+    auto some = Find("a");
+    ASSERT_TRUE(some.has_value());
+    EXPECT_EQ(&some.unwrap(), &Cache().at("a"));
+    EXPECT_EQ(&std::as_const(some).unwrap(), &Cache().at("a"));
+    EXPECT_EQ(&std::move(some).unwrap(), &Cache().at("a"));
+    EXPECT_EQ(Find("a").ptr(), &Cache().at("a"));
+
+    Find("b").unwrap() += "!";
+    EXPECT_EQ(Cache().at("b"), "beta!");
+
+    auto none = Find("z");
+    EXPECT_FALSE(none.has_value());
+    EXPECT_EQ(none.ptr(), nullptr);
+    EXPECT_THROW(none.unwrap(), std::runtime_error);
+}
+
+TEST(OptionRefTest, UnwrapOrAndEmplace) {
+    std::string fallback = "none";
+    EXPECT_EQ(&Find("z").unwrap_or(fallback), &fallback);
+
+    int a = 1;
+    int b = 2;
+    Option<int&> ref = make::SomeRef(a);
+    ref.emplace(b) = 5;
+    EXPECT_EQ(a, 1);
+    EXPECT_EQ(b, 5);
+}
+
+TEST(OptionRefTest, Combinators) {
+    auto len = Find("a") | combine::option::Map([](const std::string& s) { return s.size(); });
+    EXPECT_EQ(len.unwrap(), 5u);
+
+    auto same = Find("a")
+        | combine::option::Filter([](const std::string& s) { return !s.empty(); })
+        | combine::option::Map([](std::string& s) -> std::string& { return s; });
+    static_assert(std::same_as<decltype(same), Option<std::string&>>);
+    EXPECT_EQ(same.ptr(), &Cache().at("a"));
+
+    auto chained = Find("a") | combine::option::AndThen([](std::string&) { return Find("z"); });
+    EXPECT_FALSE(chained.has_value());
+
+    std::string fallback = "fallback";
+    auto other = Find("z") | combine::option::OrElse([&]() -> Option<std::string&> { return make::SomeRef(fallback); });
+    EXPECT_EQ(other.ptr(), &fallback);
+}
+
+TEST(OptionRefTest, LazyPipeline) {
+    const auto pipeline = combine::option::Filter([](const std::string& s) { return s.size() > 4; })
+        | combine::option::Map([](std::string& s) -> const std::string& { return s; });
+
+    auto hit = Find("a") | pipeline;
+    static_assert(std::same_as<decltype(hit), Option<const std::string&>>);
+    EXPECT_EQ(hit.ptr(), &Cache().at("a"));
+    EXPECT_FALSE((Find("z") | pipeline).has_value());
+}
+// clang-format on
@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+#include <eav/Traverse.hpp>
+
+using namespace eav;
+
+namespace {
+
+std::vector<int> Iota(int n) {
+    std::vector<int> out(static_cast<std::size_t>(n));
+    for (int i = 0; i < n; ++i) out[static_cast<std::size_t>(i)] = i;
+    return out;
+}
+
+}  // namespace
+
+TEST(OptionTraverseTest, AllSome) {
+    exec::ThreadPool pool(4);
+    const auto in = Iota(3000);
+    const auto half = [](int x) -> Option<double> { return make::Some(x / 2.0); };
+
+    auto seq = combine::option::Traverse(in, half);
+    auto par = combine::option::Traverse(exec::par.on(pool).with_chunk(11), in, half);
+    EXPECT_EQ(seq.unwrap(), par.unwrap());
+    EXPECT_DOUBLE_EQ(par.unwrap()[2999], 1499.5);
+}
+
+TEST(OptionTraverseTest, NoneCancels) {
+    exec::ThreadPool pool(2);
+    std::atomic<int> calls{0};
+    const auto in = Iota(100'000);
+    auto res = combine::option::Traverse(exec::par.on(pool).with_chunk(64), in, [&](int x) -> Option<int> {
+        calls.fetch_add(1, std::memory_order_relaxed);
+        if (x == 10) return make::None();
+        return make::Some(int{x});
+    });
+    EXPECT_FALSE(res.has_value());
+    EXPECT_LT(calls.load(), 100'000);
+}
+
+TEST(OptionTraverseTest, Collect) {
+    std::vector<Option<int>> opts;
+    opts.push_back(make::Some(1));
+    opts.push_back(make::Some(2));
+    EXPECT_EQ(combine::option::Collect(opts).unwrap(), (std::vector<int>{1, 2}));
+
+    opts.push_back(make::None());
+    EXPECT_FALSE(combine::option::Collect(exec::par, opts).has_value());
+}
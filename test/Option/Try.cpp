@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+
+#include <eav/Try.hpp>
+
+using namespace eav;
+
+namespace {
+
+Option<int> Half(int x) {
+    if (x % 2 != 0) {
+        return make::None();
+    }
+    return make::Some(x / 2);
+}
+
+int g_steps = 0;
+
+Option<std::string> Quarter(int x) {
+    ++g_steps;
+    const int h = EAV_TRY_OPT(Half(x));
+    ++g_steps;
+    const int q = EAV_TRY_OPT(Half(h));
+    ++g_steps;
+    return make::Some(std::to_string(q));
+}
+
+Option<std::string> QuarterAssign(int x) {
+    EAV_TRY_OPT_ASSIGN(const int h, Half(x));
+    EAV_TRY_OPT_ASSIGN(const int q, Half(h));
+    return make::Some(std::to_string(q));
+}
+
+}  // namespace
+
+TEST(OptionTryTest, Some) {
+    g_steps = 0;
+    EXPECT_EQ(Quarter(12).unwrap(), "3");
+    EXPECT_EQ(g_steps, 3);
+    EXPECT_EQ(QuarterAssign(12).unwrap(), "3");
+}
+
+TEST(OptionTryTest, ShortCircuit) {
+    g_steps = 0;
+    EXPECT_FALSE(Quarter(3).has_value());
+    EXPECT_EQ(g_steps, 1);
+
+    g_steps = 0;
+    EXPECT_FALSE(Quarter(6).has_value());
+    EXPECT_EQ(g_steps, 2);
+
+    EXPECT_FALSE(QuarterAssign(6).has_value());
+}
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <utility>
+
 #include <eav/Option.hpp>
 
 using namespace eav;
@@ -38,6 +41,16 @@ TEST(OptionTest, UnwrapOr) {
     EXPECT_EQ(o_none.unwrap_or(11), 11);
 }
 
+TEST(OptionTest, UnwrapUnchecked) {
+    Option<std::unique_ptr<int>> o = make::Some(std::make_unique<int>(7));
+
+    EXPECT_EQ(*o.unwrap_unchecked(), 7);
+    EXPECT_EQ(*std::as_const(o).unwrap_unchecked(), 7);
+
+    auto extracted = std::move(o).unwrap_unchecked();
+    EXPECT_EQ(*extracted, 7);
+}
+
 TEST(OptionTest, MoveOnlyTypeSupport) {
     auto ptr = std::make_unique<int>(100);
     Option<std::unique_ptr<int>> o = make::Some(std::move(ptr));
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+
+#include <eav/Option.hpp>
+#include <eav/Result.hpp>
+
+using namespace eav;
+
+namespace {
+
+struct Panicked {
+    std::string msg;
+};
+
+void ThrowingHandler(std::string_view msg) {
+    throw Panicked{std::string(msg)};
+}
+
+void UnwrapErrWithReturningHandler() {
+    SetPanicHandler([](std::string_view) {});
+    Result<int, int> r = make::Err(3);
+    r.unwrap_ok("bad access");
+}
+
+}  // namespace
+
+TEST(PanicTest, HandlerReceivesMessage) {
+    PanicHandler prev = SetPanicHandler(&ThrowingHandler);
+
+    Option<int> o = make::None();
+    try {
+        o.unwrap("no value");
+        FAIL();
+    } catch (const Panicked& p) {
+        EXPECT_EQ(p.msg, "no value");
+    }
+
+    Result<int, int> r = make::Ok(1);
+    try {
+        r.unwrap_err("not an error");
+        FAIL();
+    } catch (const Panicked& p) {
+        EXPECT_EQ(p.msg, "not an error");
+    }
+
+    EXPECT_EQ(SetPanicHandler(prev), &ThrowingHandler);
+}
+
+TEST(PanicDeathTest, AbortsWithoutHandler) {
+    Option<int> o = make::None();
+    EXPECT_DEATH(o.unwrap("no value"), "eav panic: no value");
+}
+
+TEST(PanicDeathTest, AbortsWhenHandlerReturns) {
+    EXPECT_DEATH(UnwrapErrWithReturningHandler(), "eav panic: bad access");
+}
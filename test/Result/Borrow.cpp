@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <type_traits>
+#include <utility>
+
+#include "TestUtils.hpp"
+
+// A named or const Result piped into combinators is borrowed: the user functions get
+// const T&/const E&, the source is left as it was, and only what ends up in the output is copied.
+
+namespace {
+
+Result<Tracked, Tracked> OkSrc(int v) {
+    return make::Ok(Tracked(v));
+}
+
+Result<Tracked, Tracked> ErrSrc(int v) {
+    return make::Err(Tracked(v));
+}
+
+const auto kPositive = [](const Tracked& t) { return t.val > 0; };
+
+template <typename R>
+concept HasAsRef = requires(R&& res) { std::forward<R>(res).as_ref(); };
+
+}  // namespace
+
+// clang-format off
+TEST(ResultBorrowTest, MapOk) {
+    const auto ok = OkSrc(1);
+    Tracked::Reset();
+    auto r1 = ok | combine::result::MapOk([](const Tracked& t) { return t.val + 1; });
+    EXPECT_EQ(r1.unwrap_ok(), 2);
+    EXPECT_EQ(ok.unwrap_ok().val, 1);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);
+
+    auto err = ErrSrc(1);
+    Tracked::Reset();
+    auto r2 = err | combine::result::MapOk([](const Tracked& t) { return t.val; });
+    EXPECT_EQ(r2.unwrap_err().val, 1);
+    EXPECT_EQ(err.unwrap_err().val, 1);
+    EXPECT_EQ(Tracked::copies, 1);  // the error into Result<int, Tracked>
+    EXPECT_EQ(Tracked::moves, 0);
+}
+
+TEST(ResultBorrowTest, MapErr) {
+    const auto ok = OkSrc(1);
+    Tracked::Reset();
+    auto r = ok | combine::result::MapErr([](const Tracked& t) { return t.val; });
+    EXPECT_EQ(r.unwrap_ok().val, 1);
+    EXPECT_EQ(Tracked::copies, 1);  // the value into Result<Tracked, int>
+    EXPECT_EQ(Tracked::moves, 0);
+}
+
+TEST(ResultBorrowTest, AndThen) {
+    const auto step = [](const Tracked& t) -> Result<int, Tracked> { return make::Ok(int{t.val}); };
+
+    const auto ok = OkSrc(1);
+    Tracked::Reset();
+    auto r = ok | combine::result::AndThen(step);
+    EXPECT_EQ(r.unwrap_ok(), 1);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);
+}
+
+TEST(ResultBorrowTest, OrElse) {
+    const auto recover = [](const Tracked& e) -> Result<Tracked, int> { return make::Err(int{e.val}); };
+
+    const auto err = ErrSrc(1);
+    Tracked::Reset();
+    auto r = err | combine::result::OrElse(recover);
+    EXPECT_EQ(r.unwrap_err(), 1);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);
+}
+
+TEST(ResultBorrowTest, Filter) {
+    const Result<Tracked, int> ok = make::Ok(Tracked(1));
+    Tracked::Reset();
+    auto r1 = ok | combine::result::Filter(kPositive, -1);
+    EXPECT_EQ(r1.unwrap_ok().val, 1);
+    EXPECT_EQ(Tracked::copies, 1);  // let through: the output owns a copy
+    EXPECT_EQ(Tracked::moves, 0);
+
+    Tracked::Reset();
+    auto r2 = ok | combine::result::Filter([](const Tracked& t) { return t.val > 1; }, -1);
+    EXPECT_EQ(r2.unwrap_err(), -1);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);
+}
+
+TEST(ResultBorrowTest, FilterKeepsAnErrLikeAMovedSource) {
+    Result<int, std::string> named = make::Err(std::string("orig"));
+    auto borrowed = named | combine::result::Filter([](int x) { return x > 0; }, std::string("filtered"));
+    auto moved = std::move(named) | combine::result::Filter([](int x) { return x > 0; }, std::string("filtered"));
+    static_assert(std::same_as<decltype(borrowed), decltype(moved)>);
+    EXPECT_EQ(borrowed.unwrap_err(), "orig");
+    EXPECT_EQ(moved.unwrap_err(), "orig");
+}
+
+TEST(ResultBorrowTest, Pipeline) {
+    const auto pipeline = combine::result::Filter(kPositive, Tracked(0))
+        | combine::result::MapOk([](const Tracked& t) { return t.val * 10; });
+
+    auto ok = OkSrc(2);
+    Tracked::Reset();
+    auto r1 = ok | pipeline;
+    auto r2 = ok | pipeline;
+    EXPECT_EQ(r1.unwrap_ok(), 20);
+    EXPECT_EQ(r2.unwrap_ok(), 20);
+    EXPECT_EQ(ok.unwrap_ok().val, 2);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);
+}
+
+TEST(ResultBorrowTest, AsRef) {
+    const auto ok = OkSrc(1);
+    auto err = ErrSrc(2);
+    Tracked::Reset();
+    auto ref = ok.as_ref();
+    static_assert(std::is_same_v<decltype(ref), Result<const Tracked&, const Tracked&>>);
+    EXPECT_EQ(&ref.unwrap_ok(), &ok.unwrap_ok());
+
+    auto r = err.as_ref() | combine::result::MapOk([](const Tracked& t) { return t.val; });
+    static_assert(std::is_same_v<decltype(r), Result<int, const Tracked&>>);
+    EXPECT_EQ(&r.unwrap_err(), &err.unwrap_err());
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);
+
+    static_assert(sizeof(Result<const Tracked&, const Tracked&>) <= 2 * sizeof(void*));
+    static_assert(HasAsRef<const Result<Tracked, Tracked>&>);
+    static_assert(!HasAsRef<Result<Tracked, Tracked>&&>);  // would dangle
+}
+
+TEST(ResultBorrowTest, AsRefVoid) {
+    Result<void, Tracked> err = make::Err(Tracked(3));
+    Tracked::Reset();
+    auto ref = err.as_ref();
+    static_assert(std::is_same_v<decltype(ref), Result<void, const Tracked&>>);
+    EXPECT_EQ(ref.unwrap_err().val, 3);
+    EXPECT_EQ(Tracked::copies, 0);
+}
+
+TEST(ResultBorrowTest, ErrOfLvalueCopies) {
+    Tracked e(4);
+    Tracked::Reset();
+    Result<int, Tracked> r = make::Err(e);
+    EXPECT_EQ(r.unwrap_err().val, 4);
+    EXPECT_EQ(Tracked::copies, 1);
+}
+// clang-format on
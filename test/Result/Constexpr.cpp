@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <string_view>
+#include <utility>
+
+#include <eav/Result.hpp>
+
+using namespace eav;
+
+// Every combinator, eager and fused, evaluated at compile time
+
+namespace {
+
+enum class ParseError { Empty, NotADigit, TooLarge };
+
+constexpr Result<int, ParseError> ParseDigit(std::string_view s) {
+    if (s.empty()) return make::Err(ParseError::Empty);
+    if (s.size() != 1 || s[0] < '0' || s[0] > '9') return make::Err(ParseError::NotADigit);
+    return make::Ok(s[0] - '0');
+}
+
+constexpr auto kIsSmall = [](int x) { return x < 10; };
+constexpr auto kHalveEven = [](int x) -> Result<int, ParseError> {
+    if (x % 2 != 0) return make::Err(ParseError::NotADigit);
+    return make::Ok(x / 2);
+};
+constexpr auto kRecover = [](ParseError e) -> Result<int, ParseError> {
+    if (e == ParseError::Empty) return make::Ok(0);
+    return make::Err(std::move(e));
+};
+
+}  // namespace
+
+// --- Construction and observers ---
+
+static_assert(Result<int, ParseError>(make::Ok(1)).is_ok());
+static_assert(Result<int, ParseError>(make::Err(ParseError::Empty)).is_err());
+static_assert(!static_cast<bool>(Result<int, ParseError>(make::Err(ParseError::Empty))));
+static_assert(Result<int, ParseError>(make::Ok(7)).unwrap_ok() == 7);
+static_assert(Result<int, ParseError>(make::Ok(7)).unwrap_ok_unchecked() == 7);
+static_assert(Result<int, ParseError>(make::Err(ParseError::Empty)).unwrap_ok_or(3) == 3);
+static_assert(Result<int, ParseError>(make::Err(ParseError::TooLarge)).unwrap_err() == ParseError::TooLarge);
+static_assert(Result<int, ParseError>(make::Ok(5)).erase_err().unwrap() == 5);
+static_assert(!Result<int, ParseError>(make::Err(ParseError::Empty)).erase_err().has_value());
+
+static_assert([] {
+    Result<int, ParseError> r = make::Ok(1);
+    r = Result<int, ParseError>(make::Err(ParseError::TooLarge));
+    Result<int, ParseError> copy = r;
+    r = Result<int, ParseError>(make::Ok(2));
+    return copy.is_err() && r.unwrap_ok() == 2;
+}());
+
+// --- Eager combinators ---
+
+static_assert((ParseDigit("4") | combine::result::MapOk([](int x) { return x * 2; })).unwrap_ok() == 8);
+static_assert((make::Err(ParseError::Empty) | combine::result::MapOk([](int x) { return x * 2; })).unwrap_err() == ParseError::Empty);
+
+static_assert((ParseDigit("x") | combine::result::MapErr([](ParseError e) { return static_cast<int>(e); })).unwrap_err() == 1);
+static_assert((make::Ok(3) | combine::result::MapErr([](ParseError e) { return static_cast<int>(e); })).unwrap_ok() == 3);
+
+static_assert((ParseDigit("8") | combine::result::AndThen(kHalveEven)).unwrap_ok() == 4);
+static_assert((ParseDigit("7") | combine::result::AndThen(kHalveEven)).is_err());
+
+static_assert((ParseDigit("") | combine::result::OrElse(kRecover)).unwrap_ok() == 0);
+static_assert((ParseDigit("?") | combine::result::OrElse(kRecover)).unwrap_err() == ParseError::NotADigit);
+
+static_assert((ParseDigit("3") | combine::result::Filter(kIsSmall, ParseError::TooLarge)).unwrap_ok() == 3);
+static_assert((make::Ok(12) | combine::result::Filter(kIsSmall, ParseError::TooLarge)).unwrap_err() ==
+              ParseError::TooLarge);
+
+// --- Fused pipelines ---
+
+namespace {
+
+constexpr auto kPipeline = combine::result::MapOk([](int x) { return x * 2; })
+    | combine::result::Filter(kIsSmall, ParseError::TooLarge)
+    | combine::result::AndThen(kHalveEven)
+    | combine::result::OrElse(kRecover)
+    | combine::result::MapErr([](ParseError e) { return static_cast<int>(e); });
+
+// Validation table precomputed at compile time
+constexpr std::array<std::string_view, 4> kInputs{"3", "7", "", "?"};
+
+constexpr auto kTable = [] {
+    std::array<int, kInputs.size()> out{};
+    for (std::size_t i = 0; i < kInputs.size(); ++i) {
+        auto res = kPipeline.Pipe(ParseDigit(kInputs[i]));
+        out[i] = res.is_ok() ? res.unwrap_ok() : -res.unwrap_err();
+    }
+    return out;
+}();
+
+}  // namespace
+
+static_assert(kPipeline.Pipe(ParseDigit("4")).unwrap_ok() == 4);
+static_assert(kTable == std::array<int, 4>{3, -2, 0, -1});
+
+TEST(ResultConstexprTest, TableIsPrecomputed) {
+    constexpr auto table = kTable;
+    EXPECT_EQ(table[0], 3);
+    EXPECT_EQ(table[1], -2);
+}
@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <string_view>
+
+#include <eav/Context.hpp>
+
+#include "TestUtils.hpp"
+
+namespace {
+
+using combine::result::AndThen;
+using combine::result::Context;
+using combine::result::MapOk;
+
+Result<int, std::string> ParseHeader(std::string_view /*name*/, int value) {
+    if (value < 0) {
+        return make::Err(std::string("bad value"));
+    }
+    return make::Ok(int{value});
+}
+
+Result<int, WithContext<std::string>> LoadShard(int shard, std::string_view header, int value) {
+    return ParseHeader(header, value) | Context("while parsing header {}", header) |
+           Context("in shard {}", shard);
+}
+
+}  // namespace
+
+TEST(ResultContextTest, OkUntouched) {
+    ContextArena arena;
+    ScopedContextArena scope(arena);
+
+    auto res = LoadShard(12, "Host", 5);
+    EXPECT_EQ(res.unwrap_ok(), 5);
+    EXPECT_EQ(arena.heap_bytes(), 0u);
+}
+
+TEST(ResultContextTest, Chain) {
+    ContextArena arena;
+    ScopedContextArena scope(arena);
+
+    auto res = LoadShard(12, "Host", -1);
+    const auto& err = res.unwrap_err();
+    EXPECT_EQ(err.error(), "bad value");
+    EXPECT_EQ(err.context(), "in shard 12: while parsing header Host");
+    EXPECT_EQ(err.to_string(), "in shard 12: while parsing header Host: bad value");
+}
+
+TEST(ResultContextTest, ArgumentsCopiedOnError) {
+    ContextArena arena;
+    ScopedContextArena scope(arena);
+
+    Result<int, WithContext<std::string>> res = make::Ok(int{0});
+    {
+        std::string name = "Content-Length";
+        res = ParseHeader(name, -1) | Context("header {} (#{}, {})", name, 3, 2.5);
+        name.assign(name.size(), 'x');  // the arena has its own copy
+    }
+    EXPECT_EQ(res.unwrap_err().context(), "header Content-Length (#3, 2.5)");
+}
+
+TEST(ResultContextTest, StoredPipelineOwnsStrings) {
+    ContextArena arena;
+    ScopedContextArena scope(arena);
+
+    // Built from temporaries that are gone before it runs
+    const auto pipeline = MapOk([](int x) { return x + 1; }) |
+                          Context("header {} in {}", std::string(40, 'h'), std::string_view(std::string(30, 'f')));
+    const std::string noise(40, 'x');  // reuses the freed memory, if anything does
+
+    auto res = ParseHeader("h", -1) | pipeline;
+    EXPECT_EQ(res.unwrap_err().context(), "header " + std::string(40, 'h') + " in " + std::string(30, 'f'));
+    EXPECT_EQ(noise.size(), 40u);
+}
+
+TEST(ResultContextTest, LazyPipeline) {
+    ContextArena arena;
+    ScopedContextArena scope(arena);
+
+    auto pipeline = AndThen([](int x) -> Result<int, std::string> {
+                        if (x > 10) {
+                            return make::Err(std::string("too big"));
+                        }
+                        return make::Ok(int{x});
+                    }) |
+                    Context("step {}", 1) | MapOk([](int x) { return x + 1; }) | Context("step {}", 2);
+
+    EXPECT_EQ((ParseHeader("h", 3) | pipeline).unwrap_ok(), 4);
+    EXPECT_EQ((ParseHeader("h", 30) | pipeline).unwrap_err().to_string(), "step 2: step 1: too big");
+    EXPECT_EQ((ParseHeader("h", -1) | pipeline).unwrap_err().to_string(), "step 2: step 1: bad value");
+}
+
+TEST(ResultContextTest, ResetExpires) {
+    ContextArena arena;
+    ScopedContextArena scope(arena);
+
+    auto res = LoadShard(1, "Host", -1);
+    EXPECT_FALSE(res.unwrap_err().expired());
+    arena.Reset();
+    EXPECT_TRUE(res.unwrap_err().expired());
+    EXPECT_EQ(res.unwrap_err().context(), "<context expired>");
+    EXPECT_EQ(res.unwrap_err().error(), "bad value");  // the error itself is kept
+}
+
+TEST(ResultContextTest, DestroyedArenaExpires) {
+    Result<int, WithContext<std::string>> res = make::Ok(int{0});
+    {
+        auto arena = std::make_unique<ContextArena>();
+        ScopedContextArena scope(*arena);
+        res = LoadShard(1, "Host", -1);
+        EXPECT_FALSE(res.unwrap_err().expired());
+    }
+    EXPECT_TRUE(res.unwrap_err().expired());  // without reading the freed arena (ASan)
+    EXPECT_EQ(res.unwrap_err().to_string(), "<context expired>: bad value");
+
+    // A later arena, possibly in the same memory, does not revive it
+    auto arena = std::make_unique<ContextArena>();
+    ScopedContextArena scope(*arena);
+    (void)LoadShard(2, "Host", -1);
+    EXPECT_TRUE(res.unwrap_err().expired());
+    auto more = std::move(res) | Context("retried {}", 2);
+    EXPECT_EQ(more.unwrap_err().to_string(), "retried 2: bad value");
+}
+
+TEST(ResultContextTest, ArenaReusedAfterReset) {
+    ContextArena arena;
+    ScopedContextArena scope(arena);
+
+    const std::string big(600, 'a');
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 20; ++i) {
+            auto res = ParseHeader("h", -1) | Context("{}", big);
+            EXPECT_EQ(res.unwrap_err().context().size(), big.size());
+        }
+        const std::size_t heap = arena.heap_bytes();
+        arena.Reset();
+        if (round > 0) {
+            EXPECT_EQ(arena.heap_bytes(), heap);  // steady state: no new chunks
+        }
+    }
+}
+
+TEST(ResultContextTest, BoundedAllocation) {
+    ContextArena arena(/*max_bytes=*/4096);
+    ScopedContextArena scope(arena);
+
+    const std::string big(1000, 'a');
+    Result<int, WithContext<std::string>> res = ParseHeader("h", -1) | Context("first");
+    for (int i = 0; i < 50; ++i) {
+        res = std::move(res) | Context("{}", big);
+    }
+    EXPECT_LE(arena.heap_bytes(), 4096u);
+    EXPECT_GT(arena.dropped(), 0u);
+    EXPECT_NE(res.unwrap_err().context().find("dropped)"), std::string::npos);
+}
+
+TEST(ResultContextTest, ThreadArenaByDefault) {
+    auto res = LoadShard(3, "Host", -1);
+    EXPECT_EQ(res.unwrap_err().context(), "in shard 3: while parsing header Host");
+    ContextArena::ForThread().Reset();
+}
+
+TEST(ResultContextTest, OtherThreadSeesExpired) {
+    // Recorded in the worker's own arena, which is destroyed with the thread
+    Result<int, WithContext<std::string>> res = make::Ok(int{0});
+    std::thread worker([&] { res = LoadShard(7, "Host", -1); });
+    worker.join();
+
+    EXPECT_TRUE(res.unwrap_err().expired());
+    EXPECT_EQ(res.unwrap_err().to_string(), "<context expired>: bad value");
+
+    // New context on this thread starts a new chain in this thread's arena
+    ContextArena arena;
+    ScopedContextArena scope(arena);
+    auto more = std::move(res) | Context("retried {}", 2);
+    EXPECT_EQ(more.unwrap_err().to_string(), "retried 2: bad value");
+}
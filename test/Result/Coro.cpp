@@ -0,0 +1,230 @@
+#include <gtest/gtest.h>
+
+#include <coroutine>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <eav/Coro.hpp>
+
+#include "TestUtils.hpp"
+
+namespace {
+
+Result<int, ErrorCode> Parse(int x) {
+    if (x < 0) {
+        return make::Err(ErrorCode{x, "negative"});
+    }
+    return make::Ok(int{x});
+}
+
+Result<int, ErrorCode> Sum(int a, int b) {
+    const int x = co_await Parse(a);
+    const int y = co_await Parse(b);
+    co_return x + y;
+}
+
+int g_steps = 0;
+
+Result<std::string, ErrorCode> Chain(int a, int b, int c) {
+    ++g_steps;
+    auto s = co_await Sum(a, b);
+    ++g_steps;
+    auto t = co_await Parse(c);
+    ++g_steps;
+    co_return std::to_string(s * t);
+}
+
+// Error type without a default constructor
+struct Strict {
+    int code;
+    explicit Strict(int c) : code(c) {}
+};
+
+Result<int, Strict> StrictStep(int x) {
+    if (x == 0) co_return make::Err(Strict(7));
+    co_return x;
+}
+
+// Neither alternative is default constructible
+Result<Strict, Strict> BothStrict(int x) {
+    if (x == 0) co_return make::Err(Strict(x));
+    co_return Strict(co_await StrictStep(x) + 1);
+}
+
+Result<void, ErrorCode> Check(int x) {
+    if (x < 0) {
+        return make::Err(ErrorCode{x, "negative"});
+    }
+    return make::Ok();
+}
+
+int g_checked = 0;
+
+// Ends with co_return; (or by flowing off the end), fails with co_await make::Err(...)
+Result<void, ErrorCode> CheckAll(int a, int b) {
+    co_await Check(a);
+    co_await Check(b);
+    if (a == b) {
+        ErrorCode equal{0, "equal"};  // GCC 12 mishandles aggregate temporaries inside co_await
+        co_await make::Err(std::move(equal));
+    }
+    ++g_checked;
+}
+
+Result<int, ErrorCode> SumChecked(int a, int b) {
+    co_await CheckAll(a, b);
+    co_return a + b;
+}
+
+Result<Tracked, int> TrackedSrc(int v) {
+    return make::Ok<Tracked, int>(std::in_place, v);
+}
+
+Result<Tracked, int> PassTracked() {
+    Tracked t = co_await TrackedSrc(1);
+    co_return std::move(t);
+}
+
+Result<int, int> Throws() {
+    co_await Result<int, int>(make::Ok(int{1}));
+    throw std::runtime_error("boom");
+}
+
+Result<int, int> FromLvalue(const Result<int, int>& in) {
+    const int& ref = co_await in;
+    co_return ref + 1;
+}
+
+Result<int, int> WithAllocator(std::allocator_arg_t, std::pmr::polymorphic_allocator<std::byte>, int x) {
+    const int v = co_await Result<int, int>(make::Ok(int{x}));
+    co_return v * 2;
+}
+
+// Counts the bytes that went through it
+class CountingResource : public std::pmr::memory_resource {
+  public:
+    std::size_t allocated = 0;
+    std::size_t live = 0;
+
+  private:
+    void* do_allocate(std::size_t bytes, std::size_t align) override {
+        allocated += bytes;
+        ++live;
+        return std::pmr::new_delete_resource()->allocate(bytes, align);
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t align) override {
+        --live;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& oth) const noexcept override {
+        return this == &oth;
+    }
+};
+
+}  // namespace
+
+TEST(ResultCoroTest, Ok) {
+    EXPECT_EQ(Sum(1, 2).unwrap_ok(), 3);
+}
+
+TEST(ResultCoroTest, ShortCircuit) {
+    g_steps = 0;
+    auto res = Chain(1, -2, 3);
+    EXPECT_EQ(res.unwrap_err(), (ErrorCode{-2, "negative"}));
+    EXPECT_EQ(g_steps, 1);  // nothing after the failed co_await ran
+
+    g_steps = 0;
+    EXPECT_EQ(Chain(1, 2, 3).unwrap_ok(), "9");
+    EXPECT_EQ(g_steps, 3);
+}
+
+TEST(ResultCoroTest, CoReturnErr) {
+    EXPECT_EQ(StrictStep(0).unwrap_err().code, 7);
+    EXPECT_EQ(StrictStep(5).unwrap_ok(), 5);
+}
+
+TEST(ResultCoroTest, Void) {
+    g_checked = 0;
+    EXPECT_TRUE(CheckAll(1, 2).is_ok());
+    EXPECT_EQ(g_checked, 1);
+    EXPECT_EQ(CheckAll(1, -2).unwrap_err(), (ErrorCode{-2, "negative"}));
+    EXPECT_EQ(CheckAll(3, 3).unwrap_err().msg, "equal");
+    EXPECT_EQ(g_checked, 1);
+
+    EXPECT_EQ(SumChecked(1, 2).unwrap_ok(), 3);
+    EXPECT_EQ(SumChecked(-1, 2).unwrap_err().code, -1);
+}
+
+TEST(ResultCoroTest, NoDefaultConstructor) {
+    EXPECT_EQ(BothStrict(0).unwrap_err().code, 0);
+    EXPECT_EQ(BothStrict(2).unwrap_ok().code, 3);
+}
+
+TEST(ResultCoroTest, AwaitLvalue) {
+    const Result<int, int> ok = make::Ok(int{41});
+    const Result<int, int> err = make::Err(int{-1});
+    EXPECT_EQ(FromLvalue(ok).unwrap_ok(), 42);
+    EXPECT_EQ(FromLvalue(err).unwrap_err(), -1);
+    EXPECT_EQ(ok.unwrap_ok(), 41);  // not moved from
+}
+
+TEST(ResultCoroTest, Moves) {
+    Tracked::Reset();
+    auto res = PassTracked();
+    EXPECT_EQ(res.unwrap_ok().val, 1);
+    // co_await into `t` (1), co_return into the return object (1), out of it to the caller (1)
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 3);
+}
+
+TEST(ResultCoroTest, ExceptionPropagates) {
+    EXPECT_THROW((void)Throws(), std::runtime_error);
+}
+
+TEST(ResultCoroTest, FrameFromAllocator) {
+    CountingResource resource;
+    auto res = WithAllocator(std::allocator_arg, &resource, 21);
+    EXPECT_EQ(res.unwrap_ok(), 42);
+    EXPECT_GT(resource.allocated, 0u);
+    EXPECT_EQ(resource.live, 0u);  // the frame was freed through the same resource
+}
+
+// A compiler may build the return value from get_return_object() when the ramp function returns
+// (GCC, Clang 17+), or before the body runs (Clang 15/16). Both orders, driven by hand
+TEST(ResultCoroTest, ReturnObjectConvertedLate) {
+    using Promise = std::coroutine_traits<Result<std::string, ErrorCode>>::promise_type;
+    Promise promise;
+    auto gro = promise.get_return_object();
+    promise.return_value(std::string(40, 'x'));
+    Result<std::string, ErrorCode> res = std::move(gro);
+    EXPECT_EQ(res.unwrap_ok(), std::string(40, 'x'));
+}
+
+TEST(ResultCoroTest, ReturnObjectConvertedEarly) {
+    using Promise = std::coroutine_traits<Result<std::string, ErrorCode>>::promise_type;
+    Promise ok_promise;
+    Result<std::string, ErrorCode> ok = ok_promise.get_return_object();
+    EXPECT_TRUE(ok.is_err());  // the placeholder, ErrorCode{}, until the body has a value
+    ok_promise.return_value(std::string(40, 'x'));
+    EXPECT_EQ(ok.unwrap_ok(), std::string(40, 'x'));
+
+    Promise err_promise;
+    Result<std::string, ErrorCode> err = err_promise.get_return_object();
+    err_promise.SetErr(ErrorCode{3, "late"});  // what a failed co_await does
+    EXPECT_EQ(err.unwrap_err(), (ErrorCode{3, "late"}));
+
+    std::coroutine_traits<Result<void, Strict>>::promise_type void_promise;
+    Result<void, Strict> done = void_promise.get_return_object();
+    void_promise.return_void();
+    EXPECT_TRUE(done.is_ok());
+
+    // Neither alternative default-constructible: no placeholder to start from
+    std::coroutine_traits<Result<Strict, Strict>>::promise_type strict_promise;
+    EXPECT_THROW(static_cast<void>(Result<Strict, Strict>(strict_promise.get_return_object())), std::runtime_error);
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <eav/ErrorCode.hpp>
+#include <eav/Result.hpp>
+
+// Not TestUtils.hpp: its ::ErrorCode would clash with eav::ErrorCode under `using namespace eav`
+
+namespace {
+
+enum class HttpError { kOk, kRateLimited, kBadRequest };
+enum class DbError { kOk, kTimeout };
+enum class Unlisted { kA = 7 };
+
+}  // namespace
+
+template <>
+struct eav::ErrorCategoryTraits<HttpError> {
+    static constexpr std::string_view messages[] = {"ok", "rate limited", "bad request"};
+    static constexpr ErrorCategory category{"http", messages};
+};
+
+template <>
+struct eav::ErrorCategoryTraits<DbError> {
+    static constexpr std::string_view messages[] = {"ok", "timeout"};
+    static constexpr ErrorCategory category{"db", messages};
+};
+
+template <>
+struct eav::ErrorCategoryTraits<Unlisted> {
+    static constexpr ErrorCategory category{"unlisted", {}};
+};
+
+namespace {
+
+using eav::ErrorCode;
+using eav::Result;
+
+static_assert(eav::concepts::IsError<ErrorCode>);
+static_assert(eav::concepts::IsErrorEnum<HttpError>);
+static_assert(!eav::concepts::IsErrorEnum<int>);
+static_assert(std::is_trivially_copyable_v<Result<int, ErrorCode>>);
+
+Result<int, ErrorCode> Admit(int tokens) {
+    if (tokens <= 0) {
+        return eav::make::Err(ErrorCode(HttpError::kRateLimited));
+    }
+    return eav::make::Ok(int{tokens - 1});
+}
+
+}  // namespace
+
+TEST(ErrorCodeTest, CategoryAndMessage) {
+    const ErrorCode err = HttpError::kBadRequest;
+    EXPECT_EQ(err.code(), 2);
+    EXPECT_EQ(err.category().name, "http");
+    EXPECT_EQ(err.message(), "bad request");
+    EXPECT_EQ(err.to_string(), "http: bad request");
+
+    EXPECT_EQ(ErrorCode(Unlisted::kA).message(), "unknown error");
+}
+
+TEST(ErrorCodeTest, Default) {
+    const ErrorCode err;
+    EXPECT_EQ(err.code(), 0);
+    EXPECT_EQ(err.category().name, "generic");
+    EXPECT_EQ(err.message(), "no error");
+}
+
+TEST(ErrorCodeTest, Compare) {
+    const ErrorCode err = DbError::kTimeout;
+    EXPECT_TRUE(err == DbError::kTimeout);
+    EXPECT_FALSE(err == DbError::kOk);
+    EXPECT_FALSE(err == HttpError::kRateLimited);  // same code, other category
+    EXPECT_EQ(ErrorCode(HttpError::kOk), ErrorCode(HttpError::kOk));
+    EXPECT_NE(ErrorCode(HttpError::kOk), ErrorCode(DbError::kOk));
+}
+
+TEST(ErrorCodeTest, As) {
+    const ErrorCode err = DbError::kTimeout;
+    EXPECT_TRUE(err.is<DbError>());
+    EXPECT_FALSE(err.is<HttpError>());
+    EXPECT_EQ(err.as<DbError>().unwrap(), DbError::kTimeout);
+    EXPECT_FALSE(err.as<HttpError>().has_value());
+}
+
+TEST(ErrorCodeTest, InResult) {
+    EXPECT_EQ(Admit(3).unwrap_ok(), 2);
+    EXPECT_TRUE(Admit(0).unwrap_err() == HttpError::kRateLimited);
+}
+
+TEST(ErrorCodeTest, MapErrBetweenCategories) {
+    auto fetch = [](bool ok) -> Result<int, DbError> {
+        if (!ok) {
+            return eav::make::Err(DbError::kTimeout);
+        }
+        return eav::make::Ok(int{1});
+    };
+    auto res = fetch(false) | eav::combine::result::MapErr(eav::IntoErrorCode{}) |
+               eav::combine::result::MapErr([](ErrorCode e) -> ErrorCode {
+                   return e == DbError::kTimeout ? ErrorCode(HttpError::kRateLimited) : e;
+               });
+    EXPECT_TRUE(res.unwrap_err() == HttpError::kRateLimited);
+}
+
+TEST(ContextualErrorTest, Context) {
+    const eav::ContextualError plain = HttpError::kBadRequest;
+    EXPECT_TRUE(plain.context().empty());
+    EXPECT_EQ(plain.to_string(), "http: bad request");
+
+    const eav::ContextualError detailed(HttpError::kBadRequest, "missing header Host");
+    const eav::ContextualError copy = detailed;
+    EXPECT_EQ(copy.context().data(), detailed.context().data());  // shared, not copied
+    EXPECT_EQ(copy.to_string(), "http: bad request (missing header Host)");
+    EXPECT_TRUE(copy.code() == HttpError::kBadRequest);
+}
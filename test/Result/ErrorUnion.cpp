@@ -0,0 +1,308 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "TestUtils.hpp"
+
+// ErrorUnion<E...>: the error of a chain whose steps fail with different types. AndThen widens
+// into it, Match (and OrElse with a handler for one alternative) narrows it again.
+
+namespace {
+
+struct ParseError {
+    int pos;
+};
+
+struct IoError {
+    std::string path;
+};
+
+struct NotFound {};
+
+enum class Errc : unsigned char { kBusy, kDenied };
+
+Result<int, ParseError> Parse(int x) {
+    if (x < 0) {
+        return make::Err(ParseError{x});
+    }
+    return make::Ok(int{x});
+}
+
+Result<long, IoError> Read(int x) {
+    if (x == 0) {
+        return make::Err(IoError{"/dev/zero"});
+    }
+    return make::Ok(long{x} * 2);
+}
+
+Result<long, NotFound> Find(long x) {
+    if (x > 100) {
+        return make::Err(NotFound{});
+    }
+    return make::Ok(long{x});
+}
+
+using Errors = ErrorUnion<ParseError, IoError, NotFound>;
+
+}  // namespace
+
+// --- The union ---
+
+static_assert(std::same_as<ErrorUnion<ParseError, ErrorUnion<IoError, ParseError>, NotFound, IoError>, Errors>);
+static_assert(std::same_as<ErrorUnion<const ParseError&, IoError&&>, FlatErrorUnion<ParseError, IoError>>);
+static_assert(std::same_as<ErrorUnion<NotFound>, FlatErrorUnion<NotFound>>);
+static_assert(concepts::IsError<Errors> && concepts::IsErrorUnion<Errors> && !concepts::IsErrorUnion<IoError>);
+
+// The largest alternative + 1-byte tag
+static_assert(sizeof(ErrorUnion<Errc, NotFound>) == 2);
+static_assert(sizeof(ErrorUnion<int, Errc>) == 2 * sizeof(int));
+static_assert(sizeof(Errors) == sizeof(std::string) + alignof(std::string));
+
+// Trivial alternatives give a trivially copyable union
+static_assert(std::is_trivially_copyable_v<ErrorUnion<int, Errc, NotFound>>);
+static_assert(!std::is_trivially_copyable_v<Errors>);
+
+static_assert([] {
+    ErrorUnion<int, Errc> err = Errc::kDenied;
+    ErrorUnion<int, Errc> copy = err;
+    err = 7;
+    return copy.holds<Errc>() && copy.get<Errc>() == Errc::kDenied && err.index() == 0 && err == 7;
+}());
+
+TEST(ErrorUnionTest, HoldsOneAlternative) {
+    Errors err = IoError{"/etc/passwd"};
+    EXPECT_EQ(err.index(), 1u);
+    EXPECT_TRUE(err.holds<IoError>());
+    EXPECT_FALSE(err.holds<ParseError>());
+    EXPECT_EQ(err.get<IoError>().path, "/etc/passwd");
+    EXPECT_EQ(err.get_if<ParseError>(), nullptr);
+    ASSERT_NE(err.get_if<IoError>(), nullptr);
+    EXPECT_EQ(std::move(err).get<IoError>().path, "/etc/passwd");
+
+    Errors in_place(std::in_place_type<ParseError>, 4);
+    EXPECT_EQ(in_place.get<ParseError>().pos, 4);
+    EXPECT_THROW(static_cast<void>(in_place.get<NotFound>()), std::runtime_error);
+}
+
+TEST(ErrorUnionTest, CopyMoveAssign) {
+    Errors err = IoError{std::string(64, 'x')};
+    Errors copy = err;
+    Errors moved = std::move(err);
+    EXPECT_EQ(copy.get<IoError>().path, std::string(64, 'x'));
+    EXPECT_EQ(moved.get<IoError>().path, std::string(64, 'x'));
+
+    moved = NotFound{};  // another alternative: the string is destroyed
+    EXPECT_TRUE(moved.holds<NotFound>());
+    moved = copy;
+    EXPECT_EQ(moved.get<IoError>().path, std::string(64, 'x'));
+    copy = IoError{"y"};  // the same alternative: assigned
+    EXPECT_EQ(copy.get<IoError>().path, "y");
+}
+
+TEST(ErrorUnionTest, WidensFromSubset) {
+    ErrorUnion<NotFound, IoError> narrow = IoError{"a"};
+    Errors wide = narrow;
+    EXPECT_EQ(wide.get<IoError>().path, "a");
+    Errors moved = ErrorUnion<NotFound, IoError>(NotFound{});
+    EXPECT_TRUE(moved.holds<NotFound>());
+    static_assert(!std::is_convertible_v<Errors, ErrorUnion<NotFound, IoError>>);
+}
+
+TEST(ErrorUnionTest, ConvertsBetweenOrders) {
+    using Reordered = ErrorUnion<NotFound, IoError, ParseError>;
+    static_assert(!std::same_as<Reordered, Errors>);
+    static_assert(std::is_convertible_v<Errors, Reordered> && std::is_convertible_v<Reordered, Errors>);
+
+    Reordered err = Errors(IoError{"b"});
+    EXPECT_EQ(err.index(), 1u);
+    EXPECT_EQ(err.get<IoError>().path, "b");
+    const Errors back = err;
+    EXPECT_EQ(back.index(), 1u);
+    EXPECT_TRUE(Errors(Reordered(ParseError{2})).holds<ParseError>());
+}
+
+namespace {
+
+// The declared error lists the alternatives in another order than the chain that produces it
+Result<long, ErrorUnion<NotFound, IoError, ParseError>> Lookup(int x) {
+    return Parse(x) | combine::result::AndThen(&Read) | combine::result::AndThen(&Find);
+}
+
+Result<void, ErrorUnion<NotFound, Errc>> Check(bool missing) {
+    if (missing) {
+        return make::Err(NotFound{});
+    }
+    return make::Ok();
+}
+
+}  // namespace
+
+TEST(ErrorUnionTest, ReturnsAChainInAnotherOrder) {
+    EXPECT_EQ(Lookup(3).unwrap_ok(), 6);
+    EXPECT_EQ(Lookup(-1).unwrap_err().get<ParseError>().pos, -1);
+    EXPECT_EQ(Lookup(0).unwrap_err().get<IoError>().path, "/dev/zero");
+    EXPECT_EQ(Lookup(60).unwrap_err().index(), 0u);
+
+    // Also into a wider union, and for Result<void, E>
+    Result<long, ErrorUnion<Errc, Errors>> wider = Lookup(0);
+    EXPECT_EQ(wider.unwrap_err().get<IoError>().path, "/dev/zero");
+    Result<void, ErrorUnion<Errc, NotFound>> done = Check(true);
+    EXPECT_TRUE(done.unwrap_err().holds<NotFound>());
+    done = Check(false);
+    EXPECT_TRUE(done.is_ok());
+    static_assert(!std::is_convertible_v<Result<long, Errors>, Result<long, ErrorUnion<NotFound, IoError>>>);
+    static_assert(!std::is_convertible_v<Result<long, Errors>, Result<int, Errors>>);
+}
+
+TEST(ErrorUnionTest, Visit) {
+    const auto describe = [](const auto& err) -> std::string {
+        using E = std::remove_cvref_t<decltype(err)>;
+        if constexpr (std::same_as<E, ParseError>) {
+            return "parse at " + std::to_string(err.pos);
+        } else if constexpr (std::same_as<E, IoError>) {
+            return "io " + err.path;
+        } else {
+            return "not found";
+        }
+    };
+    EXPECT_EQ(Errors(ParseError{3}).visit(describe), "parse at 3");
+    EXPECT_EQ(Errors(IoError{"f"}).visit(describe), "io f");
+    EXPECT_EQ(Errors(NotFound{}).visit(describe), "not found");
+}
+
+TEST(ErrorUnionTest, Equality) {
+    using U = ErrorUnion<int, Errc>;
+    EXPECT_EQ(U(1), U(1));
+    EXPECT_NE(U(1), U(2));
+    EXPECT_NE(U(0), U(Errc::kBusy));
+    EXPECT_EQ(U(Errc::kBusy), Errc::kBusy);
+    EXPECT_NE(U(1), Errc::kBusy);
+}
+
+// --- AndThen widens ---
+
+// clang-format off
+TEST(ErrorUnionTest, AndThenWidens) {
+    auto chain = [](int x) {
+        return Parse(x) | combine::result::AndThen(&Read) | combine::result::AndThen(&Find);
+    };
+    static_assert(std::same_as<decltype(chain(1)), Result<long, Errors>>);
+
+    EXPECT_EQ(chain(3).unwrap_ok(), 6);
+    EXPECT_EQ(chain(-1).unwrap_err().get<ParseError>().pos, -1);
+    EXPECT_EQ(chain(0).unwrap_err().get<IoError>().path, "/dev/zero");
+    EXPECT_TRUE(chain(60).unwrap_err().holds<NotFound>());
+}
+
+TEST(ErrorUnionTest, AndThenKeepsConvertingErrors) {
+    // A stage error the input converts to stays as it was, one that cannot fail keeps the input's
+    auto converted = make::Ok(1) | combine::result::AndThen([](int x) -> Result<int, long> { return make::Ok(x); });
+    static_assert(std::same_as<decltype(converted), Result<int, long>>);
+
+    auto same = Parse(1) | combine::result::AndThen([](int x) -> Result<int, ParseError> { return make::Ok(x); });
+    static_assert(std::same_as<decltype(same), Result<int, ParseError>>);
+
+    auto infallible = Parse(-1) | combine::result::AndThen([](int x) { return make::Ok(x + 1); });
+    static_assert(std::same_as<decltype(infallible), Result<int, ParseError>>);
+    EXPECT_EQ(infallible.unwrap_err().pos, -1);
+
+    // An alternative converts to a union that holds it
+    auto into_union = Parse(-2) | combine::result::AndThen([](int x) -> Result<int, Errors> { return make::Ok(x); });
+    static_assert(std::same_as<decltype(into_union), Result<int, Errors>>);
+    EXPECT_EQ(into_union.unwrap_err().get<ParseError>().pos, -2);
+}
+
+TEST(ErrorUnionTest, LazyPipelineSameAsEager) {
+    const auto pipeline = combine::result::AndThen(&Read)
+        | combine::result::AndThen(&Find)
+        | combine::result::MapErr([](Errors err) { return err.index(); });
+
+    for (int x : {-1, 0, 3, 60}) {
+        auto eager = Parse(x)
+            | combine::result::AndThen(&Read)
+            | combine::result::AndThen(&Find)
+            | combine::result::MapErr([](Errors err) { return err.index(); });
+        auto lazy = Parse(x) | pipeline;
+        static_assert(std::same_as<decltype(eager), decltype(lazy)>);
+        ASSERT_EQ(eager.is_ok(), lazy.is_ok());
+        if (eager.is_ok()) {
+            EXPECT_EQ(eager.unwrap_ok(), lazy.unwrap_ok());
+        } else {
+            EXPECT_EQ(eager.unwrap_err(), lazy.unwrap_err());
+        }
+    }
+
+    // A borrowed source: the error is copied into the union
+    const auto src = Parse(-5);
+    auto borrowed = src | (combine::result::AndThen(&Read) | combine::result::AndThen(&Find));
+    EXPECT_EQ(borrowed.unwrap_err().get<ParseError>().pos, -5);
+    EXPECT_EQ(src.unwrap_err().pos, -5);
+}
+
+// --- Match ---
+
+TEST(ErrorUnionTest, MatchHandlesSomeAlternatives) {
+    auto lookup = [](int x) {
+        return Parse(x)
+            | combine::result::AndThen(&Read)
+            | combine::result::AndThen(&Find)
+            | combine::result::Match([](NotFound) -> Result<long, Errc> { return make::Ok(0L); },
+                                     [](IoError) -> Result<long, Errc> { return make::Err(Errc::kDenied); });
+    };
+    static_assert(std::same_as<decltype(lookup(1)), Result<long, ErrorUnion<ParseError, Errc>>>);
+
+    EXPECT_EQ(lookup(3).unwrap_ok(), 6);
+    EXPECT_EQ(lookup(60).unwrap_ok(), 0);
+    EXPECT_EQ(lookup(0).unwrap_err().get<Errc>(), Errc::kDenied);
+    EXPECT_EQ(lookup(-4).unwrap_err().get<ParseError>().pos, -4);
+}
+
+TEST(ErrorUnionTest, MatchEveryAlternative) {
+    const auto pipeline = combine::result::AndThen(&Read)
+        | combine::result::Match(
+              [](ParseError e) -> Result<long, std::string> { return make::Ok(long{e.pos}); },
+              [](auto other) -> Result<long, std::string> {  // the first handler that takes it wins
+                  if constexpr (std::same_as<decltype(other), IoError>) {
+                      return make::Err(std::move(other.path));
+                  } else {
+                      return make::Err(std::string("?"));
+                  }
+              });
+
+    auto recovered = Parse(-3) | pipeline;
+    static_assert(std::same_as<decltype(recovered), Result<long, std::string>>);
+    EXPECT_EQ(recovered.unwrap_ok(), -3);
+    EXPECT_EQ((Parse(0) | pipeline).unwrap_err(), "/dev/zero");
+    EXPECT_EQ((Parse(4) | pipeline).unwrap_ok(), 8);
+}
+
+TEST(ErrorUnionTest, OrElseOnOneAlternative) {
+    auto chain = [](int x) {
+        return Parse(x)
+            | combine::result::AndThen(&Read)
+            | combine::result::OrElse([](const IoError&) -> Result<long, NotFound> { return make::Err(NotFound{}); });
+    };
+    static_assert(std::same_as<decltype(chain(1)), Result<long, ErrorUnion<ParseError, NotFound>>>);
+    EXPECT_TRUE(chain(0).unwrap_err().holds<NotFound>());
+    EXPECT_EQ(chain(-1).unwrap_err().get<ParseError>().pos, -1);
+
+    const auto pipeline = combine::result::AndThen(&Read)
+        | combine::result::OrElse([](const IoError&) -> Result<long, NotFound> { return make::Ok(-1L); })
+        | combine::result::MapOk([](long v) { return v * 10; });
+    EXPECT_EQ((Parse(0) | pipeline).unwrap_ok(), -10);
+    EXPECT_EQ((Parse(-2) | pipeline).unwrap_err().get<ParseError>().pos, -2);
+}
+
+TEST(ErrorUnionTest, NoStringAllocation) {
+    // The errors keep their types: a union of small errors is as small as they are
+    auto chain = make::Ok(1)
+        | combine::result::AndThen([](int) -> Result<int, Errc> { return make::Err(Errc::kBusy); })
+        | combine::result::AndThen([](int x) -> Result<int, NotFound> { return make::Ok(x); });
+    static_assert(std::same_as<decltype(chain), Result<int, ErrorUnion<Errc, NotFound>>>);
+    static_assert(sizeof(decltype(chain)) <= 2 * sizeof(int));
+    EXPECT_EQ(chain.unwrap_err(), Errc::kBusy);
+}
+// clang-format on
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "TestUtils.hpp"
+
+// BranchHint changes the code layout only: every hint gives the same results
+
+namespace {
+
+template <BranchHint H>
+Result<int, std::string> Eager(int x) {
+    // clang-format off
+    return Result<int, ErrorCode>(make::Ok(int{x}))
+        | combine::result::MapOk<H>([](int v) { return v + 1; })
+        | combine::result::Filter<H>([](int v) { return v % 3 != 0; }, ErrorCode{3, "div3"})
+        | combine::result::AndThen<H>([](int v) -> Result<int, ErrorCode> {
+              if (v > 10) {
+                  return make::Err(ErrorCode{10, "big"});
+              }
+              return make::Ok(v * 2);
+          })
+        | combine::result::OrElse<H>([](ErrorCode e) -> Result<int, ErrorCode> {
+              if (e.code == 3) {
+                  return make::Ok(0);
+              }
+              return make::Err(std::move(e));
+          })
+        | combine::result::MapErr<H>([](ErrorCode e) { return e.msg; });
+    // clang-format on
+}
+
+template <BranchHint H>
+Result<int, std::string> Fused(int x) {
+    // clang-format off
+    static const auto pipeline = combine::result::MapOk<H>([](int v) { return v + 1; })
+        | combine::result::Filter<H>([](int v) { return v % 3 != 0; }, ErrorCode{3, "div3"})
+        | combine::result::AndThen<H>([](int v) -> Result<int, ErrorCode> {
+              if (v > 10) {
+                  return make::Err(ErrorCode{10, "big"});
+              }
+              return make::Ok(v * 2);
+          })
+        | combine::result::OrElse<H>([](ErrorCode e) -> Result<int, ErrorCode> {
+              if (e.code == 3) {
+                  return make::Ok(0);
+              }
+              return make::Err(std::move(e));
+          })
+        | combine::result::MapErr<H>([](ErrorCode e) { return e.msg; });
+    // clang-format on
+    return Result<int, ErrorCode>(make::Ok(int{x})) | pipeline;
+}
+
+std::string Show(const Result<int, std::string>& res) {
+    return res.is_ok() ? std::to_string(res.unwrap_ok()) : res.unwrap_err();
+}
+
+}  // namespace
+
+TEST(ResultHintTest, SameResultsForEveryHint) {
+    for (int x = 0; x < 16; ++x) {
+        const std::string expected = Show(Eager<BranchHint::kErrorsRare>(x));
+        EXPECT_EQ(Show(Eager<BranchHint::kErrorsCommon>(x)), expected) << x;
+        EXPECT_EQ(Show(Eager<BranchHint::kNone>(x)), expected) << x;
+        EXPECT_EQ(Show(Fused<BranchHint::kErrorsRare>(x)), expected) << x;
+        EXPECT_EQ(Show(Fused<BranchHint::kErrorsCommon>(x)), expected) << x;
+        EXPECT_EQ(Show(Fused<BranchHint::kNone>(x)), expected) << x;
+    }
+    EXPECT_EQ(Show(Eager<BranchHint::kErrorsRare>(1)), "4");
+    EXPECT_EQ(Show(Eager<BranchHint::kErrorsRare>(2)), "0");
+    EXPECT_EQ(Show(Eager<BranchHint::kErrorsRare>(12)), "big");
+}
+
+TEST(ResultHintTest, OutlinedErrorPathKeepsMoveCount) {
+    Tracked::Reset();
+    Result<int, Tracked> err = make::Err(Tracked(1));
+    Tracked::Reset();
+
+    auto out = std::move(err) | combine::result::MapOk<BranchHint::kErrorsRare>([](int v) { return v; });
+    EXPECT_EQ(out.unwrap_err().val, 1);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 1);
+}
+
+TEST(ResultHintTest, Constexpr) {
+    constexpr auto res = Result<int, int>(make::Err(5))
+        | combine::result::MapErr<BranchHint::kErrorsRare>([](int e) { return e * 2; })
+        | combine::result::OrElse<BranchHint::kErrorsCommon>([](int e) -> Result<int, int> { return make::Ok(int{e}); });
+    static_assert(res.unwrap_ok() == 10);
+}
+
+// Without custom special members the storage is the bare payload: small trivially copyable
+// results travel in registers
+static_assert(std::is_same_v<detail::ResultStorage<int, long>, detail::ResultPayload<int, long>>);
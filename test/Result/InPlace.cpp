@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <stdexcept>
+#include <utility>
+
+#include "TestUtils.hpp"
+
+// In-place factories and emplace_ok/emplace_err: the payload is constructed directly inside
+// the Result, so neither movable nor copyable payloads are required.
+
+namespace {
+
+struct Frame {
+    std::array<char, 4096> bytes;
+    int id;
+
+    constexpr Frame(int i, char fill) noexcept : bytes(), id(i) {
+        bytes.fill(fill);
+    }
+
+    Frame(const Frame&) = delete;
+    Frame(Frame&&) = delete;
+    Frame& operator=(const Frame&) = delete;
+    Frame& operator=(Frame&&) = delete;
+};
+
+struct ThrowsOnNegative {
+    int val;
+
+    explicit ThrowsOnNegative(int v) : val(v) {
+        if (v < 0) throw std::runtime_error("negative");
+    }
+};
+
+}  // namespace
+
+TEST(ResultInPlaceTest, NonMovableOk) {
+    auto res = make::Ok<Frame, int>(std::in_place, 7, 'x');
+    ASSERT_TRUE(res.is_ok());
+    EXPECT_EQ(res.unwrap_ok().id, 7);
+    EXPECT_EQ(res.unwrap_ok().bytes[4095], 'x');
+}
+
+TEST(ResultInPlaceTest, ErrInPlace) {
+    auto res = make::Err<ErrorCode, Frame>(std::in_place, 3, "bad frame");
+    ASSERT_TRUE(res.is_err());
+    EXPECT_EQ(res.unwrap_err(), (ErrorCode{3, "bad frame"}));
+}
+
+TEST(ResultInPlaceTest, FactoryMoves) {
+    Tracked::Reset();
+    auto r1 = make::Ok<Tracked, int>(std::in_place, 1);
+    auto r2 = make::Err<Tracked, int>(std::in_place, 2);
+    EXPECT_EQ(r1.unwrap_ok().val, 1);
+    EXPECT_EQ(r2.unwrap_err().val, 2);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);
+
+    // Without E the Result is pending and the upgrade moves once, as with make::Ok(T)
+    Tracked::Reset();
+    Result<Tracked, int> r3 = make::Ok<Tracked>(std::in_place, 3);
+    EXPECT_EQ(r3.unwrap_ok().val, 3);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 1);
+}
+
+TEST(ResultInPlaceTest, NonMovableFromCombinators) {
+    auto mapped = make::Ok<int, int>(std::in_place, 5) |
+                  combine::result::MapOk([](int v) { return Frame(v, 'm'); });
+    EXPECT_EQ(mapped.unwrap_ok().id, 5);
+
+    auto chained = make::Ok<int, int>(std::in_place, 6) | combine::result::AndThen([](int v) {
+                       return make::Ok<Frame, int>(std::in_place, v, 'a');
+                   });
+    EXPECT_EQ(chained.unwrap_ok().id, 6);
+}
+
+TEST(ResultInPlaceTest, EmplaceSwitchesAlternative) {
+    auto res = make::Ok<int, ErrorCode>(std::in_place, 1);
+
+    ErrorCode& err = res.emplace_err(404, "not found");
+    EXPECT_TRUE(res.is_err());
+    EXPECT_EQ(&err, &res.unwrap_err());
+    EXPECT_EQ(err, (ErrorCode{404, "not found"}));
+
+    res.emplace_err(500, "internal");
+    EXPECT_EQ(res.unwrap_err().code, 500);
+
+    int& val = res.emplace_ok(42);
+    EXPECT_TRUE(res.is_ok());
+    EXPECT_EQ(val, 42);
+}
+
+TEST(ResultInPlaceTest, EmplaceNonMovable) {
+    auto res = make::Ok<Frame, int>(std::in_place, 1, 'a');
+    res.emplace_ok(2, 'b');
+    EXPECT_EQ(res.unwrap_ok().id, 2);
+
+    res.emplace_err(-1);
+    EXPECT_EQ(res.unwrap_err(), -1);
+
+    res.emplace_ok(3, 'c');
+    EXPECT_EQ(res.unwrap_ok().bytes[0], 'c');
+}
+
+TEST(ResultInPlaceTest, EmplaceMoves) {
+    auto res = make::Ok<Tracked, Tracked>(std::in_place, 1);
+
+    // A constructor that may throw is run into a temporary first (strong guarantee)
+    Tracked::Reset();
+    res.emplace_err(2);
+    EXPECT_EQ(res.unwrap_err().val, 2);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 1);
+
+    auto frame = make::Ok<Frame, Tracked>(std::in_place, 1, 'a');
+    Tracked::Reset();
+    frame.emplace_err(5);
+    frame.emplace_ok(2, 'b');  // Frame(int, char) is noexcept: no temporary
+    EXPECT_EQ(frame.unwrap_ok().id, 2);
+    EXPECT_EQ(Tracked::moves, 1);
+}
+
+TEST(ResultInPlaceTest, EmplaceThrowKeepsOldValue) {
+    auto res = make::Ok<int, ThrowsOnNegative>(std::in_place, 10);
+    EXPECT_THROW(res.emplace_err(-1), std::runtime_error);
+    ASSERT_TRUE(res.is_ok());
+    EXPECT_EQ(res.unwrap_ok(), 10);
+}
+
+TEST(ResultInPlaceTest, Constexpr) {
+    constexpr auto kRes = [] {
+        auto res = make::Ok<int, int>(std::in_place, 1);
+        res.emplace_err(2);
+        res.emplace_ok(res.unwrap_err() + 40);
+        return res;
+    }();
+    static_assert(kRes.unwrap_ok() == 42);
+
+    static_assert([] {
+        auto res = make::Ok<Frame, int>(std::in_place, 9, 'z');
+        return res.unwrap_ok().id;
+    }() == 9);
+}
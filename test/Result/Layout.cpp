@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <eav/Concepts/TriviallyRelocatable.hpp>
+
+#include "TestUtils.hpp"
+
+struct NotFound {};
+
+enum class ErrCode : std::uint8_t { Timeout,
+                                    Refused };
+
+struct ThrowingCopy {
+    int val;
+
+    ThrowingCopy(int v) : val(v) {}
+
+    ThrowingCopy(const ThrowingCopy& oth) : val(oth.val) {
+        if (val < 0) throw std::runtime_error("copy");
+    }
+
+    ThrowingCopy(ThrowingCopy&&) noexcept = default;
+
+    ThrowingCopy& operator=(const ThrowingCopy&) = default;
+};
+
+// --- sizeof for common pairs: 1-byte tag in the tail of the largest alternative ---
+static_assert(sizeof(Result<int, int>) == 2 * sizeof(int));
+static_assert(sizeof(Result<std::uint8_t, ErrCode>) == 2);
+static_assert(sizeof(Result<int, ErrCode>) == 2 * sizeof(int));
+static_assert(sizeof(Result<double, int>) == 2 * sizeof(double));
+static_assert(sizeof(Result<int*, ErrCode>) == 2 * sizeof(int*));
+static_assert(sizeof(Result<std::string, int>) == sizeof(std::string) + alignof(std::string));
+static_assert(sizeof(Result<std::unique_ptr<int>, std::string>) == sizeof(std::string) + alignof(std::string));
+
+// --- niche packing: stateless alternative lives in the niche of the other one, if no valid ---
+// --- value holds it                                                                        ---
+static_assert(sizeof(Result<std::reference_wrapper<int>, NotFound>) == sizeof(int*));
+static_assert(sizeof(Result<NotFound, std::reference_wrapper<const char>>) == sizeof(const char*));
+
+// nullptr and the NaN of Option's niche are valid payloads: a tag is kept
+static_assert(sizeof(Result<int*, NotFound>) == 2 * sizeof(int*));
+static_assert(sizeof(Result<std::unique_ptr<int>, NotFound>) == 2 * sizeof(std::unique_ptr<int>));
+static_assert(sizeof(Result<NotFound, const char*>) == 2 * sizeof(const char*));
+static_assert(sizeof(Result<double, NotFound>) == 2 * sizeof(double));
+
+// --- PendingType never takes part in niche packing ---
+static_assert(sizeof(Result<int*, detail::PendingType>) == 2 * sizeof(int*));
+
+// --- triviality follows the alternatives ---
+static_assert(std::is_trivially_copyable_v<Result<int, ErrCode>>);
+static_assert(std::is_trivially_destructible_v<Result<int, ErrCode>>);
+static_assert(std::is_trivially_copyable_v<Result<int*, NotFound>>);
+static_assert(!std::is_trivially_destructible_v<Result<std::string, int>>);
+static_assert(std::is_copy_constructible_v<Result<std::string, int>>);
+static_assert(!std::is_copy_constructible_v<Result<std::unique_ptr<int>, int>>);
+static_assert(std::is_move_constructible_v<Result<std::unique_ptr<int>, int>>);
+static_assert(std::is_nothrow_move_constructible_v<Result<std::string, int>>);
+static_assert(std::is_nothrow_move_assignable_v<Result<std::string, int>>);
+
+// --- trivially relocatable: trivially copyable or opted in ---
+static_assert(concepts::TriviallyRelocatable<Result<int, ErrCode>>);
+static_assert(concepts::TriviallyRelocatable<Result<std::unique_ptr<int>, ErrCode>>);
+static_assert(concepts::TriviallyRelocatable<Result<std::unique_ptr<int>, std::shared_ptr<int>>>);
+static_assert(!concepts::TriviallyRelocatable<Result<std::string, int>>);
+
+// clang-format off
+TEST(ResultLayoutTest, AssignAcrossAlternatives) {
+    Result<std::string, int> r = make::Ok(std::string("value"));
+    Result<std::string, int> e = make::Err(7);
+
+    r = e;
+    EXPECT_TRUE(r.is_err());
+    EXPECT_EQ(r.unwrap_err(), 7);
+
+    e = Result<std::string, int>(make::Ok(std::string("other")));
+    EXPECT_TRUE(e.is_ok());
+    EXPECT_EQ(e.unwrap_ok(), "other");
+}
+
+TEST(ResultLayoutTest, NeverValueless) {
+    Result<ThrowingCopy, int> r = make::Err(1);
+    const Result<ThrowingCopy, int> bad = make::Ok(ThrowingCopy(-1));
+
+    EXPECT_THROW(r = bad, std::runtime_error);
+    EXPECT_TRUE(r.is_err());
+    EXPECT_EQ(r.unwrap_err(), 1);
+}
+
+TEST(ResultLayoutTest, ErrInNicheOfOk) {
+    int x = 5;
+    Result<std::reference_wrapper<int>, NotFound> ok = make::Ok(std::ref(x));
+    Result<std::reference_wrapper<int>, NotFound> err = make::Err(NotFound{});
+
+    EXPECT_TRUE(ok.is_ok());
+    EXPECT_EQ(ok.unwrap_ok().get(), 5);
+    EXPECT_TRUE(err.is_err());
+
+    auto res = std::move(ok)
+        | combine::result::MapOk([](int& v) { return v * 2; });
+    EXPECT_EQ(res.unwrap_ok(), 10);
+}
+
+TEST(ResultLayoutTest, OkInNicheOfErr) {
+    static const char boom = '!';
+    Result<NotFound, std::reference_wrapper<const char>> ok = make::Ok(NotFound{});
+    Result<NotFound, std::reference_wrapper<const char>> err = make::Err(std::cref(boom));
+
+    EXPECT_TRUE(ok.is_ok());
+    EXPECT_TRUE(err.is_err());
+    EXPECT_EQ(err.unwrap_err().get(), '!');
+}
+
+TEST(ResultLayoutTest, NullIsAValue) {
+    Result<int*, NotFound> ok = make::Ok(static_cast<int*>(nullptr));
+    EXPECT_TRUE(ok.is_ok());
+    EXPECT_EQ(ok.unwrap_ok(), nullptr);
+
+    Result<NotFound, int*> err = make::Err(static_cast<int*>(nullptr));
+    EXPECT_TRUE(err.is_err());
+    EXPECT_EQ(err.unwrap_err(), nullptr);
+
+    // A moved-from unique_ptr is still the Ok that held it
+    Result<std::unique_ptr<int>, NotFound> owner = make::Ok(std::make_unique<int>(3));
+    Result<std::unique_ptr<int>, NotFound> taken = std::move(owner);
+    EXPECT_TRUE(owner.is_ok());  // NOLINT: use after move is the point
+    EXPECT_EQ(owner.unwrap_ok(), nullptr);
+    EXPECT_EQ(*taken.unwrap_ok(), 3);
+
+    auto round_trip = std::move(owner) | combine::result::MapOk([](std::unique_ptr<int> p) { return p == nullptr; });
+    EXPECT_TRUE(round_trip.unwrap_ok());
+
+    const double nan = NicheTraits<double>::none();
+    Result<double, NotFound> reserved = make::Ok(double{nan});
+    EXPECT_TRUE(reserved.is_ok());
+}
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <utility>
+
+#include "TestUtils.hpp"
+
+// Exact copy/move counts of the payload for every combinator: a combinator only moves a
+// value when it has to hand it over to a Result of another type, values computed by a
+// user function are constructed in place.
+// The user functions below take Tracked&& and return a fresh prvalue: they add no moves.
+
+namespace {
+
+Result<Tracked, Tracked> OkSrc(int v) {
+    return make::Ok(Tracked(v));
+}
+
+Result<Tracked, Tracked> ErrSrc(int v) {
+    return make::Err(Tracked(v));
+}
+
+const auto kPositive = [](const Tracked& t) { return t.val > 0; };
+
+}  // namespace
+
+// clang-format off
+TEST(ResultMovesTest, MapOk) {
+    auto ok = OkSrc(1);
+    Tracked::Reset();
+    auto r1 = std::move(ok) | combine::result::MapOk([](Tracked&& t) { return Tracked(t.val + 1); });
+    EXPECT_EQ(r1.unwrap_ok().val, 2);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);  // in place
+
+    auto err = ErrSrc(1);
+    Tracked::Reset();
+    auto r2 = std::move(err) | combine::result::MapOk([](Tracked&& t) { return t.val; });
+    EXPECT_TRUE(r2.is_err());
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 1);  // error into Result<int, Tracked>
+}
+
+TEST(ResultMovesTest, MapErr) {
+    auto err = ErrSrc(1);
+    Tracked::Reset();
+    auto r1 = std::move(err) | combine::result::MapErr([](Tracked&& t) { return Tracked(t.val + 1); });
+    EXPECT_EQ(r1.unwrap_err().val, 2);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);  // in place
+
+    auto ok = OkSrc(1);
+    Tracked::Reset();
+    auto r2 = std::move(ok) | combine::result::MapErr([](Tracked&& t) { return t.val; });
+    EXPECT_TRUE(r2.is_ok());
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 1);  // value into Result<Tracked, int>
+}
+
+TEST(ResultMovesTest, AndThen) {
+    const auto step = [](Tracked&& t) -> Result<int, Tracked> { return make::Ok(int{t.val}); };
+
+    auto ok = OkSrc(1);
+    Tracked::Reset();
+    auto r1 = std::move(ok) | combine::result::AndThen(step);
+    EXPECT_EQ(r1.unwrap_ok(), 1);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);
+
+    auto err = ErrSrc(1);
+    Tracked::Reset();
+    auto r2 = std::move(err) | combine::result::AndThen(step);
+    EXPECT_TRUE(r2.is_err());
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 1);
+}
+
+TEST(ResultMovesTest, OrElse) {
+    const auto recover = [](Tracked&& e) -> Result<Tracked, int> { return make::Err(int{e.val}); };
+
+    auto err = ErrSrc(1);
+    Tracked::Reset();
+    auto r1 = std::move(err) | combine::result::OrElse(recover);
+    EXPECT_EQ(r1.unwrap_err(), 1);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);
+
+    auto ok = OkSrc(1);
+    Tracked::Reset();
+    auto r2 = std::move(ok) | combine::result::OrElse(recover);
+    EXPECT_TRUE(r2.is_ok());
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 1);
+}
+
+TEST(ResultMovesTest, Filter) {
+    Result<Tracked, int> pass = make::Ok(Tracked(1));
+    Tracked::Reset();
+    auto r1 = std::move(pass) | combine::result::Filter(kPositive, int{0});
+    EXPECT_TRUE(r1.is_ok());
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 1);  // the Result itself is moved
+
+    Result<Tracked, int> fail = make::Ok(Tracked(-1));
+    Tracked::Reset();
+    auto r2 = std::move(fail) | combine::result::Filter(kPositive, int{0});
+    EXPECT_TRUE(r2.is_err());
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);
+
+    auto pending = make::Ok(Tracked(1));
+    Tracked::Reset();
+    auto r3 = std::move(pending) | combine::result::Filter(kPositive, int{0});
+    EXPECT_TRUE(r3.is_ok());
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 1);  // Result<Tracked, ?> -> Result<Tracked, int>
+}
+
+TEST(ResultMovesTest, Accessors) {
+    auto ok = OkSrc(1);
+    Tracked::Reset();
+    Tracked val = std::move(ok).unwrap_ok();
+    EXPECT_EQ(val.val, 1);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 1);
+
+    auto ok2 = OkSrc(2);
+    Tracked::Reset();
+    auto opt = std::move(ok2).erase_err();
+    EXPECT_EQ(opt.unwrap().val, 2);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 1);
+}
+
+TEST(ResultMovesTest, FusedPipeline) {
+    const auto pipeline = combine::result::Filter(kPositive, Tracked(0))
+        | combine::result::MapOk([](Tracked&& t) { return Tracked(t.val + 1); })
+        | combine::result::Filter(kPositive, Tracked(0))
+        | combine::result::MapOk([](Tracked&& t) { return Tracked(t.val * 10); });
+
+    auto ok = OkSrc(1);
+    Tracked::Reset();
+    auto r1 = std::move(ok) | pipeline;
+    EXPECT_EQ(r1.unwrap_ok().val, 20);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);  // intermediates by reference, last value in place
+
+    auto fail = OkSrc(-1);
+    Tracked::Reset();
+    auto r2 = std::move(fail) | pipeline;
+    EXPECT_EQ(r2.unwrap_err().val, 0);
+    EXPECT_EQ(Tracked::copies, 1);  // else_err_ of the reusable stage
+    EXPECT_EQ(Tracked::moves, 1);   // from the first stage into the final Result
+}
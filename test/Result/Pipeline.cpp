@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "TestUtils.hpp"
+
+// clang-format off
+TEST(ResultPipelineTest, ComposeThenApply) {
+    auto pipeline = combine::result::MapOk([](int x) { return x * 10; })
+        | combine::result::Filter([](int x) { return x > 40; }, std::string("too small"))
+        | combine::result::AndThen([](int x) -> Result<int, std::string> { return make::Ok(x + 5); })
+        | combine::result::MapErr([](std::string s) { return s.length(); });
+
+    auto ok = make::Ok(5) | pipeline;
+    auto err = make::Ok(1) | pipeline;
+
+    static_assert(std::same_as<decltype(ok), Result<int, size_t>>);
+    EXPECT_EQ(ok.unwrap_ok(), 55);
+    EXPECT_EQ(err.unwrap_err(), 9u);
+}
+
+TEST(ResultPipelineTest, SameResultAsEagerChain) {
+    using namespace std::string_literals;
+
+    auto eager = make::Ok(5)
+        | combine::result::MapOk([](int x) { return x * 10; })
+        | combine::result::Filter([](int x) { return x < 50; }, "Triggered"s)
+        | combine::result::MapErr([](const std::string& s) { return s.length(); })
+        | combine::result::OrElse([](size_t len) { return make::Ok(static_cast<int>(len)); })
+        | combine::result::MapOk([](int x) { return x * 2; });
+
+    const auto pipeline = combine::result::MapOk([](int x) { return x * 10; })
+        | combine::result::Filter([](int x) { return x < 50; }, "Triggered"s)
+        | combine::result::MapErr([](const std::string& s) { return s.length(); })
+        | combine::result::OrElse([](size_t len) { return make::Ok(static_cast<int>(len)); })
+        | combine::result::MapOk([](int x) { return x * 2; });
+    auto lazy = make::Ok(5) | pipeline;
+
+    static_assert(std::same_as<decltype(eager), decltype(lazy)>);
+    EXPECT_EQ(eager.unwrap_ok(), lazy.unwrap_ok());
+}
+
+TEST(ResultPipelineTest, FilterKeepsAnErrLikeTheEagerChain) {
+    // An Err keeps its error through Filter, applied at once or fused
+    const auto eager = [](Result<int, std::string> in) {
+        return std::move(in)
+            | combine::result::MapOk([](int x) { return x * 2; })
+            | combine::result::Filter([](int x) { return x > 0; }, std::string("filtered"));
+    };
+    const auto pipeline = combine::result::MapOk([](int x) { return x * 2; })
+        | combine::result::Filter([](int x) { return x > 0; }, std::string("filtered"));
+
+    Result<int, std::string> err = make::Err(std::string("orig"));
+    auto lazy = Result<int, std::string>(err) | pipeline;
+    static_assert(std::same_as<decltype(eager(err)), decltype(lazy)>);
+    EXPECT_EQ(eager(err).unwrap_err(), "orig");
+    EXPECT_EQ(lazy.unwrap_err(), "orig");
+
+    // A rejected value gets the stage's error on both paths
+    EXPECT_EQ(eager(make::Ok(-1)).unwrap_err(), "filtered");
+    EXPECT_EQ((make::Ok(-1) | pipeline).unwrap_err(), "filtered");
+}
+
+TEST(ResultPipelineTest, ReusableAndShortCircuits) {
+    static int calls = 0;
+    static const auto pipeline = combine::result::Filter([](int x) { return x % 2 == 0; }, std::string("odd"))
+        | combine::result::MapOk([](int x) { ++calls; return x / 2; });
+
+    for (int i = 0; i < 10; ++i) {
+        Result<int, std::string> in = make::Ok(int{i});
+        auto out = std::move(in) | pipeline;
+        EXPECT_EQ(out.is_ok(), i % 2 == 0);
+    }
+    EXPECT_EQ(calls, 5);
+
+    Result<int, std::string> in = make::Err(std::string("input"));
+    EXPECT_EQ((std::move(in) | pipeline).unwrap_err(), "input");
+    EXPECT_EQ(calls, 5);
+}
+
+TEST(ResultPipelineTest, ExtendPipeline) {
+    auto first = combine::result::MapOk([](int x) { return x + 1; })
+        | combine::result::MapOk([](int x) { return x * 2; });
+    auto second = combine::result::MapOk([](int x) { return std::to_string(x); })
+        | combine::result::MapErr([](int code) { return std::to_string(code); });
+
+    auto res = make::Ok(1) | (first | second);
+    EXPECT_EQ(res.unwrap_ok(), "4");
+
+    Result<int, int> err = make::Err(7);
+    EXPECT_EQ((std::move(err) | (first | second)).unwrap_err(), "7");
+}
+
+namespace {
+
+// Every stage is built from a local lvalue callable that owns heap memory: the returned
+// pipeline must hold copies, not references to the locals
+auto MakeStoredPipeline() {
+    auto add = [s = std::string(40, 'x')](int x) { return x + static_cast<int>(s.size()); };
+    auto step = [s = std::string(40, 'y')](int x) -> Result<int, std::string> {
+        if (x > 1000) {
+            return make::Err(std::string(s));
+        }
+        return make::Ok(x + static_cast<int>(s.size()));
+    };
+    auto recover = [s = std::string(40, 'z')](const std::string& e) -> Result<int, std::string> {
+        return make::Ok(static_cast<int>(e.size() + s.size()));
+    };
+    auto small = [s = std::string(40, 'w')](int x) { return x < static_cast<int>(s.size()) * 10; };
+    auto describe = [s = std::string(40, 'v')](std::string e) { return s.substr(0, 1) + e; };
+    return combine::result::MapOk(add)
+        | combine::result::AndThen(step)
+        | combine::result::Filter(small, std::string("big"))
+        | combine::result::MapErr(describe)
+        | combine::result::OrElse(recover);
+}
+
+}  // namespace
+
+TEST(ResultPipelineTest, StoredPipelineOwnsItsFunctions) {
+    const auto pipeline = MakeStoredPipeline();
+    EXPECT_EQ((make::Ok(1) | pipeline).unwrap_ok(), 81);
+    EXPECT_EQ((make::Ok(1000) | pipeline).unwrap_ok(), 81);  // step fails: 'v' + 40 'y', + 40
+    EXPECT_EQ((make::Ok(350) | pipeline).unwrap_ok(), 44);   // rejected: "vbig", + 40
+
+    // An lvalue callable is copied, not moved from
+    auto keep = [s = std::string(40, 'k')](int x) { return x + static_cast<int>(s.size()); };
+    const auto once = combine::result::MapOk(keep) | combine::result::MapOk(keep);
+    EXPECT_EQ(keep(0), 40);
+    EXPECT_EQ((make::Ok(0) | once).unwrap_ok(), 80);
+}
+
+TEST(ResultPipelineTest, SingleMaterialization) {
+    const auto pass = [](const Tracked& t) { return t.val > 0; };
+    const auto pipeline = combine::result::Filter(pass, std::string("e"))
+        | combine::result::Filter(pass, std::string("e"))
+        | combine::result::Filter(pass, std::string("e"))
+        | combine::result::Filter(pass, std::string("e"))
+        | combine::result::Filter(pass, std::string("e"));
+
+    Result<Tracked, std::string> src = make::Ok(Tracked(1));
+    Tracked::Reset();
+    auto lazy = std::move(src) | pipeline;
+    EXPECT_EQ(lazy.unwrap_ok().val, 1);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 1);  // into the final Result only
+
+    Result<Tracked, std::string> src2 = make::Ok(Tracked(1));
+    Tracked::Reset();
+    auto eager = std::move(src2)
+        | combine::result::Filter(pass, std::string("e"))
+        | combine::result::Filter(pass, std::string("e"))
+        | combine::result::Filter(pass, std::string("e"))
+        | combine::result::Filter(pass, std::string("e"))
+        | combine::result::Filter(pass, std::string("e"));
+    EXPECT_EQ(eager.unwrap_ok().val, 1);
+    EXPECT_GE(Tracked::moves, 5);  // at least one per stage
+}
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <utility>
+
+#include "TestUtils.hpp"
+
+// Result<T&, E>: refers to an existing object, stored as a pointer
+
+namespace {
+
+struct NotFound {};
+
+std::map<int, Tracked>& Table() {
+    static std::map<int, Tracked> table{{1, Tracked(10)}, {2, Tracked(20)}};
+    return table;
+}
+
+Result<Tracked&, NotFound> Lookup(int key) {
+    auto it = Table().find(key);
+    if (it == Table().end()) {
+        return make::Err(NotFound{});
+    }
+    return make::OkRef(it->second);
+}
+
+}  // namespace
+
+// the stateless error is the null pointer:
+static_assert(sizeof(Result<int&, NotFound>) == sizeof(int*));
+static_assert(sizeof(Result<const std::string&, NotFound>) == sizeof(std::string*));
+static_assert(std::is_trivially_copyable_v<Result<int&, NotFound>>);
+
+// Ok(lvalue) copies, OkRef(lvalue) refers:
+static_assert(std::same_as<decltype(make::Ok(std::declval<int&>())), Result<int, detail::PendingType>>);
+static_assert(std::same_as<decltype(make::OkRef(std::declval<int&>())), Result<int&, detail::PendingType>>);
+
+TEST(ResultRefTest, AccessorsReferToTheObject) {
+    Table();  // filling the table copies
+    Tracked::Reset();
+    auto res = Lookup(1);
+    ASSERT_TRUE(res.is_ok());
+    EXPECT_EQ(&res.unwrap_ok(), &Table().at(1));
+    EXPECT_EQ(&std::as_const(res).unwrap_ok(), &Table().at(1));
+    EXPECT_EQ(&std::move(res).unwrap_ok(), &Table().at(1));
+    EXPECT_EQ(Tracked::copies + Tracked::moves, 0);
+
+    Lookup(2).unwrap_ok().val = 21;
+    EXPECT_EQ(Table().at(2).val, 21);
+
+    EXPECT_TRUE(Lookup(3).is_err());
+    EXPECT_THROW(Lookup(3).unwrap_ok(), std::runtime_error);
+}
+
+TEST(ResultRefTest, EmplaceAndAssignmentRebind) {
+    int a = 1;
+    int b = 2;
+    Result<int&, std::string> res = make::OkRef(a);
+    res.emplace_ok(b) = 3;
+    EXPECT_EQ(a, 1);
+    EXPECT_EQ(b, 3);
+
+    res = make::Err(std::string("gone"));
+    EXPECT_EQ(res.unwrap_err(), "gone");
+    res = make::OkRef(a);
+    EXPECT_EQ(&res.unwrap_ok(), &a);
+}
+
+TEST(ResultRefTest, UnwrapOkOrReturnsTheFallbackObject) {
+    int fallback = 0;
+    Result<int&, NotFound> none = make::Err(NotFound{});
+    EXPECT_EQ(&none.unwrap_ok_or(fallback), &fallback);
+}
+
+TEST(ResultRefTest, Combinators) {
+    Table();  // filling the table copies
+    Tracked::Reset();
+    auto val = Lookup(1)
+        | combine::result::Filter([](const Tracked& t) { return t.val > 0; }, NotFound{})
+        | combine::result::MapOk([](Tracked& t) { return t.val; });
+    EXPECT_EQ(val.unwrap_ok(), 10);
+
+    // a function returning a reference keeps the chain referring
+    auto self = Lookup(2) | combine::result::MapOk([](Tracked& t) -> Tracked& { return t; });
+    static_assert(std::same_as<decltype(self), Result<Tracked&, NotFound>>);
+    EXPECT_EQ(&self.unwrap_ok(), &Table().at(2));
+
+    auto next = Lookup(1) | combine::result::AndThen([](Tracked& t) { return Lookup(t.val); });
+    EXPECT_TRUE(next.is_err());
+    EXPECT_EQ(Tracked::copies + Tracked::moves, 0);
+}
+
+TEST(ResultRefTest, LazyPipeline) {
+    Table();  // filling the table copies
+    Tracked::Reset();
+    const auto pipeline = combine::result::AndThen([](Tracked& t) { return Lookup(t.val / 10); })
+        | combine::result::MapOk([](Tracked& t) -> Tracked& { return t; })
+        | combine::result::MapErr([](NotFound) { return std::string("missing"); });
+
+    auto found = Lookup(1) | pipeline;
+    static_assert(std::same_as<decltype(found), Result<Tracked&, std::string>>);
+    EXPECT_EQ(&found.unwrap_ok(), &Table().at(1));
+    EXPECT_EQ((Lookup(2) | pipeline).unwrap_ok().val, Table().at(2).val);
+    EXPECT_EQ((Lookup(7) | pipeline).unwrap_err(), "missing");
+    EXPECT_EQ(Tracked::copies + Tracked::moves, 0);
+}
+
+TEST(ResultRefTest, EraseErr) {
+    auto opt = Lookup(1).erase_err();
+    static_assert(std::same_as<decltype(opt), Option<Tracked&>>);
+    EXPECT_EQ(opt.ptr(), &Table().at(1));
+    EXPECT_EQ(Lookup(5).erase_err().ptr(), nullptr);
+}
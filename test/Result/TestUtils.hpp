@@ -16,3 +16,38 @@ struct ErrorCode {
 };
 
 static_assert(concepts::IsError<ErrorCode>);
+
+// Payload that counts its copies and moves
+struct Tracked {
+    static inline int copies = 0;
+    static inline int moves = 0;
+
+    int val;
+
+    static void Reset() {
+        copies = 0;
+        moves = 0;
+    }
+
+    Tracked(int v) : val(v) {}
+
+    Tracked(const Tracked& oth) : val(oth.val) {
+        ++copies;
+    }
+
+    Tracked(Tracked&& oth) noexcept : val(oth.val) {
+        ++moves;
+    }
+
+    Tracked& operator=(const Tracked& oth) {
+        val = oth.val;
+        ++copies;
+        return *this;
+    }
+
+    Tracked& operator=(Tracked&& oth) noexcept {
+        val = oth.val;
+        ++moves;
+        return *this;
+    }
+};
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <eav/Traverse.hpp>
+
+#include "TestUtils.hpp"
+
+namespace {
+
+std::vector<int> Iota(int n) {
+    std::vector<int> out(static_cast<std::size_t>(n));
+    for (int i = 0; i < n; ++i) out[static_cast<std::size_t>(i)] = i;
+    return out;
+}
+
+// Fails on the listed inputs, Ok(to_string(x)) otherwise
+auto FailOn(std::vector<int> bad) {
+    return [bad](int x) -> Result<std::string, ErrorCode> {
+        for (int b : bad) {
+            if (x == b) return make::Err(ErrorCode{x, "bad"});
+        }
+        return make::Ok(std::to_string(x));
+    };
+}
+
+}  // namespace
+
+TEST(ResultTraverseTest, AllOk) {
+    exec::ThreadPool pool(4);
+    const auto in = Iota(5000);
+    for (auto res : {combine::result::Traverse(in, FailOn({})),
+                     combine::result::Traverse(exec::par.on(pool).with_chunk(7), in, FailOn({}))}) {
+        const auto& values = res.unwrap_ok();
+        ASSERT_EQ(values.size(), in.size());
+        EXPECT_EQ(values[0], "0");
+        EXPECT_EQ(values[4999], "4999");
+    }
+}
+
+TEST(ResultTraverseTest, FirstErrorInInputOrder) {
+    exec::ThreadPool pool(4);
+    const auto in = Iota(5000);
+    const auto f = FailOn({4000, 1234, 3000});
+    EXPECT_EQ(combine::result::Traverse(in, f).unwrap_err().code, 1234);
+    for (int run = 0; run < 20; ++run) {
+        auto res = combine::result::Traverse(exec::par.on(pool).with_chunk(16), in, f);
+        ASSERT_EQ(res.unwrap_err().code, 1234);
+    }
+}
+
+TEST(ResultTraverseTest, StopsSchedulingAfterError) {
+    exec::ThreadPool pool(2);
+    std::atomic<int> calls{0};
+    const auto in = Iota(100'000);
+    auto res = combine::result::Traverse(exec::par.on(pool).with_chunk(64), in, [&](int x) -> Result<int, int> {
+        calls.fetch_add(1, std::memory_order_relaxed);
+        if (x == 10) return make::Err(int{x});
+        return make::Ok(int{x});
+    });
+    EXPECT_EQ(res.unwrap_err(), 10);
+    EXPECT_LT(calls.load(), 100'000);
+}
+
+TEST(ResultTraverseTest, AllErrors) {
+    exec::ThreadPool pool(4);
+    const auto in = Iota(1000);
+    const auto f = FailOn({900, 5, 300});
+    for (auto res : {combine::result::TraverseAll(in, f),
+                     combine::result::TraverseAll(exec::par.on(pool).with_chunk(3), in, f)}) {
+        const auto& errors = res.unwrap_err();
+        ASSERT_EQ(errors.size(), 3u);
+        EXPECT_EQ(errors[0].code, 5);
+        EXPECT_EQ(errors[1].code, 300);
+        EXPECT_EQ(errors[2].code, 900);
+    }
+    EXPECT_EQ(combine::result::TraverseAll(exec::par.on(pool), in, FailOn({})).unwrap_ok().size(), 1000u);
+}
+
+TEST(ResultTraverseTest, InputRangeSequential) {
+    const std::list<int> in{1, 2, 3};
+    auto res = combine::result::Traverse(in, [](int x) -> Result<int, int> { return make::Ok(x * 2); });
+    EXPECT_EQ(res.unwrap_ok(), (std::vector<int>{2, 4, 6}));
+}
+
+TEST(ResultTraverseTest, NonDefaultConstructibleValues) {
+    exec::ThreadPool pool(4);
+    const auto in = Iota(1000);
+    auto res = combine::result::Traverse(exec::par.on(pool).with_chunk(5), in, [](int x) -> Result<Tracked, int> {
+        return make::Ok(Tracked(x));
+    });
+    const auto& values = res.unwrap_ok();
+    ASSERT_EQ(values.size(), 1000u);
+    EXPECT_EQ(values[999].val, 999);
+}
+
+TEST(ResultTraverseTest, Collect) {
+    exec::ThreadPool pool(2);
+    std::vector<Result<std::string, int>> rows;
+    rows.push_back(make::Ok<std::string, int>(std::in_place, "a"));
+    rows.push_back(make::Ok<std::string, int>(std::in_place, "b"));
+
+    EXPECT_EQ(combine::result::Collect(rows).unwrap_ok(), (std::vector<std::string>{"a", "b"}));
+    EXPECT_EQ(rows[0].unwrap_ok(), "a");  // lvalue range: copied
+
+    auto moved = combine::result::Collect(exec::par.on(pool).with_chunk(1), std::move(rows));
+    EXPECT_EQ(moved.unwrap_ok().size(), 2u);
+
+    std::vector<Result<int, int>> mixed;
+    mixed.push_back(make::Ok<int, int>(std::in_place, 1));
+    mixed.push_back(make::Err<int, int>(std::in_place, 2));
+    mixed.push_back(make::Err<int, int>(std::in_place, 3));
+    EXPECT_EQ(combine::result::Collect(mixed).unwrap_err(), 2);
+    EXPECT_EQ(combine::result::CollectAll(mixed).unwrap_err(), (std::vector<int>{2, 3}));
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+
+#include <eav/Try.hpp>
+
+#include "TestUtils.hpp"
+
+namespace {
+
+Result<int, ErrorCode> Parse(int x) {
+    if (x < 0) {
+        return make::Err(ErrorCode{x, "negative"});
+    }
+    return make::Ok(int{x});
+}
+
+int g_steps = 0;
+
+Result<std::string, ErrorCode> Chain(int a, int b) {
+    ++g_steps;
+    const int x = EAV_TRY(Parse(a));
+    ++g_steps;
+    const int y = EAV_TRY(Parse(b));
+    ++g_steps;
+    return make::Ok(std::to_string(x + y));
+}
+
+Result<std::string, ErrorCode> ChainAssign(int a, int b) {
+    EAV_TRY_ASSIGN(const int x, Parse(a));
+    EAV_TRY_ASSIGN(const int y, Parse(b));
+    return make::Ok(std::to_string(x + y));
+}
+
+struct Wide {
+    ErrorCode inner;
+
+    Wide(ErrorCode e) : inner(std::move(e)) {}  // NOLINT: implicit on purpose
+};
+
+// The error is converted to the enclosing function's error type
+Result<int, Wide> Widened(int a) {
+    return make::Ok(EAV_TRY(Parse(a)) * 2);
+}
+
+Result<void, ErrorCode> Check(int x) {
+    if (x < 0) {
+        return make::Err(ErrorCode{x, "negative"});
+    }
+    return make::Ok();
+}
+
+Result<int, ErrorCode> CheckedSum(int a, int b) {
+    EAV_TRY(Check(a));
+    EAV_TRY(Check(b));
+    return make::Ok(a + b);
+}
+
+Result<void, Wide> CheckedWide(int a) {
+    EAV_TRY(Check(a));
+    return make::Ok();
+}
+
+Result<Tracked, int> TrackedSrc(int v) {
+    return make::Ok<Tracked, int>(std::in_place, v);
+}
+
+Result<int, int> PassTracked() {
+    Tracked t = EAV_TRY(TrackedSrc(1));
+    return make::Ok(int{t.val});
+}
+
+}  // namespace
+
+TEST(ResultTryTest, Ok) {
+    g_steps = 0;
+    EXPECT_EQ(Chain(1, 2).unwrap_ok(), "3");
+    EXPECT_EQ(g_steps, 3);
+    EXPECT_EQ(ChainAssign(1, 2).unwrap_ok(), "3");
+}
+
+TEST(ResultTryTest, ShortCircuit) {
+    g_steps = 0;
+    EXPECT_EQ(Chain(-1, 2).unwrap_err(), (ErrorCode{-1, "negative"}));
+    EXPECT_EQ(g_steps, 1);
+
+    g_steps = 0;
+    EXPECT_EQ(Chain(1, -2).unwrap_err(), (ErrorCode{-2, "negative"}));
+    EXPECT_EQ(g_steps, 2);
+
+    EXPECT_EQ(ChainAssign(1, -2).unwrap_err(), (ErrorCode{-2, "negative"}));
+}
+
+TEST(ResultTryTest, Void) {
+    EXPECT_EQ(CheckedSum(1, 2).unwrap_ok(), 3);
+    EXPECT_EQ(CheckedSum(1, -2).unwrap_err(), (ErrorCode{-2, "negative"}));
+    EXPECT_TRUE(CheckedWide(0).is_ok());
+    EXPECT_EQ(CheckedWide(-3).unwrap_err().inner.code, -3);
+}
+
+TEST(ResultTryTest, ConvertsError) {
+    EXPECT_EQ(Widened(4).unwrap_ok(), 8);
+    EXPECT_EQ(Widened(-4).unwrap_err().inner, (ErrorCode{-4, "negative"}));
+}
+
+TEST(ResultTryTest, Lvalue) {
+    const Result<int, ErrorCode> res = Parse(5);
+    auto twice = [&]() -> Result<int, ErrorCode> {
+        return make::Ok(EAV_TRY(res) + EAV_TRY(res));  // copies, `res` is left intact
+    };
+    EXPECT_EQ(twice().unwrap_ok(), 10);
+    EXPECT_EQ(res.unwrap_ok(), 5);
+}
+
+TEST(ResultTryTest, SingleMove) {
+    Tracked::Reset();
+    EXPECT_EQ(PassTracked().unwrap_ok(), 1);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 1);  // out of the Result into `t`
+}
@@ -44,6 +44,16 @@ TEST(ResultTest, UnwrapOkOr) {
     EXPECT_EQ(r_err.unwrap_ok_or(11), 11);
 }
 
+TEST(ResultTest, UnwrapUnchecked) {
+    Result<std::unique_ptr<int>, int> r_ok = make::Ok(std::make_unique<int>(7));
+    Result<std::unique_ptr<int>, int> r_err = make::Err(404);
+
+    EXPECT_EQ(*r_ok.unwrap_ok_unchecked(), 7);
+    EXPECT_EQ(*std::move(r_ok).unwrap_ok_unchecked(), 7);
+    EXPECT_EQ(r_err.unwrap_err_unchecked(), 404);
+    EXPECT_EQ(std::as_const(r_err).unwrap_err_unchecked(), 404);
+}
+
 TEST(ResultTest, MoveOnlyTypeSupport) {
     auto ptr = std::make_unique<int>(100);
     Result<std::unique_ptr<int>, int> r = make::Ok(std::move(ptr));
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "TestUtils.hpp"
+
+// Result<void, E>: success without a value
+
+namespace {
+
+Result<void, ErrorCode> Validate(int x) {
+    if (x < 0) {
+        return make::Err(ErrorCode{1, "negative"});
+    }
+    return make::Ok();
+}
+
+}  // namespace
+
+// storage is E + tag, or just E when E's niche is never a valid error:
+static_assert(sizeof(Result<void, int>) == 2 * sizeof(int));
+static_assert(sizeof(Result<void, const char*>) == 2 * sizeof(const char*));
+static_assert(sizeof(Result<void, std::string>) == sizeof(Result<char, std::string>));
+
+TEST(ResultVoidTest, OkAndErr) {
+    EXPECT_TRUE(Validate(1).is_ok());
+    EXPECT_NO_THROW(Validate(1).unwrap_ok());
+    EXPECT_THROW(Validate(-1).unwrap_ok(), std::runtime_error);
+    EXPECT_EQ(Validate(-1).unwrap_err().msg, "negative");
+
+    static_assert(std::is_void_v<decltype(Validate(1).unwrap_ok())>);
+}
+
+TEST(ResultVoidTest, Emplace) {
+    Result<void, std::string> res = make::Ok();
+    res.emplace_err("failed");
+    EXPECT_EQ(res.unwrap_err(), "failed");
+    res.emplace_ok();
+    EXPECT_TRUE(res.is_ok());
+}
+
+TEST(ResultVoidTest, NullaryFunctions) {
+    // functions applied to the value of a Result<void, E> take no arguments
+    auto answer = Validate(1) | combine::result::MapOk([] { return 42; });
+    EXPECT_EQ(answer.unwrap_ok(), 42);
+
+    auto chained = Validate(1) | combine::result::AndThen([] { return Validate(-2); });
+    EXPECT_EQ(chained.unwrap_err().code, 1);
+
+    auto filtered = Validate(1) | combine::result::Filter([] { return false; }, ErrorCode{2, "filtered"});
+    EXPECT_EQ(filtered.unwrap_err().code, 2);
+
+    // and a function returning void produces a Result<void, E>
+    int calls = 0;
+    auto side = make::Ok(5) | combine::result::MapOk([&](int) { ++calls; });
+    static_assert(std::same_as<decltype(side), Result<void, detail::PendingType>>);
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(ResultVoidTest, LazyPipeline) {
+    int checked = 0;
+    const auto pipeline = combine::result::AndThen([](int x) { return Validate(x); })
+        | combine::result::MapOk([&] { ++checked; })
+        | combine::result::OrElse([](ErrorCode e) -> Result<void, std::string> { return make::Err(std::move(e.msg)); })
+        | combine::result::MapOk([] { return std::string("valid"); });
+
+    EXPECT_EQ((Result<int, ErrorCode>(make::Ok(3)) | pipeline).unwrap_ok(), "valid");
+    EXPECT_EQ((Result<int, ErrorCode>(make::Ok(-3)) | pipeline).unwrap_err(), "negative");
+    EXPECT_EQ(checked, 1);
+}
+
+TEST(ResultVoidTest, Constexpr) {
+    constexpr auto res = Result<void, int>(make::Ok()) | combine::result::MapOk([] { return 3; });
+    static_assert(res.unwrap_ok() == 3);
+}
+
+TEST(ResultVoidTest, NullErrorStaysErr) {
+    Result<void, const char*> res = make::Err(static_cast<const char*>(nullptr));
+    EXPECT_TRUE(res.is_err());
+    EXPECT_EQ(res.unwrap_err(), nullptr);
+
+    auto mapped = std::move(res) | combine::result::MapOk([] { return 1; });
+    EXPECT_EQ(mapped.unwrap_err(), nullptr);
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include <eav/Result.hpp>
+#include <eav/Traced.hpp>
+
+using namespace eav;
+
+EAV_NOINLINE Result<int, Traced<std::string>> FailDeepInside(int x);
+EAV_NOINLINE Result<int, Traced<std::string>> CallerOfFail(int x);
+
+// External linkage, not inlined: has a dynamic symbol (the suite links with -rdynamic)
+EAV_NOINLINE Result<int, Traced<std::string>> FailDeepInside(int x) {
+    if (x < 0) {
+        return make::Err(Traced(std::string("negative")));
+    }
+    return make::Ok(int{x});
+}
+
+EAV_NOINLINE Result<int, Traced<std::string>> CallerOfFail(int x) {
+    auto res = FailDeepInside(x);
+    asm volatile("" ::: "memory");  // keeps this frame from becoming a tail call
+    return res;
+}
+
+namespace {
+
+class TracedTest : public ::testing::Test {
+  protected:
+    void TearDown() override {
+        SetTraceSampling(TraceSampling::kAlways);
+    }
+};
+
+int TracedCount(int errors) {
+    int traced = 0;
+    for (int i = 0; i < errors; ++i) {
+        traced += FailDeepInside(-1).unwrap_err().frames().empty() ? 0 : 1;
+    }
+    return traced;
+}
+
+}  // namespace
+
+TEST_F(TracedTest, Ok) {
+    EXPECT_EQ(CallerOfFail(1).unwrap_ok(), 1);
+}
+
+TEST_F(TracedTest, Origin) {
+    auto res = FailDeepInside(-1);
+    const auto& err = res.unwrap_err();
+    EXPECT_EQ(err.error(), "negative");
+    EXPECT_NE(std::string(err.origin().file_name()).find("Traced.cpp"), std::string::npos);
+    EXPECT_NE(err.to_string().find("negative (at "), std::string::npos);
+}
+
+#if EAV_HAS_FRAME_WALK && EAV_HAS_DLADDR
+
+TEST_F(TracedTest, SymbolizedBacktrace) {
+    auto res = CallerOfFail(-1);
+    const auto& err = res.unwrap_err();
+    ASSERT_GE(err.frames().size(), 2u);
+
+    const std::string trace = err.backtrace();
+    const auto inside = trace.find("FailDeepInside");
+    const auto caller = trace.find("CallerOfFail");
+    EXPECT_NE(inside, std::string::npos) << trace;
+    EXPECT_NE(caller, std::string::npos) << trace;
+    EXPECT_LT(inside, caller) << trace;  // innermost first
+    EXPECT_EQ(trace.rfind("  #0 0x", 0), 0u) << trace;
+}
+
+TEST_F(TracedTest, SampleEveryN) {
+    SetTraceSampling(TraceSampling::kEveryN, 4);
+    EXPECT_EQ(TracedCount(16), 4);
+}
+
+TEST_F(TracedTest, SampleFirstPerSite) {
+    SetTraceSampling(TraceSampling::kFirstPerSite);
+    EXPECT_EQ(TracedCount(5), 1);
+    EXPECT_EQ(TracedCount(5), 0);  // the site was seen
+
+    const Traced<int> other(7);  // another site
+    EXPECT_FALSE(other.frames().empty());
+}
+
+#endif
+
+TEST_F(TracedTest, SampleNever) {
+    SetTraceSampling(TraceSampling::kNever);
+    EXPECT_EQ(TracedCount(8), 0);
+    EXPECT_EQ(FailDeepInside(-1).unwrap_err().backtrace(), "");
+}